@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "ECDSAsecp256k1PrivateKey.h"
+#include "ED25519PrivateKey.h"
+#include "Hbar.h"
+#include "PrivateKey.h"
+#include "PublicKey.h"
+#include "TransactionId.h"
+#include "TransferTransaction.h"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Hiero;
+
+namespace
+{
+/**
+ * Run an operation repeatedly and print how long each run of it took on average.
+ *
+ * @param name       The name of the operation to print.
+ * @param iterations The number of times to run the operation.
+ * @param operation  The operation to run.
+ */
+void benchmark(const std::string& name, int iterations, const std::function<void()>& operation)
+{
+  // Warm up, so that one-time initialization (algorithm fetches, context creation, etc.) isn't measured.
+  operation();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i)
+  {
+    operation();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << name << ": "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / iterations / 1000.0
+            << " us/op" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  // The number of iterations can optionally be passed as the first argument.
+  const int iterations = (argc > 1) ? std::stoi(argv[1]) : 10000;
+  if (iterations <= 0)
+  {
+    std::cout << "The number of iterations must be positive" << std::endl;
+    return 1;
+  }
+
+  const std::vector<std::byte> message(256, std::byte(0xAB));
+
+  // Benchmark ED25519 signing and verification.
+  const std::shared_ptr<PrivateKey> ed25519Key = ED25519PrivateKey::generatePrivateKey();
+  const std::vector<std::byte> ed25519Signature = ed25519Key->sign(message);
+  benchmark("ED25519 sign", iterations, [&ed25519Key, &message]() { static_cast<void>(ed25519Key->sign(message)); });
+  benchmark("ED25519 verify",
+            iterations,
+            [&ed25519Key, &ed25519Signature, &message]()
+            { static_cast<void>(ed25519Key->getPublicKey()->verifySignature(ed25519Signature, message)); });
+
+  // Benchmark ECDSAsecp256k1 signing and verification.
+  const std::unique_ptr<PrivateKey> ecdsaKey = ECDSAsecp256k1PrivateKey::generatePrivateKey();
+  const std::vector<std::byte> ecdsaSignature = ecdsaKey->sign(message);
+  benchmark("ECDSAsecp256k1 sign", iterations, [&ecdsaKey, &message]() { static_cast<void>(ecdsaKey->sign(message)); });
+  benchmark("ECDSAsecp256k1 verify",
+            iterations,
+            [&ecdsaKey, &ecdsaSignature, &message]()
+            { static_cast<void>(ecdsaKey->getPublicKey()->verifySignature(ecdsaSignature, message)); });
+
+  // Benchmark hashing a frozen transaction (SHA384), which happens for every submitted transaction.
+  TransferTransaction transaction = TransferTransaction()
+                                      .setNodeAccountIds({ AccountId(3ULL) })
+                                      .setTransactionId(TransactionId::generate(AccountId(2ULL)))
+                                      .addHbarTransfer(AccountId(2ULL), Hbar(-1LL))
+                                      .addHbarTransfer(AccountId(3ULL), Hbar(1LL))
+                                      .freeze();
+  transaction.sign(ed25519Key);
+  benchmark("Transaction hash", iterations, [&transaction]() { static_cast<void>(transaction.getTransactionHash()); });
+
+  return 0;
+}
@@ -186,9 +186,25 @@ public:
    * @param client The Client object used for network access.
    * @return A reference to the modified AccountId object.
    * @throws IllegalStateException if mAccountNum is empty or if the account does not exist in the Mirror Network.
+   * @throws UninitializedException If the Client has no mirror network.
    */
   AccountId& populateAccountEvmAddress(const Client& client);
 
+  /**
+   * Populate the EVM addresses of many Accounts using the Mirror Node. Each distinct account is fetched once, and the
+   * fetches run concurrently (a bounded number at a time) on the Client's pooled mirror node connections, using the
+   * Client's mirror response cache if it has one. An account that can't be resolved (because it has no account
+   * number, doesn't exist, or every mirror node fails) is left unchanged and reported in the result instead of
+   * throwing.
+   *
+   * @param client     The Client object used for network access.
+   * @param accountIds The AccountIds whose EVM addresses to populate.
+   * @return For each AccountId (in the same order), its EVM address, or an empty optional if it couldn't be resolved.
+   * @throws UninitializedException If the Client has no mirror network.
+   */
+  static std::vector<std::optional<EvmAddress>> populateAccountEvmAddresses(const Client& client,
+                                                                            std::vector<AccountId>& accountIds);
+
   /**
    * Get the string representation of this AccountId object.
    *
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_BYTE_VIEW_H_
+#define HIERO_SDK_CPP_BYTE_VIEW_H_
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace Hiero
+{
+/**
+ * A non-owning, read-only view of a contiguous sequence of bytes. A ByteView can be constructed from a byte vector or
+ * from a string (such as the bytes fields of a protobuf object) without copying the underlying data. The viewed bytes
+ * must outlive the ByteView.
+ */
+class ByteView
+{
+public:
+  /**
+   * Construct an empty ByteView.
+   */
+  constexpr ByteView() = default;
+
+  /**
+   * Construct a view of a raw byte array.
+   *
+   * @param data A pointer to the first byte to view.
+   * @param size The number of bytes to view.
+   */
+  constexpr ByteView(const std::byte* data, size_t size)
+    : mData(data)
+    , mSize(size)
+  {
+  }
+
+  /**
+   * Construct a view of a byte vector. This is implicit so that byte vectors can be passed wherever a ByteView is
+   * accepted.
+   *
+   * @param bytes The byte vector to view.
+   */
+  ByteView(const std::vector<std::byte>& bytes)
+    : mData(bytes.data())
+    , mSize(bytes.size())
+  {
+  }
+
+  /**
+   * Construct a view of the bytes of a string.
+   *
+   * @param str The string of which to view the bytes.
+   */
+  explicit ByteView(std::string_view str)
+    : mData(reinterpret_cast<const std::byte*>(str.data()))
+    , mSize(str.size())
+  {
+  }
+
+  /**
+   * Get a pointer to the first viewed byte.
+   *
+   * @return A pointer to the first viewed byte.
+   */
+  [[nodiscard]] constexpr const std::byte* data() const { return mData; }
+
+  /**
+   * Get the number of viewed bytes.
+   *
+   * @return The number of viewed bytes.
+   */
+  [[nodiscard]] constexpr size_t size() const { return mSize; }
+
+  /**
+   * Determine if this ByteView views no bytes.
+   *
+   * @return \c TRUE if this ByteView views no bytes, otherwise \c FALSE.
+   */
+  [[nodiscard]] constexpr bool empty() const { return mSize == 0ULL; }
+
+  /**
+   * Get an iterator to the first viewed byte.
+   *
+   * @return An iterator to the first viewed byte.
+   */
+  [[nodiscard]] constexpr const std::byte* begin() const { return mData; }
+
+  /**
+   * Get an iterator past the last viewed byte.
+   *
+   * @return An iterator past the last viewed byte.
+   */
+  [[nodiscard]] constexpr const std::byte* end() const { return mData + mSize; }
+
+  /**
+   * Get a view of a sub-range of the viewed bytes. The sub-range is clamped to the viewed bytes.
+   *
+   * @param offset The offset of the first byte of the sub-range.
+   * @param count  The maximum number of bytes in the sub-range.
+   * @return The view of the sub-range.
+   */
+  [[nodiscard]] constexpr ByteView subview(size_t offset, size_t count = static_cast<size_t>(-1)) const
+  {
+    offset = (offset < mSize) ? offset : mSize;
+    return { mData + offset, (count < mSize - offset) ? count : mSize - offset };
+  }
+
+  /**
+   * Copy the viewed bytes into a new byte vector.
+   *
+   * @return A byte vector containing a copy of the viewed bytes.
+   */
+  [[nodiscard]] std::vector<std::byte> toVector() const { return { begin(), end() }; }
+
+  /**
+   * Get a string view of the viewed bytes.
+   *
+   * @return A string view of the viewed bytes.
+   */
+  [[nodiscard]] std::string_view toStringView() const { return { reinterpret_cast<const char*>(mData), mSize }; }
+
+private:
+  /**
+   * A pointer to the first viewed byte.
+   */
+  const std::byte* mData = nullptr;
+
+  /**
+   * The number of viewed bytes.
+   */
+  size_t mSize = 0ULL;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_BYTE_VIEW_H_
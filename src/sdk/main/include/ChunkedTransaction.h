@@ -2,6 +2,7 @@
 #ifndef HIERO_SDK_CPP_CHUNKED_TRANSACTION_H_
 #define HIERO_SDK_CPP_CHUNKED_TRANSACTION_H_
 
+#include "ByteView.h"
 #include "Defaults.h"
 #include "Transaction.h"
 #include "TransactionId.h"
@@ -11,6 +12,7 @@
 #include <cstdint>
 #include <functional>
 #include <future>
+#include <memory>
 #include <stdexcept>
 #include <string_view>
 #include <unordered_map>
@@ -82,6 +84,11 @@ public:
   /**
    * Execute all chunks of this ChunkedTransaction.
    *
+   * Chunks are submitted in order, with up to getMaxChunksInFlight() of them in flight at once. A ChunkedTransaction
+   * that gets a receipt after each chunk (FileAppendTransaction) instead submits them one at a time, waiting for each
+   * receipt, since pipelined chunks may reach consensus out of order. Pipelined chunks get no receipts: a chunk that
+   * passes pre-check but fails at consensus is only seen by getting its receipt from the returned responses.
+   *
    * @param client The Client to use to submit this ChunkedTransaction.
    * @return The list of TransactionResponse objects sent from the Hiero network that contains the result of the
    *         requests.
@@ -94,6 +101,11 @@ public:
   /**
    * Execute all chunks of this ChunkedTransaction with a specific timeout.
    *
+   * Chunks are submitted in order, with up to getMaxChunksInFlight() of them in flight at once. A ChunkedTransaction
+   * that gets a receipt after each chunk (FileAppendTransaction) instead submits them one at a time, waiting for each
+   * receipt, since pipelined chunks may reach consensus out of order. Pipelined chunks get no receipts: a chunk that
+   * passes pre-check but fails at consensus is only seen by getting its receipt from the returned responses.
+   *
    * @param client The Client to use to submit this ChunkedTransaction.
    * @param timeout The desired timeout for the execution of this ChunkedTransaction.
    * @return The list of TransactionResponse objects sent from the Hiero network that contains the result of the
@@ -253,6 +265,19 @@ public:
    */
   SdkRequestType& setChunkSize(unsigned int size);
 
+  /**
+   * Set the maximum number of chunks executeAll() may have submitted and awaiting a response at once. Chunks in flight
+   * at the same time can reach consensus in any order, so this only applies to ChunkedTransactions that don't get a
+   * receipt after each chunk, such as TopicMessageSubmitTransaction (whose chunks are reassembled from their chunk
+   * info). FileAppendTransaction relies on each chunk's receipt to append its chunks in order, so it always submits
+   * them one at a time.
+   *
+   * @param chunks The maximum number of chunks to have in flight at once.
+   * @return A reference to this derived ChunkedTransaction object with the newly-set maximum.
+   * @throws std::invalid_argument If the input number of chunks is 0.
+   */
+  SdkRequestType& setMaxChunksInFlight(unsigned int chunks);
+
   /**
    * Get the maximum number of chunks for this ChunkedTransaction.
    *
@@ -267,6 +292,13 @@ public:
    */
   [[nodiscard]] unsigned int getChunkSize() const;
 
+  /**
+   * Get the maximum number of chunks executeAll() may have submitted and awaiting a response at once.
+   *
+   * @return The maximum number of chunks to have in flight at once.
+   */
+  [[nodiscard]] unsigned int getMaxChunksInFlight() const;
+
 protected:
   ChunkedTransaction();
   ~ChunkedTransaction();
@@ -302,6 +334,15 @@ protected:
   SdkRequestType& setData(const std::vector<std::byte>& data);
   SdkRequestType& setData(std::string_view data);
 
+  /**
+   * Set the data for this ChunkedTransaction without copying it. The data is shared with the caller and with any
+   * copies of this ChunkedTransaction, so it must not be modified afterwards.
+   *
+   * @param data The data for this ChunkedTransaction. A nullptr is treated as no data.
+   * @return A reference to this derived ChunkedTransaction object with the newly-set data.
+   */
+  SdkRequestType& setData(std::shared_ptr<const std::vector<std::byte>> data);
+
   /**
    * Get the data for this ChunkedTransaction.
    *
@@ -309,6 +350,13 @@ protected:
    */
   [[nodiscard]] std::vector<std::byte> getData() const;
 
+  /**
+   * Get a view of the data for this ChunkedTransaction. The view is valid until the data is next set.
+   *
+   * @return A view of the data for this ChunkedTransaction.
+   */
+  [[nodiscard]] ByteView getDataView() const;
+
   /**
    * Get the data contained in the input chunk of this ChunkedTransaction.
    *
@@ -317,6 +365,15 @@ protected:
    */
   [[nodiscard]] std::vector<std::byte> getDataForChunk(unsigned int chunk) const;
 
+  /**
+   * Get a view of the data contained in the input chunk of this ChunkedTransaction. The view is valid until the data is
+   * next set.
+   *
+   * @param chunk The chunk number of which to get the data.
+   * @return A view of the data contained in the input chunk number.
+   */
+  [[nodiscard]] ByteView getDataViewForChunk(unsigned int chunk) const;
+
   /**
    * Set the receipt retrieval policy for this ChunkedTransaction.
    *
@@ -393,6 +450,22 @@ private:
    */
   [[nodiscard]] std::vector<proto::Transaction> getChunkedTransactionProtobufObjects();
 
+  /**
+   * Submit the chunks of this ChunkedTransaction after the first with up to the maximum number of chunks in flight at
+   * once. Each in-flight chunk is submitted by its own copy of this ChunkedTransaction, so each retries independently.
+   * The first chunk must already have been executed, so that this ChunkedTransaction is frozen and signed.
+   *
+   * @param client         The Client to use to submit the chunks.
+   * @param timeout        The desired timeout for the submission of each chunk.
+   * @param requiredChunks The number of chunks to submit.
+   * @param responses      The list of responses to fill, one for each chunk.
+   * @throws The first exception thrown while submitting a chunk. No further chunks are submitted once one fails.
+   */
+  void executeRemainingChunksPipelined(const Client& client,
+                                       const std::chrono::system_clock::duration& timeout,
+                                       unsigned int requiredChunks,
+                                       std::vector<TransactionResponse>& responses);
+
   /**
    * Implementation object used to hide implementation details and internal headers.
    */
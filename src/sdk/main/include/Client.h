@@ -19,6 +19,9 @@ namespace internal
 {
 class MirrorNetwork;
 class Network;
+class HttpExecutor;
+class MirrorResponseCache;
+class SubscriptionReactor;
 }
 class AccountId;
 class Hbar;
@@ -275,7 +278,9 @@ public:
    * Initiate an orderly close of communications with the networks with which this Client was configured to
    * communicate. Preexisting transactions or queries continue but subsequent calls would be immediately cancelled.
    *
-   * After this method returns, this Client can be re-used. All network communication can be re-established as needed.
+   * After this method returns, this Client can be re-used for transactions and queries sent to consensus nodes, and
+   * that communication is re-established as needed. Mirror node subscriptions and asynchronous mirror node REST
+   * requests can't be started again, as the threads that run them aren't recreated once this Client is closed.
    */
   void close();
 
@@ -413,6 +418,105 @@ public:
    */
   [[nodiscard]] std::vector<std::string> getMirrorNetwork() const;
 
+  /**
+   * Set the maximum number of mirror node REST responses this Client caches. Cacheable responses (e.g. account and
+   * contract lookups, registered node lists, and contract calls pinned to a block) are then served from the cache for a
+   * per-route amount of time, and revalidated with their ETag once stale. Zero (the default) disables the cache.
+   * Changing the size drops every cached response.
+   *
+   * @param maxEntries The maximum number of mirror node REST responses to cache, or zero to disable the cache.
+   * @return A reference to this Client object with the newly-set mirror response cache size.
+   */
+  Client& setMirrorResponseCacheSize(size_t maxEntries);
+
+  /**
+   * Get the maximum number of mirror node REST responses this Client caches.
+   *
+   * @return The maximum number of mirror node REST responses this Client caches, or zero if the cache is disabled.
+   */
+  [[nodiscard]] size_t getMirrorResponseCacheSize() const;
+
+  /**
+   * Set the amount of time for which this Client caches fee estimates (see FeeEstimateQuery). Estimates are cached by
+   * the shape of the estimated transaction (its body without its transaction ID, node account ID and memo, and the
+   * number of its signatures), so structurally identical transactions share one estimate. A cached estimate never
+   * outlives the hour in which it was made, as fee schedules change on hour boundaries. Zero (the default) disables
+   * the cache. Changing the time-to-live drops every cached estimate.
+   *
+   * @param ttl The amount of time for which to cache fee estimates, or zero to disable the cache.
+   * @return A reference to this Client object with the newly-set fee estimate cache time-to-live.
+   * @throws std::invalid_argument If the time-to-live is negative.
+   */
+  Client& setFeeEstimateCacheTtl(const std::chrono::system_clock::duration& ttl);
+
+  /**
+   * Get the amount of time for which this Client caches fee estimates.
+   *
+   * @return The amount of time for which this Client caches fee estimates, or zero if the cache is disabled.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getFeeEstimateCacheTtl() const;
+
+  /**
+   * Set whether this Client compresses its mirror node REST requests and fee estimates. With compression, responses
+   * may be sent gzip- or deflate-encoded, and large request bodies are sent gzip-encoded to mirror nodes that accept
+   * them. Compression is enabled by default.
+   *
+   * @param enable \c TRUE if mirror node REST requests should be compressed, otherwise \c FALSE.
+   * @return A reference to this Client object with the newly-set HTTP compression policy.
+   */
+  Client& setHttpCompression(bool enable);
+
+  /**
+   * Determine if this Client compresses its mirror node REST requests and fee estimates.
+   *
+   * @return \c TRUE if mirror node REST requests are compressed, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isHttpCompression() const;
+
+  /**
+   * Set the amount of time for which this Client caches the costs of paid queries. Costs are cached by the type of the
+   * query and the size class of its request (the power of two its serialized size rounds up to), so a paid query of a
+   * type and size class whose cost is cached pays that cost without asking for it first. A query whose cached cost
+   * turns out too low (i.e. it fails pre-check with INSUFFICIENT_TX_FEE) drops the cached cost, asks for its cost and
+   * runs again. Zero (the default) disables the cache. Changing the time-to-live drops every cached cost.
+   *
+   * The key doesn't tell apart queries whose cost depends on their response, such as FileContentsQuery (the size of
+   * the file) or AccountInfoQuery (the size of the account's state). Such a query pays the last cost cached for its
+   * type and size class, and if that's higher than its own cost, it silently overpays by the difference (up to its
+   * maximum query payment) rather than failing. Leave the cache disabled where that matters.
+   *
+   * @param ttl The amount of time for which to cache query costs, or zero to disable the cache.
+   * @return A reference to this Client object with the newly-set query cost cache time-to-live.
+   * @throws std::invalid_argument If the time-to-live is negative.
+   */
+  Client& setQueryCostCacheTtl(const std::chrono::system_clock::duration& ttl);
+
+  /**
+   * Get the amount of time for which this Client caches the costs of paid queries.
+   *
+   * @return The amount of time for which this Client caches the costs of paid queries, or zero if the cache is
+   *         disabled.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getQueryCostCacheTtl() const;
+
+  /**
+   * Set whether paid queries whose cost isn't cached should pay their maximum query payment up front instead of asking
+   * for their cost first. A prepaid query is charged its whole payment, even if its cost is lower. A query whose cost
+   * is higher than its maximum query payment fails pre-check with INSUFFICIENT_TX_FEE, after which it asks for its cost
+   * and runs again (or fails with MaxQueryPaymentExceededException). Disabled by default.
+   *
+   * @param prepay \c TRUE if paid queries should pay their maximum query payment up front, otherwise \c FALSE.
+   * @return A reference to this Client object with the newly-set query prepayment policy.
+   */
+  Client& setPrepayQueries(bool prepay);
+
+  /**
+   * Determine if paid queries whose cost isn't cached pay their maximum query payment up front.
+   *
+   * @return \c TRUE if paid queries pay their maximum query payment up front, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isPrepayQueries() const;
+
   /**
    * Set the Logger to be used by this Client.
    *
@@ -718,6 +822,45 @@ public:
    */
   [[nodiscard]] std::shared_ptr<internal::MirrorNetwork> getClientMirrorNetwork() const;
 
+  /**
+   * Get a pointer to the SubscriptionReactor that drives this Client's mirror node subscriptions. The reactor is
+   * created on first use, and is shut down when this Client is closed.
+   *
+   * @return A pointer to the SubscriptionReactor that drives this Client's mirror node subscriptions.
+   * @throws IllegalStateException If this Client is closed.
+   */
+  [[nodiscard]] std::shared_ptr<internal::SubscriptionReactor> getSubscriptionReactor() const;
+
+  /**
+   * Get a pointer to the HttpExecutor that runs this Client's asynchronous mirror node REST requests. The executor is
+   * created on first use, and is shut down when this Client is closed.
+   *
+   * @return A pointer to the HttpExecutor that runs this Client's asynchronous mirror node REST requests.
+   * @throws IllegalStateException If this Client is closed.
+   */
+  [[nodiscard]] std::shared_ptr<internal::HttpExecutor> getHttpExecutor() const;
+
+  /**
+   * Get a pointer to the cache of this Client's mirror node REST responses.
+   *
+   * @return A pointer to the cache of this Client's mirror node REST responses, or nullptr if it's disabled.
+   */
+  [[nodiscard]] std::shared_ptr<internal::MirrorResponseCache> getMirrorResponseCache() const;
+
+  /**
+   * Get a pointer to the cache of this Client's fee estimates.
+   *
+   * @return A pointer to the cache of this Client's fee estimates, or nullptr if it's disabled.
+   */
+  [[nodiscard]] std::shared_ptr<internal::MirrorResponseCache> getFeeEstimateCache() const;
+
+  /**
+   * Get a pointer to the cache of the costs of this Client's paid queries.
+   *
+   * @return A pointer to the cache of the costs of this Client's paid queries, or nullptr if it's disabled.
+   */
+  [[nodiscard]] std::shared_ptr<internal::MirrorResponseCache> getQueryCostCache() const;
+
 private:
   /**
    * Replace the network being used by this Client with nodes contained in an address book.
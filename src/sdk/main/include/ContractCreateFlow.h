@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <istream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -44,6 +45,7 @@ public:
    * @throws MaxAttemptsExceededException If this Executable attempts to execute past the number of allowable attempts.
    * @throws PrecheckStatusException      If this Executable fails its pre-check.
    * @throws UninitializedException       If the input Client has not yet been initialized.
+   * @throws IllegalStateException        If the bytecode stream was read by a previous execution.
    */
   TransactionResponse execute(const Client& client);
 
@@ -57,6 +59,7 @@ public:
    * @throws MaxAttemptsExceededException If this Executable attempts to execute past the number of allowable attempts.
    * @throws PrecheckStatusException      If this Executable fails its pre-check.
    * @throws UninitializedException       If the input Client has not yet been initialized.
+   * @throws IllegalStateException        If the bytecode stream was read by a previous execution.
    */
   TransactionResponse execute(const Client& client, const std::chrono::system_clock::duration& timeout);
 
@@ -70,6 +73,26 @@ public:
   ContractCreateFlow& setBytecode(const std::vector<std::byte>& byteCode);
   ContractCreateFlow& setBytecode(std::string_view byteCode);
 
+  /**
+   * Set a stream from which to read the smart contract bytecode. The bytecode is read while this ContractCreateFlow
+   * executes, one FileAppendTransaction's worth of chunks at a time, so large bytecode is never held in memory all at
+   * once. The stream must remain valid until execution has completed. It is read to its end by the first execution, so
+   * executing this ContractCreateFlow again requires setting the bytecode again.
+   *
+   * @param byteCode The stream from which to read the bytecode for the new smart contract instance.
+   * @return A reference to this ContractCreateFlow object with the newly-set bytecode stream.
+   */
+  ContractCreateFlow& setBytecode(std::istream& byteCode);
+
+  /**
+   * Set the path of a file from which to read the smart contract bytecode. The file is opened when this
+   * ContractCreateFlow executes and read the same way as a stream set with setBytecode(std::istream&).
+   *
+   * @param path The path of the file that contains the bytecode for the new smart contract instance.
+   * @return A reference to this ContractCreateFlow object with the newly-set bytecode file.
+   */
+  ContractCreateFlow& setBytecodeFile(std::string_view path);
+
   /**
    * Set the admin key for the new smart contract instance. The state of the smart contract instance and its fields can
    * be modified arbitrarily if this key signs a transaction to modify it. If this is not set, then such modifications
@@ -342,6 +365,21 @@ private:
    */
   std::vector<std::byte> mBytecode;
 
+  /**
+   * The stream from which to read the smart contract bytecode, if the bytecode should be read from a stream.
+   */
+  std::istream* mBytecodeStream = nullptr;
+
+  /**
+   * Has an execution started reading mBytecodeStream?
+   */
+  bool mBytecodeStreamConsumed = false;
+
+  /**
+   * The path of the file from which to read the smart contract bytecode, if the bytecode should be read from a file.
+   */
+  std::string mBytecodeFile;
+
   /**
    * The maximum number of chunks into which the FileAppendTransaction that will be sent as a part of this
    * ContractCreateFlow will get broken up.
@@ -73,6 +73,105 @@ constexpr auto DEFAULT_CHUNK_SIZE = 1024U;
  * The default number of chunks for a ChunkedTransaction.
  */
 constexpr auto DEFAULT_MAX_CHUNKS = 20U;
+/**
+ * The default number of chunks a ChunkedTransaction can have in flight at once when executing all of its chunks.
+ */
+constexpr auto DEFAULT_MAX_CHUNKS_IN_FLIGHT = 1U;
+/**
+ * The default maximum number of messages that can wait on a TopicPublisher's queue.
+ */
+constexpr auto DEFAULT_TOPIC_PUBLISHER_QUEUE_CAPACITY = 1000ULL;
+/**
+ * The default maximum number of messages a TopicPublisher can be submitting at once.
+ */
+constexpr auto DEFAULT_TOPIC_PUBLISHER_MAX_IN_FLIGHT = 4U;
+/**
+ * The default maximum number of messages a TopicPublisher worker takes off the queue and signs at once.
+ */
+constexpr auto DEFAULT_TOPIC_PUBLISHER_BATCH_SIZE = 10U;
+/**
+ * The default number of threads a Client uses to drive the completion queue shared by its mirror node subscriptions.
+ */
+constexpr auto DEFAULT_SUBSCRIPTION_POLLER_THREADS = 1U;
+/**
+ * The default number of threads a Client uses to run the callbacks of its mirror node subscriptions.
+ */
+constexpr auto DEFAULT_SUBSCRIPTION_CALLBACK_THREADS = 4U;
+/**
+ * The default maximum number of callbacks a Client queues for its mirror node subscriptions before the threads posting
+ * more wait for room.
+ */
+constexpr auto DEFAULT_SUBSCRIPTION_MAX_PENDING_CALLBACKS = 10000ULL;
+/**
+ * The default maximum number of message bytes a topic subscription holds for partially-received multi-chunk messages.
+ */
+constexpr auto DEFAULT_MAX_PENDING_CHUNK_BYTES = 16ULL * 1024ULL * 1024ULL;
+/**
+ * The default maximum amount of consensus time a topic subscription waits for the rest of a multi-chunk message.
+ */
+constexpr auto DEFAULT_MAX_PENDING_CHUNK_AGE = std::chrono::minutes(5);
+/**
+ * The number of evicted multi-chunk messages whose late chunks a topic subscription recognizes and drops.
+ */
+constexpr auto DEFAULT_MAX_EVICTED_TOPIC_MESSAGES = 1024ULL;
+/**
+ * The default maximum number of topic messages delivered to a batch subscription callback at once.
+ */
+constexpr auto DEFAULT_MAX_TOPIC_MESSAGE_BATCH_SIZE = 100ULL;
+/**
+ * The default maximum amount of time a batch subscription waits for a batch of topic messages to fill up.
+ */
+constexpr auto DEFAULT_MAX_TOPIC_MESSAGE_BATCH_DELAY = std::chrono::milliseconds(100);
+/**
+ * The default amount of time between flushes of a TopicSubscriptionManager's checkpoints.
+ */
+constexpr auto DEFAULT_TOPIC_CHECKPOINT_INTERVAL = std::chrono::seconds(5);
+/**
+ * The default maximum number of HTTP connections open to one host at a time.
+ */
+constexpr auto DEFAULT_HTTP_MAX_CONNECTIONS_PER_HOST = 8U;
+/**
+ * The default amount of time an idle HTTP connection is kept open for reuse.
+ */
+constexpr auto DEFAULT_HTTP_IDLE_CONNECTION_TIMEOUT = std::chrono::seconds(30);
+/**
+ * The default amount of time to wait for an HTTP connection to be established.
+ */
+constexpr auto DEFAULT_HTTP_CONNECTION_TIMEOUT = std::chrono::seconds(10);
+/**
+ * The default amount of time to wait to read (or write) data on an HTTP connection.
+ */
+constexpr auto DEFAULT_HTTP_READ_WRITE_TIMEOUT = std::chrono::seconds(30);
+/**
+ * The size, in bytes, from which a compressed HTTP request body is sent gzip-encoded. Smaller bodies gain too little to
+ * be worth encoding.
+ */
+constexpr auto DEFAULT_HTTP_REQUEST_COMPRESSION_THRESHOLD = 1024ULL;
+/**
+ * The default number of threads a Client uses to run asynchronous mirror node REST requests.
+ */
+constexpr auto DEFAULT_HTTP_EXECUTOR_THREADS = 8U;
+/**
+ * The default maximum number of a Client's asynchronous mirror node REST requests to one host that run at a time. This
+ * is kept below the number of executor threads so that one busy host can't occupy all of them.
+ */
+constexpr auto DEFAULT_HTTP_EXECUTOR_MAX_TASKS_PER_HOST = 4U;
+/**
+ * The default maximum number of requests a batched mirror node operation keeps in flight at a time.
+ */
+constexpr auto DEFAULT_MAX_MIRROR_BATCH_REQUESTS_IN_FLIGHT = 32U;
+/**
+ * The default maximum number of block-pinned contract call results a MirrorNodeContractCallEngine caches.
+ */
+constexpr auto DEFAULT_MAX_CACHED_CONTRACT_CALL_RESULTS = 10000U;
+/**
+ * The default maximum number of fee estimates a Client caches, when its fee estimate cache is enabled.
+ */
+constexpr auto DEFAULT_MAX_CACHED_FEE_ESTIMATES = 1000U;
+/**
+ * The default maximum number of query costs a Client caches, when its query cost cache is enabled.
+ */
+constexpr auto DEFAULT_MAX_CACHED_QUERY_COSTS = 1000U;
 /**
  * The default amount of time to wait after a network update to update again.
  */
@@ -203,6 +203,17 @@ private:
    */
   explicit ECDSAsecp256k1PrivateKey(internal::OpenSSLUtils::EVP_PKEY&& key,
                                     std::vector<std::byte> chainCode = std::vector<std::byte>());
+
+  /**
+   * The raw private key bytes, cleansed when destroyed.
+   */
+  struct Secret;
+
+  /**
+   * This ECDSAsecp256k1PrivateKey's raw private key bytes, extracted once so that signing and serializing don't have to
+   * encode the OpenSSL key again. Copies of this ECDSAsecp256k1PrivateKey share them, since they hold the same key.
+   */
+  std::shared_ptr<const Secret> mSecret;
 };
 
 } // namespace Hiero
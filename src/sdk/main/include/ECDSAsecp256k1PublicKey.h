@@ -14,6 +14,11 @@ namespace Hiero
 class EvmAddress;
 }
 
+namespace Hiero::internal::OpenSSLUtils
+{
+class KeyDigestContext;
+}
+
 namespace Hiero
 {
 /**
@@ -201,6 +206,12 @@ private:
    * @returns A pointer to this ECDSAsecp256k1PublicKey.
    */
   [[nodiscard]] std::shared_ptr<PublicKey> getShared() const override;
+
+  /**
+   * The digest-verify context bound to this ECDSAsecp256k1PublicKey's key, which is duplicated for each verification.
+   * Copies of this ECDSAsecp256k1PublicKey share it, since they hold the same key.
+   */
+  std::shared_ptr<internal::OpenSSLUtils::KeyDigestContext> mVerifyContext;
 };
 
 } // namespace Hiero
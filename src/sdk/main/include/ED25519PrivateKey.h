@@ -12,6 +12,7 @@
 namespace Hiero::internal::OpenSSLUtils
 {
 class EVP_PKEY;
+class KeyDigestContext;
 }
 
 namespace Hiero
@@ -180,6 +181,12 @@ private:
    */
   explicit ED25519PrivateKey(internal::OpenSSLUtils::EVP_PKEY&& key,
                              std::vector<std::byte> chainCode = std::vector<std::byte>());
+
+  /**
+   * The digest-sign context bound to this ED25519PrivateKey's key, which is duplicated for each signature. Copies of
+   * this ED25519PrivateKey share it, since they hold the same key.
+   */
+  std::shared_ptr<internal::OpenSSLUtils::KeyDigestContext> mSignContext;
 };
 
 } // namespace Hiero
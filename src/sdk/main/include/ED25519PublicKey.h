@@ -9,6 +9,11 @@
 #include <string_view>
 #include <vector>
 
+namespace Hiero::internal::OpenSSLUtils
+{
+class KeyDigestContext;
+}
+
 namespace Hiero
 {
 /**
@@ -144,6 +149,12 @@ private:
    * @returns A pointer to this ED25519PublicKey.
    */
   [[nodiscard]] std::shared_ptr<PublicKey> getShared() const override;
+
+  /**
+   * The digest-verify context bound to this ED25519PublicKey's key, which is duplicated for each verification. Copies
+   * of this ED25519PublicKey share it, since they hold the same key.
+   */
+  std::shared_ptr<internal::OpenSSLUtils::KeyDigestContext> mVerifyContext;
 };
 
 } // namespace Hiero
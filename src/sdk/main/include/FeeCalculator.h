@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_FEE_CALCULATOR_H_
+#define HIERO_SDK_CPP_FEE_CALCULATOR_H_
+
+#include "ExchangeRates.h"
+#include "FeeDataType.h"
+#include "FeeSchedules.h"
+#include "Hbar.h"
+#include "RequestType.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace proto
+{
+class Transaction;
+}
+
+namespace Hiero
+{
+class Client;
+class WrappedTransaction;
+}
+
+namespace Hiero
+{
+/**
+ * Calculates the fees of transactions locally, from a fee schedule (file 0.0.111) and exchange rates (file 0.0.112)
+ * loaded once and kept until they expire, so that transactions can be priced without a round trip to the network.
+ *
+ * A transaction is priced from its size, its number of signatures, and its type: the node, network and service fees
+ * are the prices of its fee schedule entry applied to its bytes and signature verifications, each bounded by the
+ * entry's minimum and maximum, and converted from tinycents to tinybars at the exchange rate. Resources whose usage
+ * depends on state or execution (storage, gas, transferred value, etc.) aren't priced, so the result is the base fee
+ * of the transaction rather than the exact fee the network charges.
+ *
+ * A FeeCalculator may be used from many threads at once, including while it's refreshed.
+ */
+class FeeCalculator
+{
+public:
+  /**
+   * Construct with a fee schedule and exchange rates already at hand.
+   *
+   * @param feeSchedules  The current and next fee schedules.
+   * @param exchangeRates The current and next exchange rates.
+   */
+  FeeCalculator(const FeeSchedules& feeSchedules, const ExchangeRates& exchangeRates);
+
+  /**
+   * Construct by loading the fee schedule and exchange rates from the network. Each file is read with a (paid)
+   * FileContentsQuery.
+   *
+   * @param client The Client to use to read the files.
+   * @return The constructed FeeCalculator.
+   * @throws PrecheckStatusException If either file query fails pre-check.
+   * @throws MaxAttemptsExceededException If either file query runs out of attempts.
+   */
+  [[nodiscard]] static FeeCalculator fromNetwork(const Client& client);
+
+  FeeCalculator(const FeeCalculator&) = delete;
+  FeeCalculator& operator=(const FeeCalculator&) = delete;
+  FeeCalculator(FeeCalculator&&) = delete;
+  FeeCalculator& operator=(FeeCalculator&&) = delete;
+
+  /**
+   * Replace the fee schedule and exchange rates.
+   *
+   * @param feeSchedules  The current and next fee schedules.
+   * @param exchangeRates The current and next exchange rates.
+   */
+  void update(const FeeSchedules& feeSchedules, const ExchangeRates& exchangeRates);
+
+  /**
+   * Reload the fee schedule and exchange rates from the network.
+   *
+   * @param client The Client to use to read the files.
+   * @throws PrecheckStatusException If either file query fails pre-check.
+   * @throws MaxAttemptsExceededException If either file query runs out of attempts.
+   */
+  void refresh(const Client& client);
+
+  /**
+   * Reload the fee schedule and exchange rates from the network if they've expired.
+   *
+   * @param client The Client to use to read the files.
+   * @return \c TRUE if they were reloaded, otherwise \c FALSE.
+   * @throws PrecheckStatusException If either file query fails pre-check.
+   * @throws MaxAttemptsExceededException If either file query runs out of attempts.
+   */
+  bool refreshIfExpired(const Client& client);
+
+  /**
+   * Determine if the fee schedule or exchange rates have expired, i.e. if a time is past the expiration of the next
+   * fee schedule or the next exchange rate.
+   *
+   * @param time The time at which to check.
+   * @return \c TRUE if the fee schedule or exchange rates have expired at the time, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isExpired(
+    const std::chrono::system_clock::time_point& time = std::chrono::system_clock::now()) const;
+
+  /**
+   * Calculate the fee of a frozen transaction. A transaction that isn't signed yet is priced as if its payer had signed
+   * it with one ED25519 key.
+   *
+   * @param transaction The frozen transaction of which to calculate the fee. For chunked transactions, the fee of the
+   *                    first chunk is calculated.
+   * @param time        The time at which the transaction is to be submitted, which selects the fee schedule and
+   *                    exchange rate.
+   * @return The fee of the transaction.
+   * @throws std::invalid_argument If the transaction's type has no fee schedule entry.
+   */
+  [[nodiscard]] Hbar calculateFee(
+    const WrappedTransaction& transaction,
+    const std::chrono::system_clock::time_point& time = std::chrono::system_clock::now()) const;
+
+  /**
+   * Calculate the fee of a transaction protobuf object. A transaction that isn't signed yet is priced as if its payer
+   * had signed it with one ED25519 key.
+   *
+   * @param transaction The transaction protobuf object of which to calculate the fee.
+   * @param time        The time at which the transaction is to be submitted, which selects the fee schedule and
+   *                    exchange rate.
+   * @return The fee of the transaction.
+   * @throws std::invalid_argument If the transaction can't be parsed, or its type has no fee schedule entry.
+   */
+  [[nodiscard]] Hbar calculateFee(
+    const proto::Transaction& transaction,
+    const std::chrono::system_clock::time_point& time = std::chrono::system_clock::now()) const;
+
+  /**
+   * Calculate the fee of a transaction from its type, size and number of signatures.
+   *
+   * @param type             The type of the transaction.
+   * @param transactionBytes The size of the transaction (its body and signatures), in bytes.
+   * @param signatures       The number of signatures on the transaction.
+   * @param subType          The scope of the fee schedule entry to use. Falls back to the entry with no special scope
+   *                         if the fee schedule has none with this scope.
+   * @param time             The time at which the transaction is to be submitted, which selects the fee schedule and
+   *                         exchange rate.
+   * @return The fee of the transaction.
+   * @throws std::invalid_argument If the type has no fee schedule entry.
+   */
+  [[nodiscard]] Hbar calculateFee(
+    RequestType type,
+    size_t transactionBytes,
+    size_t signatures,
+    FeeDataType subType = FeeDataType::DEFAULT,
+    const std::chrono::system_clock::time_point& time = std::chrono::system_clock::now()) const;
+
+private:
+  /**
+   * The fee schedule entries and exchange rates, indexed for pricing.
+   */
+  struct FeeTables;
+
+  /**
+   * The mutex guarding the pointer to the tables. The tables themselves are immutable, so they are read outside of it.
+   */
+  mutable std::mutex mMutex;
+
+  /**
+   * The tables in use.
+   */
+  std::shared_ptr<const FeeTables> mTables;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_FEE_CALCULATOR_H_
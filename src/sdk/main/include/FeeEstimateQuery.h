@@ -7,9 +7,13 @@
 #include "FeeEstimateResponse.h"
 #include "WrappedTransaction.h"
 
+#include <chrono>
 #include <cstdint>
+#include <future>
+#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace proto
 {
@@ -41,6 +45,32 @@ public:
    */
   [[nodiscard]] FeeEstimateResponse execute(const Client& client);
 
+  /**
+   * Execute the fee estimation query asynchronously on the supplied client's HTTP executor, so that many estimates can
+   * be in flight at once without a thread each. Retries wait out their backoff on the executor without holding one of
+   * its threads. The transaction is frozen and serialized before this returns, so this FeeEstimateQuery may be
+   * changed or destroyed afterwards, but the Client must outlive the returned future.
+   *
+   * @param client The Client to use for the query.
+   * @return The future FeeEstimateResponse containing the fee estimates. It holds the exception execute() would throw,
+   *         if any.
+   */
+  [[nodiscard]] std::future<FeeEstimateResponse> executeAsync(const Client& client);
+
+  /**
+   * Execute many fee estimation queries concurrently on the supplied client's HTTP executor. Queries whose
+   * transactions have the same shape (see Client::setFeeEstimateCacheTtl()) and the same mode and throttle are sent
+   * once, and share the estimate. The Client must outlive the returned futures.
+   *
+   * @param client  The Client to use for the queries.
+   * @param queries The queries to execute. Their transactions are frozen if they aren't already.
+   * @return The future FeeEstimateResponses, in the same order as the queries. Each holds the exception execute() would
+   *         throw for its query, if any.
+   */
+  [[nodiscard]] static std::vector<std::shared_future<FeeEstimateResponse>> executeAll(
+    const Client& client,
+    std::vector<FeeEstimateQuery>& queries);
+
   /**
    * Set the estimation mode (optional, defaults to INTRINSIC).
    */
@@ -104,22 +134,57 @@ public:
    */
   [[nodiscard]] static FeeEstimateResponse aggregateChunkResponses(const std::vector<FeeEstimateResponse>& chunks);
 
+  /**
+   * Build the fee estimate cache key (the shape) of a transaction: its body without the transaction ID, node account
+   * ID, memo and initial chunk transaction ID (which differ between otherwise identical transactions and don't change
+   * their fees), the number of its signatures, and the mode and throttle of the estimate. Exposed for unit tests.
+   *
+   * @param transaction        The transaction to estimate.
+   * @param mode               The mode of the estimate.
+   * @param highVolumeThrottle The high-volume throttle of the estimate.
+   * @return The shape of the transaction, or an empty string if it can't be parsed.
+   */
+  [[nodiscard]] static std::string makeShapeKey(const proto::Transaction& transaction,
+                                                FeeEstimateMode mode,
+                                                uint16_t highVolumeThrottle);
+
+  /**
+   * Get the amount of time for which an estimate made at a time may be cached: the cache's time-to-live, cut short at
+   * the next hour boundary, when the fee schedule may change. Exposed for unit tests.
+   *
+   * @param cacheTtl The time-to-live of the fee estimate cache.
+   * @param now      The time the estimate is made.
+   * @return The amount of time for which the estimate may be cached.
+   */
+  [[nodiscard]] static std::chrono::system_clock::duration getEstimateTtl(
+    const std::chrono::system_clock::duration& cacheTtl,
+    const std::chrono::system_clock::time_point& now);
+
 private:
   /**
-   * POST the serialized transaction to the mirror node and parse the response. Implements the retry policy.
+   * The state of an estimate that is being made, shared by the attempts that make it.
    */
-  [[nodiscard]] FeeEstimateResponse callGetFeeEstimate(const Client& client, const proto::Transaction& protoTx);
+  struct PendingEstimate;
 
   /**
-   * Estimate fees for a single (non-chunked) transaction.
+   * Validate this query, freeze and serialize its transaction (each of its chunks, for chunked transactions), and get
+   * the state of an estimate of it ready to be made.
+   *
+   * @param client The Client to use for the query.
+   * @return The state of the estimate.
+   * @throws std::invalid_argument If no transaction has been set.
+   * @throws IllegalStateException If the mirror network is unset.
    */
-  [[nodiscard]] FeeEstimateResponse estimateSingleTransaction(const Client& client);
+  [[nodiscard]] std::shared_ptr<PendingEstimate> prepareEstimate(const Client& client);
 
   /**
-   * Estimate fees for each chunk of a chunked transaction and aggregate the results.
+   * Make attempts at an estimate, answering chunks from the Client's fee estimate cache where possible, until it's
+   * made, fails, or has to back off before retrying. A blocking estimate sleeps through the backoff; otherwise the retry
+   * is delayed on the Client's HTTP executor. The estimate's promise is fulfilled once it's made, fails, or is dropped.
+   *
+   * @param estimate The state of the estimate.
    */
-  [[nodiscard]] FeeEstimateResponse estimateChunkedTransaction(const Client& client,
-                                                               std::vector<proto::Transaction> chunkProtos);
+  static void runEstimate(const std::shared_ptr<PendingEstimate>& estimate);
 
   FeeEstimateMode mMode = FeeEstimateMode::INTRINSIC;
 
@@ -127,8 +192,6 @@ private:
 
   uint16_t mHighVolumeThrottle = 0;
 
-  uint64_t mAttempt = 0;
-
   uint64_t mMaxAttempts = DEFAULT_MAX_ATTEMPTS;
 };
 
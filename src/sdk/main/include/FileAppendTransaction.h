@@ -6,6 +6,8 @@
 #include "FileId.h"
 
 #include <cstddef>
+#include <istream>
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -73,6 +75,26 @@ public:
   FileAppendTransaction& setContents(const std::vector<std::byte>& contents);
   FileAppendTransaction& setContents(std::string_view contents);
 
+  /**
+   * Set the contents to append without copying them. They are shared with this FileAppendTransaction and any copies of
+   * it, so they must not be modified afterwards.
+   *
+   * @param contents The contents to append.
+   * @return A reference to this FileAppendTransaction object with the newly-set contents.
+   * @throws IllegalStateException If this FileAppendTransaction is frozen.
+   */
+  FileAppendTransaction& setContents(std::shared_ptr<const std::vector<std::byte>> contents);
+
+  /**
+   * Set the contents to append by reading the rest of an input stream, such as a file stream. The stream is read
+   * directly into the buffer this FileAppendTransaction keeps its contents in, without any intermediate copies.
+   *
+   * @param contents The stream from which to read the contents to append.
+   * @return A reference to this FileAppendTransaction object with the newly-set contents.
+   * @throws IllegalStateException If this FileAppendTransaction is frozen.
+   */
+  FileAppendTransaction& setContents(std::istream& contents);
+
   /**
    * Get the ID of the file to which to append.
    *
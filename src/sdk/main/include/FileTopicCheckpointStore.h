@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_FILE_TOPIC_CHECKPOINT_STORE_H_
+#define HIERO_SDK_CPP_FILE_TOPIC_CHECKPOINT_STORE_H_
+
+#include "TopicCheckpointStore.h"
+#include "TopicId.h"
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Hiero
+{
+/**
+ * A TopicCheckpointStore that keeps checkpoints in a text file, one topic per line. Saved checkpoints are held in
+ * memory and only written when flushed. The file is replaced atomically (written to a temporary file which is then
+ * renamed), so a crash while flushing leaves the previous checkpoints intact.
+ */
+class FileTopicCheckpointStore : public TopicCheckpointStore
+{
+public:
+  /**
+   * Construct with the path of the checkpoint file, and read any checkpoints it already holds.
+   *
+   * @param path The path of the checkpoint file. It doesn't need to exist yet.
+   * @throws std::invalid_argument If the checkpoint file exists but can't be parsed.
+   */
+  explicit FileTopicCheckpointStore(std::string_view path);
+
+  /**
+   * Derived from TopicCheckpointStore. Get the stored checkpoint of a topic.
+   *
+   * @param topicId The ID of the topic of which to get the checkpoint.
+   * @return The checkpoint of the topic, or an uninitialized optional if no checkpoint is stored for it.
+   */
+  [[nodiscard]] std::optional<std::chrono::system_clock::time_point> load(const TopicId& topicId) override;
+
+  /**
+   * Derived from TopicCheckpointStore. Store the checkpoint of a topic in memory until the next flush.
+   *
+   * @param topicId    The ID of the topic of which to store the checkpoint.
+   * @param checkpoint The checkpoint to store.
+   */
+  void save(const TopicId& topicId, const std::chrono::system_clock::time_point& checkpoint) override;
+
+  /**
+   * Derived from TopicCheckpointStore. Write every checkpoint to the checkpoint file, if any changed since the last
+   * flush.
+   *
+   * @throws std::runtime_error If the checkpoint file can't be written.
+   */
+  void flush() override;
+
+  /**
+   * Get the path of the checkpoint file.
+   *
+   * @return The path of the checkpoint file.
+   */
+  [[nodiscard]] inline std::string getPath() const { return mPath; }
+
+private:
+  /**
+   * The path of the checkpoint file.
+   */
+  std::string mPath;
+
+  /**
+   * The checkpoint of each topic.
+   */
+  std::unordered_map<TopicId, std::chrono::system_clock::time_point> mCheckpoints;
+
+  /**
+   * Has a checkpoint been saved since the last flush?
+   */
+  bool mDirty = false;
+
+  /**
+   * The mutex guarding the checkpoints.
+   */
+  std::mutex mMutex;
+
+  /**
+   * The mutex serializing flushes, so that an older snapshot of the checkpoints never overwrites a newer one.
+   */
+  std::mutex mFlushMutex;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_FILE_TOPIC_CHECKPOINT_STORE_H_
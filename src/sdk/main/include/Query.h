@@ -39,6 +39,23 @@ template<typename SdkRequestType, typename SdkResponseType>
 class Query : public Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>
 {
 public:
+  using Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::execute;
+
+  /**
+   * Derived from Executable. Submit this Query to a Hiero network with a specific timeout. A paid Query that paid a
+   * cached or prepaid cost (see Client::setQueryCostCacheTtl() and Client::setPrepayQueries()) which turned out too
+   * low asks for its cost and is submitted again.
+   *
+   * @param client  The Client to use to submit this Query.
+   * @param timeout The desired timeout for the execution of this Query.
+   * @return The SdkResponseType object sent from the Hiero network that contains the result of the request.
+   * @throws MaxAttemptsExceededException     If this Query attempts to execute past the number of allowable attempts.
+   * @throws MaxQueryPaymentExceededException If the cost of this Query is larger than its maximum payment.
+   * @throws PrecheckStatusException          If this Query fails its pre-check.
+   * @throws UninitializedException           If the input Client has not yet been initialized.
+   */
+  SdkResponseType execute(const Client& client, const std::chrono::system_clock::duration& timeout) override;
+
   /**
    * Get the expected cost of this Query.
    *
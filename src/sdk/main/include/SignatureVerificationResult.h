@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_SIGNATURE_VERIFICATION_RESULT_H_
+#define HIERO_SDK_CPP_SIGNATURE_VERIFICATION_RESULT_H_
+
+#include "AccountId.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Hiero
+{
+class PublicKey;
+}
+
+namespace Hiero
+{
+/**
+ * The outcome of verifying a single SignaturePair contained in a Transaction's signature map.
+ */
+struct SignatureVerificationResult
+{
+  /**
+   * The account ID of the node to which the signed Transaction protobuf object is addressed.
+   */
+  AccountId mNodeAccountId;
+
+  /**
+   * The chunk of the Transaction to which the signature belongs. This is always 0 for non-chunked Transactions.
+   */
+  unsigned int mChunk = 0U;
+
+  /**
+   * The PublicKey referenced by the signature's public key prefix. This will be nullptr if a PublicKey could not be
+   * realized from the prefix (e.g. the prefix was truncated or the key type is unsupported).
+   */
+  std::shared_ptr<PublicKey> mPublicKey = nullptr;
+
+  /**
+   * The raw signature bytes.
+   */
+  std::vector<std::byte> mSignature;
+
+  /**
+   * \c TRUE if the signature is a valid signature of the Transaction body by mPublicKey, otherwise \c FALSE.
+   */
+  bool mIsValid = false;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_SIGNATURE_VERIFICATION_RESULT_H_
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_TOPIC_CHECKPOINT_STORE_H_
+#define HIERO_SDK_CPP_TOPIC_CHECKPOINT_STORE_H_
+
+#include "TopicId.h"
+
+#include <chrono>
+#include <optional>
+
+namespace Hiero
+{
+/**
+ * Persistent storage for the checkpoints of topic subscriptions. A checkpoint is the consensus timestamp up to which
+ * every message of a topic has been delivered, from which a subscription can be resumed after a restart.
+ * Implementations must be safe to call from multiple threads.
+ */
+class TopicCheckpointStore
+{
+public:
+  virtual ~TopicCheckpointStore() = default;
+
+  /**
+   * Get the stored checkpoint of a topic.
+   *
+   * @param topicId The ID of the topic of which to get the checkpoint.
+   * @return The checkpoint of the topic, or an uninitialized optional if no checkpoint is stored for it.
+   */
+  [[nodiscard]] virtual std::optional<std::chrono::system_clock::time_point> load(const TopicId& topicId) = 0;
+
+  /**
+   * Store the checkpoint of a topic. The checkpoint may be buffered until flush() is called.
+   *
+   * @param topicId    The ID of the topic of which to store the checkpoint.
+   * @param checkpoint The checkpoint to store.
+   */
+  virtual void save(const TopicId& topicId, const std::chrono::system_clock::time_point& checkpoint) = 0;
+
+  /**
+   * Persist every checkpoint that has been saved.
+   */
+  virtual void flush() = 0;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_TOPIC_CHECKPOINT_STORE_H_
@@ -2,12 +2,14 @@
 #ifndef HIERO_SDK_CPP_TOPIC_MESSAGE_H_
 #define HIERO_SDK_CPP_TOPIC_MESSAGE_H_
 
+#include "ByteView.h"
 #include "TopicMessageChunk.h"
 #include "TransactionId.h"
 
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace com::hedera::mirror::api::proto
@@ -19,6 +21,11 @@ namespace Hiero
 {
 /**
  * The message of a topic.
+ *
+ * A TopicMessage either owns copies of its contents, running hash and chunks, or is a view that holds a
+ * reference-counted handle to the ConsensusTopicResponse protobuf objects it was created from (see viewOf()). The
+ * contents, running hash and chunks members of a view are left empty; getContents(), getRunningHash() and getChunks()
+ * work for both, and materialize() turns a view into a TopicMessage that owns its data.
  */
 class TopicMessage
 {
@@ -60,6 +67,63 @@ public:
   [[nodiscard]] static TopicMessage ofMany(
     const std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>& protos);
 
+  /**
+   * Create a TopicMessage that views the ConsensusTopicResponse protobuf objects of its chunks instead of copying from
+   * them. The contents of a message with a single chunk are viewed in place; the contents of a message with several
+   * chunks are concatenated once into a buffer shared by every copy of the TopicMessage.
+   *
+   * @param protos The ConsensusTopicResponse protobuf objects from which to create a TopicMessage, in chunk order.
+   * @return The constructed TopicMessage view.
+   * @throws std::invalid_argument If there are no ConsensusTopicResponse protobuf objects.
+   */
+  [[nodiscard]] static TopicMessage viewOf(
+    std::shared_ptr<const std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>> protos);
+
+  /**
+   * Copy the contents, running hash and chunks of this TopicMessage out of the protobuf objects it views, and release
+   * them. Does nothing if this TopicMessage isn't a view.
+   *
+   * @return A reference to this TopicMessage, which now owns its data.
+   */
+  TopicMessage& materialize();
+
+  /**
+   * Determine if this TopicMessage is a view of the protobuf objects it was created from.
+   *
+   * @return \c TRUE if this TopicMessage is a view, otherwise \c FALSE.
+   */
+  [[nodiscard]] inline bool isView() const { return mProtos != nullptr; }
+
+  /**
+   * Get the contents of this TopicMessage. The returned ByteView is valid as long as this TopicMessage is neither
+   * modified nor destroyed.
+   *
+   * @return The contents of this TopicMessage.
+   */
+  [[nodiscard]] ByteView getContents() const;
+
+  /**
+   * Get the running hash of the topic that received this TopicMessage. The returned ByteView is valid as long as this
+   * TopicMessage is neither modified nor destroyed.
+   *
+   * @return The running hash of the topic that received this TopicMessage.
+   */
+  [[nodiscard]] ByteView getRunningHash() const;
+
+  /**
+   * Get the number of chunks of this TopicMessage.
+   *
+   * @return The number of chunks of this TopicMessage.
+   */
+  [[nodiscard]] size_t getChunkCount() const;
+
+  /**
+   * Get the chunks of this TopicMessage. The chunks of a view are built from its protobuf objects on each call.
+   *
+   * @return The chunks of this TopicMessage.
+   */
+  [[nodiscard]] std::vector<TopicMessageChunk> getChunks() const;
+
   /**
    * The consensus timestamp of the full TopicMessage.
    */
@@ -89,6 +153,17 @@ public:
    * The ID of the corresponding transaction.
    */
   TransactionId mTransactionId;
+
+private:
+  /**
+   * The protobuf objects of this TopicMessage's chunks, in chunk order, if this TopicMessage is a view.
+   */
+  std::shared_ptr<const std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>> mProtos;
+
+  /**
+   * The concatenated contents of a view with several chunks.
+   */
+  std::shared_ptr<const std::vector<std::byte>> mSharedContents;
 };
 
 } // namespace Hiero
@@ -3,9 +3,11 @@
 #define HIERO_SDK_CPP_TOPIC_MESSAGE_QUERY_H_
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace grpc
 {
@@ -18,6 +20,7 @@ class Client;
 class SubscriptionHandle;
 class TopicId;
 class TopicMessage;
+class TransactionId;
 }
 
 namespace Hiero
@@ -29,6 +32,25 @@ namespace Hiero
 class TopicMessageQuery
 {
 public:
+  /**
+   * What a subscription should do when a message is received while its delivery queue is full.
+   */
+  enum class OverflowPolicy
+  {
+    /**
+     * Stop reading from the mirror node until the queue has room. The mirror node stream is held back by flow control.
+     */
+    BLOCK,
+    /**
+     * Drop the oldest queued message to make room.
+     */
+    DROP_OLDEST,
+    /**
+     * End the subscription, reporting a RESOURCE_EXHAUSTED status to the error handler.
+     */
+    FAIL
+  };
+
   TopicMessageQuery();
   ~TopicMessageQuery();
 
@@ -50,6 +72,19 @@ public:
   std::shared_ptr<SubscriptionHandle> subscribe(const Client& client,
                                                 const std::function<void(const TopicMessage&)>& onNext);
 
+  /**
+   * Subscribe to messages sent on this topic ID set in this TopicMessageQuery, receiving them in batches. A batch is
+   * delivered once it reaches the maximum batch size, or once the maximum batch delay has passed since its first
+   * message was received.
+   *
+   * @param client      The Client to use which contains the correct network to subscribe.
+   * @param onNextBatch The function to call with each batch of received messages.
+   * @return The SubscriptionHandle for this TopicMessageQuery.
+   */
+  std::shared_ptr<SubscriptionHandle> subscribeInBatches(
+    const Client& client,
+    const std::function<void(const std::vector<TopicMessage>&)>& onNextBatch);
+
   /**
    * Set the ID of the topic from which to get messages.
    *
@@ -122,6 +157,92 @@ public:
    */
   TopicMessageQuery& setCompletionHandler(const std::function<void(void)>& func);
 
+  /**
+   * Set the maximum number of message bytes to hold for partially-received multi-chunk messages. When exceeded, the
+   * oldest partial messages are dropped.
+   *
+   * @param bytes The maximum number of message bytes to hold for partially-received multi-chunk messages.
+   * @return A reference to this TopicMessageQuery object with the newly-set maximum.
+   */
+  TopicMessageQuery& setMaxPendingChunkBytes(size_t bytes);
+
+  /**
+   * Set the maximum amount of consensus time to wait for the rest of a multi-chunk message. A partial message is
+   * dropped once a chunk is received whose consensus timestamp is this much later than that of its first chunk.
+   *
+   * @param age The maximum amount of consensus time to wait for the rest of a multi-chunk message.
+   * @return A reference to this TopicMessageQuery object with the newly-set maximum age.
+   */
+  TopicMessageQuery& setMaxPendingChunkAge(const std::chrono::system_clock::duration& age);
+
+  /**
+   * Set the function to run when a partially-received multi-chunk message is dropped. It is passed the ID of the
+   * message's first transaction, the number of chunks that were received, and the total number of chunks.
+   *
+   * @param func The function to run when a partially-received multi-chunk message is dropped.
+   * @return A reference to this TopicMessageQuery object with the newly-set incomplete message handler.
+   */
+  TopicMessageQuery& setIncompleteMessageHandler(
+    const std::function<void(const TransactionId&, uint64_t, uint64_t)>& func);
+
+  /**
+   * Set the function to run with the subscription's checkpoint each time messages are delivered. Every message that
+   * reached consensus at or before the checkpoint has been delivered (other than dropped multi-chunk messages), so a
+   * later subscription can start just after the checkpoint without missing any messages. It is called on the same
+   * thread as the message callback, right after it returns.
+   *
+   * @param func The function to run with the subscription's checkpoint.
+   * @return A reference to this TopicMessageQuery object with the newly-set checkpoint handler.
+   */
+  TopicMessageQuery& setCheckpointHandler(
+    const std::function<void(const std::chrono::system_clock::time_point&)>& func);
+
+  /**
+   * Set the maximum number of received messages that can wait to be delivered. 0 (the default) means the delivery queue
+   * is unbounded.
+   *
+   * @param messages The maximum number of received messages that can wait to be delivered.
+   * @return A reference to this TopicMessageQuery object with the newly-set maximum.
+   */
+  TopicMessageQuery& setMaxQueuedMessages(size_t messages);
+
+  /**
+   * Set what to do when a message is received while the delivery queue is full.
+   *
+   * @param policy The policy to apply when the delivery queue is full.
+   * @return A reference to this TopicMessageQuery object with the newly-set overflow policy.
+   */
+  TopicMessageQuery& setOverflowPolicy(OverflowPolicy policy);
+
+  /**
+   * Set the maximum number of messages delivered in one batch by subscribeInBatches().
+   *
+   * @param messages The maximum number of messages delivered in one batch.
+   * @return A reference to this TopicMessageQuery object with the newly-set maximum batch size.
+   * @throws std::invalid_argument If the maximum batch size is 0.
+   */
+  TopicMessageQuery& setMaxBatchSize(size_t messages);
+
+  /**
+   * Set the maximum amount of time subscribeInBatches() waits for a batch to fill up before delivering it.
+   *
+   * @param delay The maximum amount of time to wait for a batch to fill up.
+   * @return A reference to this TopicMessageQuery object with the newly-set maximum batch delay.
+   * @throws std::invalid_argument If the delay is negative.
+   */
+  TopicMessageQuery& setMaxBatchDelay(const std::chrono::system_clock::duration& delay);
+
+  /**
+   * Set whether messages should be delivered as views of the protobuf objects received from the mirror node (see
+   * TopicMessage::viewOf()) instead of as copies. Views avoid copying each message's contents, running hash and chunks;
+   * consumers must then read them through TopicMessage's getters, or call TopicMessage::materialize() on messages they
+   * need to own.
+   *
+   * @param views \c TRUE to deliver messages as views, \c FALSE to deliver them as copies.
+   * @return A reference to this TopicMessageQuery object with the newly-set view delivery.
+   */
+  TopicMessageQuery& setDeliverViews(bool views);
+
   /**
    * Get the ID of the topic from which to get messages.
    *
@@ -164,6 +285,69 @@ public:
    */
   [[nodiscard]] std::chrono::system_clock::duration getMaxBackoff() const;
 
+  /**
+   * Get the function run after an error to determine if a retry should occur.
+   *
+   * @return The function run after an error to determine if a retry should occur.
+   */
+  [[nodiscard]] std::function<bool(grpc::Status)> getRetryHandler() const;
+
+  /**
+   * Get the maximum number of message bytes to hold for partially-received multi-chunk messages.
+   *
+   * @return The maximum number of message bytes to hold for partially-received multi-chunk messages.
+   */
+  [[nodiscard]] size_t getMaxPendingChunkBytes() const;
+
+  /**
+   * Get the maximum amount of consensus time to wait for the rest of a multi-chunk message.
+   *
+   * @return The maximum amount of consensus time to wait for the rest of a multi-chunk message.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getMaxPendingChunkAge() const;
+
+  /**
+   * Get the function run when a partially-received multi-chunk message is dropped.
+   *
+   * @return The function run when a partially-received multi-chunk message is dropped. Empty if none was set.
+   */
+  [[nodiscard]] std::function<void(const TransactionId&, uint64_t, uint64_t)> getIncompleteMessageHandler() const;
+
+  /**
+   * Get the maximum number of received messages that can wait to be delivered.
+   *
+   * @return The maximum number of received messages that can wait to be delivered. 0 means unbounded.
+   */
+  [[nodiscard]] size_t getMaxQueuedMessages() const;
+
+  /**
+   * Get what to do when a message is received while the delivery queue is full.
+   *
+   * @return The policy to apply when the delivery queue is full.
+   */
+  [[nodiscard]] OverflowPolicy getOverflowPolicy() const;
+
+  /**
+   * Get the maximum number of messages delivered in one batch by subscribeInBatches().
+   *
+   * @return The maximum number of messages delivered in one batch.
+   */
+  [[nodiscard]] size_t getMaxBatchSize() const;
+
+  /**
+   * Get the maximum amount of time subscribeInBatches() waits for a batch to fill up before delivering it.
+   *
+   * @return The maximum amount of time to wait for a batch to fill up.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getMaxBatchDelay() const;
+
+  /**
+   * Get whether messages are delivered as views of the protobuf objects received from the mirror node.
+   *
+   * @return \c TRUE if messages are delivered as views, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool getDeliverViews() const;
+
 private:
   /**
    * Implementation object used to hide implementation details and internal headers.
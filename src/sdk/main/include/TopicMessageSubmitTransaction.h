@@ -8,6 +8,7 @@
 #include "TransactionId.h"
 
 #include <cstddef>
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -70,6 +71,16 @@ public:
   TopicMessageSubmitTransaction& setMessage(const std::vector<std::byte>& message);
   TopicMessageSubmitTransaction& setMessage(std::string_view message);
 
+  /**
+   * Set the message to submit without copying it. The message is shared with this TopicMessageSubmitTransaction and
+   * any copies of it, so it must not be modified afterwards.
+   *
+   * @param message The message to submit.
+   * @return A reference to this TopicMessageSubmitTransaction object with the newly-set message.
+   * @throws IllegalStateException If this TopicMessageSubmitTransaction is frozen.
+   */
+  TopicMessageSubmitTransaction& setMessage(std::shared_ptr<const std::vector<std::byte>> message);
+
   /**
    * Set the maximum custom fees that the user is willing to pay for the transaction.
    *
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_TOPIC_PUBLISHER_H_
+#define HIERO_SDK_CPP_TOPIC_PUBLISHER_H_
+
+#include "TopicId.h"
+#include "TopicMessageSubmitTransaction.h"
+#include "TransactionResponse.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Hiero
+{
+class Client;
+}
+
+namespace Hiero
+{
+/**
+ * A publisher of a high volume of messages to a single topic. Messages are accepted onto a bounded queue and submitted
+ * by a pool of workers, each of which takes a batch of messages off the queue, freezes and signs the batch, and then
+ * submits its messages one at a time. Batching only moves the signing of a batch ahead of its submissions; it doesn't
+ * combine messages into one transaction or submit them concurrently (setMaxInFlight() sets how many messages are
+ * submitted at once). Every submission is built from one prepared TopicMessageSubmitTransaction template, so the
+ * per-message work is limited to setting the message and signing.
+ *
+ * The Client used to construct a TopicPublisher must outlive it. Configuration must be set before the first message is
+ * published.
+ */
+class TopicPublisher
+{
+public:
+  /**
+   * What a TopicPublisher should do with a message that is published while its queue is full.
+   */
+  enum class OverflowPolicy
+  {
+    /**
+     * Block the publishing thread until there is room on the queue.
+     */
+    BLOCK,
+    /**
+     * Drop the message and return immediately.
+     */
+    DROP
+  };
+
+  /**
+   * The result of submitting one published message.
+   */
+  struct PublishResult
+  {
+    /**
+     * The sequence number publish() returned for the message.
+     */
+    uint64_t mSequence = 0ULL;
+
+    /**
+     * The response of the submission. Only set if the submission was successful.
+     */
+    std::optional<TransactionResponse> mResponse;
+
+    /**
+     * The exception thrown while submitting the message. Only set if the submission failed.
+     */
+    std::exception_ptr mError;
+  };
+
+  /**
+   * A snapshot of the statistics of a TopicPublisher.
+   */
+  struct Statistics
+  {
+    /**
+     * The number of messages that have been successfully submitted.
+     */
+    uint64_t mPublished = 0ULL;
+
+    /**
+     * The number of messages whose submission failed.
+     */
+    uint64_t mFailed = 0ULL;
+
+    /**
+     * The number of messages that were dropped because the queue was full.
+     */
+    uint64_t mDropped = 0ULL;
+
+    /**
+     * The number of messages waiting on the queue.
+     */
+    size_t mQueued = 0ULL;
+
+    /**
+     * The number of messages successfully submitted per second since the first message was published.
+     */
+    double mMessagesPerSecond = 0.0;
+  };
+
+  /**
+   * Construct with the Client to use to submit messages and the ID of the topic to which to publish.
+   *
+   * @param client  The Client to use to submit messages. It must outlive this TopicPublisher.
+   * @param topicId The ID of the topic to which to publish.
+   */
+  TopicPublisher(const Client& client, const TopicId& topicId);
+
+  /**
+   * Closes this TopicPublisher, waiting for all queued messages to be submitted.
+   */
+  ~TopicPublisher();
+
+  /**
+   * Disallow copying and moving, as the workers of a TopicPublisher refer to it.
+   */
+  TopicPublisher(const TopicPublisher&) = delete;
+  TopicPublisher& operator=(const TopicPublisher&) = delete;
+  TopicPublisher(TopicPublisher&&) = delete;
+  TopicPublisher& operator=(TopicPublisher&&) = delete;
+
+  /**
+   * Publish a message to the topic. The message is queued and submitted asynchronously; its result is reported to the
+   * result handler.
+   *
+   * @param message The message to publish.
+   * @return The sequence number of the message, or an uninitialized optional if the message was dropped.
+   * @throws IllegalStateException If this TopicPublisher is closed.
+   */
+  std::optional<uint64_t> publish(const std::vector<std::byte>& message);
+
+  /**
+   * Publish a message to the topic. The message is queued and submitted asynchronously; its result is reported to the
+   * result handler.
+   *
+   * @param message The message to publish.
+   * @return The sequence number of the message, or an uninitialized optional if the message was dropped.
+   * @throws IllegalStateException If this TopicPublisher is closed.
+   */
+  std::optional<uint64_t> publish(std::string_view message);
+
+  /**
+   * Block until every message published so far has been submitted.
+   *
+   * @throws IllegalStateException If called from the result handler.
+   */
+  void flush();
+
+  /**
+   * Stop accepting messages, wait for every queued message to be submitted, and stop the workers. Closing a closed
+   * TopicPublisher does nothing.
+   *
+   * @throws IllegalStateException If called from the result handler.
+   */
+  void close();
+
+  /**
+   * Set the TopicMessageSubmitTransaction from which every submission is built. This can be used to set a memo, maximum
+   * transaction fee, node account IDs, custom fee limits, etc. that should apply to every message. The template's topic
+   * ID is overwritten with this TopicPublisher's topic ID, and its message is ignored.
+   *
+   * @param transaction The TopicMessageSubmitTransaction from which every submission should be built.
+   * @return A reference to this TopicPublisher with the newly-set template.
+   * @throws IllegalStateException If a message has already been published.
+   */
+  TopicPublisher& setTransactionTemplate(const TopicMessageSubmitTransaction& transaction);
+
+  /**
+   * Set the maximum number of messages that can wait on the queue.
+   *
+   * @param capacity The maximum number of messages that can wait on the queue.
+   * @return A reference to this TopicPublisher with the newly-set queue capacity.
+   * @throws std::invalid_argument If the capacity is 0.
+   * @throws IllegalStateException If a message has already been published.
+   */
+  TopicPublisher& setQueueCapacity(size_t capacity);
+
+  /**
+   * Set what to do with a message that is published while the queue is full.
+   *
+   * @param policy The policy to apply when the queue is full.
+   * @return A reference to this TopicPublisher with the newly-set overflow policy.
+   * @throws IllegalStateException If a message has already been published.
+   */
+  TopicPublisher& setOverflowPolicy(OverflowPolicy policy);
+
+  /**
+   * Set the maximum number of messages that can be submitted at the same time. This is the number of workers.
+   *
+   * @param maxInFlight The maximum number of messages that can be submitted at the same time.
+   * @return A reference to this TopicPublisher with the newly-set maximum.
+   * @throws std::invalid_argument If the maximum is 0.
+   * @throws IllegalStateException If a message has already been published.
+   */
+  TopicPublisher& setMaxInFlight(unsigned int maxInFlight);
+
+  /**
+   * Set the maximum number of messages a worker takes off the queue and signs at a time.
+   *
+   * @param batchSize The maximum number of messages a worker takes off the queue at a time.
+   * @return A reference to this TopicPublisher with the newly-set batch size.
+   * @throws std::invalid_argument If the batch size is 0.
+   * @throws IllegalStateException If a message has already been published.
+   */
+  TopicPublisher& setBatchSize(unsigned int batchSize);
+
+  /**
+   * Set the function to run with the result of each submitted message. It is called from the worker threads, and the
+   * worker that calls it submits no other message until it returns. It may publish(): a message it publishes while the
+   * queue is full is queued over capacity under the BLOCK policy rather than waiting for the workers, which would never
+   * make room. It must not flush() or close() this TopicPublisher, which would wait for its own worker. An exception it
+   * throws is logged with the Client's logger and otherwise ignored.
+   *
+   * @param func The function to run with the result of each submitted message.
+   * @return A reference to this TopicPublisher with the newly-set result handler.
+   * @throws IllegalStateException If a message has already been published.
+   */
+  TopicPublisher& setResultHandler(const std::function<void(const PublishResult&)>& func);
+
+  /**
+   * Get the ID of the topic to which this TopicPublisher publishes.
+   *
+   * @return The ID of the topic to which this TopicPublisher publishes.
+   */
+  [[nodiscard]] TopicId getTopicId() const;
+
+  /**
+   * Get the maximum number of messages that can wait on the queue.
+   *
+   * @return The maximum number of messages that can wait on the queue.
+   */
+  [[nodiscard]] size_t getQueueCapacity() const;
+
+  /**
+   * Get what to do with a message that is published while the queue is full.
+   *
+   * @return The policy to apply when the queue is full.
+   */
+  [[nodiscard]] OverflowPolicy getOverflowPolicy() const;
+
+  /**
+   * Get the maximum number of messages that can be submitted at the same time.
+   *
+   * @return The maximum number of messages that can be submitted at the same time.
+   */
+  [[nodiscard]] unsigned int getMaxInFlight() const;
+
+  /**
+   * Get the maximum number of messages a worker takes off the queue and signs at a time.
+   *
+   * @return The maximum number of messages a worker takes off the queue at a time.
+   */
+  [[nodiscard]] unsigned int getBatchSize() const;
+
+  /**
+   * Get a snapshot of the statistics of this TopicPublisher.
+   *
+   * @return A snapshot of the statistics of this TopicPublisher.
+   */
+  [[nodiscard]] Statistics getStatistics() const;
+
+private:
+  /**
+   * Implementation object used to hide implementation details and internal headers.
+   */
+  struct TopicPublisherImpl;
+  std::unique_ptr<TopicPublisherImpl> mImpl;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_TOPIC_PUBLISHER_H_
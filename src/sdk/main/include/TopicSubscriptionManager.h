@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_TOPIC_SUBSCRIPTION_MANAGER_H_
+#define HIERO_SDK_CPP_TOPIC_SUBSCRIPTION_MANAGER_H_
+
+#include "TopicId.h"
+#include "TopicMessageQuery.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace grpc
+{
+class Status;
+}
+
+namespace Hiero
+{
+class Client;
+class TopicCheckpointStore;
+class TopicMessage;
+}
+
+namespace Hiero
+{
+/**
+ * A manager of subscriptions to many topics. Every topic is subscribed with the same TopicMessageQuery template, and
+ * the subscriptions share the Client's subscription reactor and are spread across the mirror nodes of its mirror
+ * network.
+ *
+ * The checkpoint of each topic (the consensus timestamp up to which its messages have been delivered) is saved to a
+ * TopicCheckpointStore after each delivery, and the store is flushed periodically and when the manager is closed. A
+ * topic that has a stored checkpoint is subscribed from just after it, so a restarted process neither replays messages
+ * it already handled nor misses the ones that reached consensus while it was down. Messages delivered after the last
+ * flush are delivered again after a restart.
+ *
+ * A TopicSubscriptionManager holds a reference to the Client used to construct it, and its subscriptions run on that
+ * Client's subscription reactor, so the Client must outlive it. Close (or destroy) the manager before closing or
+ * destroying the Client.
+ */
+class TopicSubscriptionManager
+{
+public:
+  /**
+   * Construct with the Client to use to subscribe and the store in which to keep checkpoints.
+   *
+   * @param client The Client to use to subscribe. It must outlive this TopicSubscriptionManager.
+   * @param store  The store in which to keep checkpoints.
+   * @throws std::invalid_argument If the store is null.
+   */
+  TopicSubscriptionManager(const Client& client, std::shared_ptr<TopicCheckpointStore> store);
+
+  /**
+   * Closes this TopicSubscriptionManager, ignoring any failure to flush the checkpoint store.
+   */
+  ~TopicSubscriptionManager();
+
+  /**
+   * Disallow copying and moving, as the checkpoint flushing thread of a TopicSubscriptionManager refers to it.
+   */
+  TopicSubscriptionManager(const TopicSubscriptionManager&) = delete;
+  TopicSubscriptionManager& operator=(const TopicSubscriptionManager&) = delete;
+  TopicSubscriptionManager(TopicSubscriptionManager&&) = delete;
+  TopicSubscriptionManager& operator=(TopicSubscriptionManager&&) = delete;
+
+  /**
+   * Subscribe to a topic, starting just after its stored checkpoint if it has one, or at the query template's start
+   * time if it doesn't.
+   *
+   * @param topicId The ID of the topic to which to subscribe.
+   * @param onNext  The function to call when a message is received.
+   * @throws IllegalStateException If this TopicSubscriptionManager is closed or already subscribed to the topic.
+   */
+  void subscribe(const TopicId& topicId, const std::function<void(const TopicMessage&)>& onNext);
+
+  /**
+   * Unsubscribe from a topic. Its checkpoint is kept, so subscribing to it again resumes where it stopped.
+   * Unsubscribing from a topic that isn't subscribed does nothing.
+   *
+   * @param topicId The ID of the topic from which to unsubscribe.
+   */
+  void unsubscribe(const TopicId& topicId);
+
+  /**
+   * Flush the checkpoint store.
+   *
+   * @throws std::runtime_error If the checkpoint store fails to flush.
+   */
+  void flushCheckpoints();
+
+  /**
+   * Unsubscribe from every topic, stop flushing periodically, and flush the checkpoint store. Closing a closed
+   * TopicSubscriptionManager does nothing.
+   *
+   * @throws std::runtime_error If the checkpoint store fails to flush.
+   */
+  void close();
+
+  /**
+   * Set the TopicMessageQuery from which every subscription is built. This can be used to set the retry policy,
+   * delivery queue, start time (for topics without a checkpoint), etc. of every subscription. The template's retry
+   * handler and incomplete message handler are kept for every subscription, but its topic ID, error handler, completion
+   * handler and checkpoint handler are overwritten for each subscription.
+   *
+   * @param query The TopicMessageQuery from which every subscription should be built.
+   * @return A reference to this TopicSubscriptionManager with the newly-set template.
+   */
+  TopicSubscriptionManager& setQueryTemplate(const TopicMessageQuery& query);
+
+  /**
+   * Set the amount of time between periodic flushes of the checkpoint store. Zero disables periodic flushing.
+   *
+   * @param interval The amount of time between periodic flushes of the checkpoint store.
+   * @return A reference to this TopicSubscriptionManager with the newly-set checkpoint interval.
+   * @throws std::invalid_argument If the interval is negative.
+   */
+  TopicSubscriptionManager& setCheckpointInterval(const std::chrono::system_clock::duration& interval);
+
+  /**
+   * Set the function to run when the subscription to a topic fails. The topic is no longer subscribed when this is
+   * called; subscribing to it again resumes from its checkpoint.
+   *
+   * @param func The function to run when the subscription to a topic fails.
+   * @return A reference to this TopicSubscriptionManager with the newly-set error handler.
+   */
+  TopicSubscriptionManager& setErrorHandler(const std::function<void(const TopicId&, grpc::Status)>& func);
+
+  /**
+   * Get the TopicMessageQuery from which every subscription is built, with its retry and incomplete message handlers.
+   *
+   * @return The TopicMessageQuery from which every subscription is built.
+   */
+  [[nodiscard]] TopicMessageQuery getQueryTemplate() const;
+
+  /**
+   * Get the amount of time between periodic flushes of the checkpoint store.
+   *
+   * @return The amount of time between periodic flushes of the checkpoint store.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getCheckpointInterval() const;
+
+  /**
+   * Get the IDs of the topics that are currently subscribed.
+   *
+   * @return The IDs of the topics that are currently subscribed.
+   */
+  [[nodiscard]] std::vector<TopicId> getTopics() const;
+
+private:
+  /**
+   * Implementation object used to hide implementation details and internal headers.
+   */
+  struct TopicSubscriptionManagerImpl;
+  std::unique_ptr<TopicSubscriptionManagerImpl> mImpl;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_TOPIC_SUBSCRIPTION_MANAGER_H_
@@ -5,12 +5,15 @@
 #include "AccountId.h"
 #include "Executable.h"
 #include "Hbar.h"
+#include "SignatureVerificationResult.h"
 #include "TransactionId.h"
 
 #include <chrono>
 #include <functional>
+#include <istream>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <utility>
 #include <variant>
@@ -25,6 +28,11 @@ class ScheduleCreateTransaction;
 class WrappedTransaction;
 }
 
+namespace Hiero::internal::SignatureVerifier
+{
+struct SignatureCheck;
+}
+
 namespace proto
 {
 class SchedulableTransactionBody;
@@ -80,6 +88,17 @@ public:
    */
   [[nodiscard]] static WrappedTransaction fromBytes(const std::vector<std::byte>& bytes);
 
+  /**
+   * Construct a Transaction derived class from an input stream, such as a file stream. The stream can contain the same
+   * protobuf encodings as the bytes passed to fromBytes(). A TransactionList is read and validated one entry at a time,
+   * so a large list of signed transactions never has to be held in memory in its serialized form all at once.
+   *
+   * @param input The stream from which to read the Transaction. It is read until its end.
+   * @return A WrappedTransaction which contains the deserialized Transaction.
+   * @throws std::invalid_argument If unable to construct a Transaction from the stream.
+   */
+  [[nodiscard]] static WrappedTransaction fromBytes(std::istream& input);
+
   /**
    * Construct a representative byte array from this Transaction object.
    *
@@ -87,6 +106,23 @@ public:
    */
   [[nodiscard]] std::vector<std::byte> toBytes() const;
 
+  /**
+   * Serialize this Transaction object into an existing byte array. The bytes are written directly into the output, so
+   * no intermediate copies are made and the output's capacity can be reused across calls.
+   *
+   * @param out The byte array into which to serialize this Transaction object. Its previous contents are replaced.
+   */
+  void toBytes(std::vector<std::byte>& out) const;
+
+  /**
+   * Serialize this Transaction object to an output stream. The bytes are streamed out as they are serialized, so the
+   * full serialized Transaction is never held in memory.
+   *
+   * @param os The output stream to which to write this Transaction object.
+   * @return A reference to the output stream. Its badbit is set if the bytes could not be written.
+   */
+  std::ostream& writeTo(std::ostream& os) const;
+
   /**
    * Sign this Transaction with the given PrivateKey. Signing a Transaction with a key that has already been used to
    * sign will be ignored.
@@ -196,6 +232,16 @@ public:
    */
   std::map<std::shared_ptr<PublicKey>, std::vector<std::vector<std::byte>>> removeAllSignatures();
 
+  /**
+   * Verify every signature contained in this Transaction's signature maps against the body bytes they sign. Each
+   * signature map is read once, the public key of each distinct prefix is realized once, and the signatures are
+   * verified in parallel grouped by key type. Signatures that can't be tied to a PublicKey are reported as invalid.
+   *
+   * @return The verification result of each signature, for each node account ID and chunk.
+   * @throws IllegalStateException If this Transaction is not frozen.
+   */
+  [[nodiscard]] std::vector<SignatureVerificationResult> verifyAllSignatures() const;
+
   /**
    * Freeze this Transaction.
    *
@@ -496,14 +542,22 @@ protected:
    * @param index The index at which to get the Transaction protobuf object.
    * @return The Transaction protobuf object located at the given index.
    */
-  [[nodiscard]] proto::Transaction getTransactionProtobufObject(unsigned int index) const;
+  [[nodiscard]] const proto::Transaction& getTransactionProtobufObject(unsigned int index) const;
 
   /**
    * Get the source TransactionBody protobuf object from which this Transaction constructed itself.
    *
    * @return The source TransactionBody protobuf object from which this Transaction constructed itself.
    */
-  [[nodiscard]] proto::TransactionBody getSourceTransactionBody() const;
+  [[nodiscard]] const proto::TransactionBody& getSourceTransactionBody() const;
+
+  /**
+   * Get a copy of the source TransactionBody protobuf object without its transaction data (the field of its data
+   * oneof). This doesn't copy the data, which for a ChunkedTransaction holds its whole payload.
+   *
+   * @return A copy of the source TransactionBody protobuf object, without its transaction data.
+   */
+  [[nodiscard]] proto::TransactionBody getSourceTransactionBodyWithoutData() const;
 
   /**
    * Get the ID of this Transaction.
@@ -521,9 +575,29 @@ protected:
    */
   void buildTransaction(unsigned int index) const;
 
+  /**
+   * Build all Transaction protobuf objects and collect every signature in their signature maps, paired with the body
+   * bytes it signs, so that it can be verified.
+   *
+   * @return The list of signatures to verify.
+   * @throws IllegalStateException If this Transaction is not frozen.
+   */
+  [[nodiscard]] std::vector<internal::SignatureVerifier::SignatureCheck> getSignatureChecks() const;
+
 private:
   friend class PrivateKey;
 
+  /**
+   * Get the Transaction protobuf objects that make up the TransactionList protobuf object this Transaction serializes
+   * into, building any that haven't been built yet.
+   *
+   * @param unbuiltTransaction The Transaction protobuf object to fill from the source TransactionBody if no nodes have
+   *                           been selected yet. In that case the returned list only points to this object.
+   * @return Pointers to the Transaction protobuf objects to serialize, in order.
+   */
+  [[nodiscard]] std::vector<const proto::Transaction*> getTransactionsToSerialize(
+    proto::Transaction& unbuiltTransaction) const;
+
   /**
    * Build and add the derived Transaction's protobuf representation to the Transaction protobuf object.
    *
@@ -29,6 +29,7 @@
 #include "ScheduleCreateTransaction.h"
 #include "ScheduleDeleteTransaction.h"
 #include "ScheduleSignTransaction.h"
+#include "SignatureVerificationResult.h"
 #include "SystemDeleteTransaction.h"
 #include "SystemUndeleteTransaction.h"
 #include "TokenAirdropTransaction.h"
@@ -59,6 +60,7 @@
 #include "TransferTransaction.h"
 
 #include <variant>
+#include <vector>
 
 namespace proto
 {
@@ -191,6 +193,14 @@ public:
    */
   WrappedTransaction& setTransaction(const AnyPossibleTransaction& transaction);
 
+  /**
+   * Verify every signature contained in the wrapped transaction.
+   *
+   * @return The verification result of each signature, for each node account ID and chunk.
+   * @throws IllegalStateException If the wrapped transaction is not frozen.
+   */
+  [[nodiscard]] std::vector<SignatureVerificationResult> verifyAllSignatures() const;
+
   /**
    * Get the type of wrapped transaction.
    *
@@ -219,12 +229,34 @@ public:
   [[nodiscard]] inline const AnyPossibleTransaction& getVariant() const { return mTransaction; }
 
 private:
+  friend std::vector<std::vector<SignatureVerificationResult>> verifyAllSignatures(
+    const std::vector<WrappedTransaction>& transactions);
+
+  /**
+   * Collect every signature in the wrapped transaction, paired with the body bytes it signs.
+   *
+   * @return The list of signatures to verify.
+   * @throws IllegalStateException If the wrapped transaction is not frozen.
+   */
+  [[nodiscard]] std::vector<internal::SignatureVerifier::SignatureCheck> getSignatureChecks() const;
+
   /**
    * The actual wrapped transaction.
    */
   AnyPossibleTransaction mTransaction;
 };
 
+/**
+ * Verify every signature of many transactions at once. All signatures across all transactions are pooled before being
+ * verified, so that a batch of small transactions is verified with the same parallelism as one large transaction.
+ *
+ * @param transactions The transactions of which to verify the signatures.
+ * @return The verification results of each transaction's signatures, in the same order as the input transactions.
+ * @throws IllegalStateException If any of the transactions is not frozen.
+ */
+[[nodiscard]] std::vector<std::vector<SignatureVerificationResult>> verifyAllSignatures(
+  const std::vector<WrappedTransaction>& transactions);
+
 } // namespace Hiero
 
 #endif // HIERO_SDK_CPP_UNKNOWN_TRANSACTION_H_
@@ -2,16 +2,86 @@
 #ifndef HIERO_SDK_CPP_IMPL_HTTP_CLIENT_H_
 #define HIERO_SDK_CPP_IMPL_HTTP_CLIENT_H_
 
-#ifndef CPPHTTPLIB_OPENSSL_SUPPORT
-#define CPPHTTPLIB_OPENSSL_SUPPORT
-#endif
+#include "Defaults.h"
 
 #include <httplib.h>
+#include <chrono>
+#include <cstddef>
 #include <string>
 #include <string_view>
 
 namespace Hiero::internal::HttpClient
 {
+/**
+ * The settings of the connection pool shared by every request. Connections are pooled per scheme, host and port and
+ * kept alive between requests, so that consecutive requests to the same host skip the TCP and TLS handshakes.
+ */
+struct ConnectionPoolSettings
+{
+  /**
+   * The maximum number of connections open to one host at a time. Requests to a host with this many connections in use
+   * wait for one of them to be released.
+   */
+  unsigned int mMaxConnectionsPerHost = DEFAULT_HTTP_MAX_CONNECTIONS_PER_HOST;
+
+  /**
+   * The amount of time an idle connection is kept open for reuse before it's closed.
+   */
+  std::chrono::system_clock::duration mIdleConnectionTimeout = DEFAULT_HTTP_IDLE_CONNECTION_TIMEOUT;
+
+  /**
+   * The amount of time to wait for a connection to be established.
+   */
+  std::chrono::system_clock::duration mConnectionTimeout = DEFAULT_HTTP_CONNECTION_TIMEOUT;
+
+  /**
+   * The amount of time to wait to read data from a connection.
+   */
+  std::chrono::system_clock::duration mReadTimeout = DEFAULT_HTTP_READ_WRITE_TIMEOUT;
+
+  /**
+   * The amount of time to wait to write data to a connection.
+   */
+  std::chrono::system_clock::duration mWriteTimeout = DEFAULT_HTTP_READ_WRITE_TIMEOUT;
+};
+
+/**
+ * Set the settings of the connection pool. New timeouts apply to requests started afterwards, and a lower maximum
+ * number of connections per host is reached as connections in use are released.
+ *
+ * @param settings The settings of the connection pool.
+ * @throws std::invalid_argument If the maximum number of connections per host is zero, or a timeout is negative.
+ */
+void setConnectionPoolSettings(const ConnectionPoolSettings& settings);
+
+/**
+ * Get the settings of the connection pool.
+ *
+ * @return The settings of the connection pool.
+ */
+[[nodiscard]] ConnectionPoolSettings getConnectionPoolSettings();
+
+/**
+ * Close every idle connection in the connection pool. Connections in use are closed when they're released.
+ */
+void closeIdleConnections();
+
+/**
+ * Get the number of connections in the connection pool open to the scheme, host and port of a URL, idle or in use.
+ *
+ * @param url The URL whose connections to count.
+ * @return The number of connections open to the URL's scheme, host and port.
+ */
+[[nodiscard]] unsigned int getOpenConnections(std::string_view url);
+
+/**
+ * Get the number of hosts (schemes, hosts and ports) with connections open in the connection pool. Hosts are dropped
+ * from the pool once their last connection is closed.
+ *
+ * @return The number of hosts with connections open in the connection pool.
+ */
+[[nodiscard]] size_t getConnectionPoolHostCount();
+
 /**
  * Fetches data from the specified URL using the provided RPC method.
  * @param url       The URL to fetch data from.
@@ -37,12 +107,17 @@ namespace Hiero::internal::HttpClient
 /**
  * Perform an HTTP request and return both the response body and status code, plus a flag
  * indicating whether the failure (if any) was due to a request timeout.
+ *
+ * With compression, the response may be sent gzip- or deflate-encoded and is decoded transparently, and a POST body
+ * of at least DEFAULT_HTTP_REQUEST_COMPRESSION_THRESHOLD bytes is sent gzip-encoded. A host that rejects an encoded
+ * body (with 415 Unsupported Media Type) is sent the body again unencoded, and isn't sent encoded bodies afterwards.
  * @param url         The URL to which to submit the request.
  * @param httpMethod  The HTTP method.
  * @param requestBody The HTTP request body.
  * @param contentType The content type for POST requests.
  * @param statusCode  Output parameter for the HTTP status code (-1 on connection error).
  * @param isTimeout   Output parameter set to true when the failure was a request timeout.
+ * @param compression Should the request and response be compressed?
  * @return The response data as a string.
  */
 [[nodiscard]] std::string invokeRESTWithStatus(std::string_view url,
@@ -50,7 +125,31 @@ namespace Hiero::internal::HttpClient
                                                std::string_view requestBody,
                                                std::string_view contentType,
                                                int& statusCode,
-                                               bool& isTimeout);
+                                               bool& isTimeout,
+                                               bool compression = false);
+
+/**
+ * Perform an HTTP request with extra request headers, and return the response body, status code and headers.
+ * @param url             The URL to which to submit the request.
+ * @param httpMethod      The HTTP method.
+ * @param requestBody     The HTTP request body.
+ * @param contentType     The content type for POST requests.
+ * @param requestHeaders  Extra headers to send with the request (e.g. "If-None-Match").
+ * @param responseHeaders Output parameter for the headers of the response.
+ * @param statusCode      Output parameter for the HTTP status code (-1 on connection error).
+ * @param isTimeout       Output parameter set to true when the failure was a request timeout.
+ * @param compression     Should the request and response be compressed (see invokeRESTWithStatus())?
+ * @return The response data as a string.
+ */
+[[nodiscard]] std::string invokeRESTWithHeaders(std::string_view url,
+                                                std::string_view httpMethod,
+                                                std::string_view requestBody,
+                                                std::string_view contentType,
+                                                const httplib::Headers& requestHeaders,
+                                                httplib::Headers& responseHeaders,
+                                                int& statusCode,
+                                                bool& isTimeout,
+                                                bool compression = false);
 
 } // namespace Hiero::internal
 
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_HTTP_EXECUTOR_H_
+#define HIERO_SDK_CPP_IMPL_HTTP_EXECUTOR_H_
+
+#include "Defaults.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Hiero::internal
+{
+/**
+ * Runs HTTP requests (and tasks made of HTTP requests, such as mirror node queries) asynchronously on a fixed number of
+ * threads, so that many requests can be in flight without a thread each. Every task is tagged with the host it talks
+ * to, and no more than a set number of tasks per host run at a time. Tasks for a host that is at its limit wait in line
+ * without holding a thread, and tasks for other hosts are run in the meantime. Tasks for the same host are started in
+ * the order in which they were posted. Hosts are compared by the keys made by getHost(), which every caller must use to
+ * tag its tasks.
+ *
+ * An HttpExecutor must not be shut down or destroyed from one of its own threads (i.e. from one of its tasks).
+ */
+class HttpExecutor
+{
+public:
+  /**
+   * Construct and start the executor's threads.
+   *
+   * @param threads         The number of threads to run tasks.
+   * @param maxTasksPerHost The maximum number of tasks for one host to run at a time.
+   * @throws std::invalid_argument If either number is zero.
+   */
+  explicit HttpExecutor(unsigned int threads = DEFAULT_HTTP_EXECUTOR_THREADS,
+                        unsigned int maxTasksPerHost = DEFAULT_HTTP_EXECUTOR_MAX_TASKS_PER_HOST);
+
+  /**
+   * Shuts down the executor.
+   */
+  ~HttpExecutor();
+
+  HttpExecutor(const HttpExecutor&) = delete;
+  HttpExecutor& operator=(const HttpExecutor&) = delete;
+  HttpExecutor(HttpExecutor&&) = delete;
+  HttpExecutor& operator=(HttpExecutor&&) = delete;
+
+  /**
+   * Run a task on one of the executor's threads. Exceptions thrown by the task are ignored.
+   *
+   * @param host The key of the host the task talks to (see getHost()). An empty host isn't subject to the per-host
+   *             limit.
+   * @param task The task to run.
+   * @throws IllegalStateException If this executor is shut down.
+   */
+  void post(std::string host, std::function<void()> task);
+
+  /**
+   * Run a task on one of the executor's threads once a deadline passes, or when the executor shuts down if that's
+   * sooner. The task doesn't hold a thread while it waits. Exceptions thrown by the task are ignored.
+   *
+   * @param host     The key of the host the task talks to (see getHost()). An empty host isn't subject to the per-host
+   *                 limit.
+   * @param deadline The time after which to run the task.
+   * @param task     The task to run.
+   * @throws IllegalStateException If this executor is shut down.
+   */
+  void postAfter(std::string host,
+                 const std::chrono::system_clock::time_point& deadline,
+                 std::function<void()> task);
+
+  /**
+   * Run a function on one of the executor's threads and get its result.
+   *
+   * @param host The key of the host the function talks to (see getHost()). An empty host isn't subject to the per-host
+   *             limit.
+   * @param func The function to run.
+   * @return The future result of the function. If the function throws, the future holds the exception.
+   * @throws IllegalStateException If this executor is shut down.
+   */
+  template<typename Func>
+  [[nodiscard]] std::future<std::invoke_result_t<Func>> submit(std::string host, Func func)
+  {
+    auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Func>()>>(std::move(func));
+    std::future<std::invoke_result_t<Func>> future = task->get_future();
+    post(std::move(host), [task]() { (*task)(); });
+    return future;
+  }
+
+  /**
+   * Send an HTTP request asynchronously (see HttpClient::invokeRESTWithStatus()).
+   *
+   * @param url         The URL to which to send the request.
+   * @param httpMethod  The HTTP method.
+   * @param requestBody The HTTP request body.
+   * @param contentType The content type for POST requests.
+   * @return The future status code and body of the response. If the request fails, the future holds the exception.
+   * @throws IllegalStateException If this executor is shut down.
+   */
+  [[nodiscard]] std::future<std::pair<int, std::string>> invokeREST(std::string url,
+                                                                    std::string httpMethod = "GET",
+                                                                    std::string requestBody = "",
+                                                                    std::string contentType = "application/json");
+
+  /**
+   * Stop accepting tasks, run the tasks that have already been posted (delayed tasks without waiting for their
+   * deadlines), and stop the executor's threads. Shutting down a shut down executor does nothing.
+   */
+  void shutdown();
+
+  /**
+   * Get the key of the host a request talks to, i.e. the lowercase host name of its URL or address without the scheme,
+   * port or path. Requests to different ports of the same host (e.g. a mirror node's REST and gRPC APIs) share a key,
+   * as they share the host's capacity.
+   *
+   * @param urlOrAddress The URL of the request (e.g. "https://testnet.mirrornode.hedera.com:443/api/v1/accounts") or
+   *                     the address of the host (e.g. "testnet.mirrornode.hedera.com:443").
+   * @return The key of the host the request talks to.
+   */
+  [[nodiscard]] static std::string getHost(std::string_view urlOrAddress);
+
+private:
+  /**
+   * A posted task, the host it talks to, and the time before which it mustn't run.
+   */
+  struct Task
+  {
+    std::string mHost;
+    std::function<void()> mFunction;
+    std::chrono::steady_clock::time_point mNotBefore;
+  };
+
+  /**
+   * Run posted tasks until the executor is shut down and no tasks remain.
+   */
+  void run();
+
+  /**
+   * Find the oldest posted task that is due and whose host is below the per-host limit. Every task is due once the
+   * executor is shutting down. mMutex must be held.
+   *
+   * @param now The current time.
+   * @return An iterator to the oldest runnable task, or the end of the queue if none can run.
+   */
+  [[nodiscard]] std::deque<Task>::iterator findRunnableTask(const std::chrono::steady_clock::time_point& now);
+
+  /**
+   * The maximum number of tasks for one host to run at a time.
+   */
+  const unsigned int mMaxTasksPerHost;
+
+  /**
+   * The tasks waiting to be run, oldest first.
+   */
+  std::deque<Task> mTasks;
+
+  /**
+   * The number of tasks running for each host.
+   */
+  std::unordered_map<std::string, unsigned int> mRunning;
+
+  /**
+   * Has shutdown begun?
+   */
+  bool mShuttingDown = false;
+
+  /**
+   * The mutex guarding the tasks, running counts and flag.
+   */
+  std::mutex mMutex;
+
+  /**
+   * Signaled when a task is posted or finishes, or the executor shuts down. Threads also wake up when the next delayed
+   * task is due.
+   */
+  std::condition_variable mTasksChanged;
+
+  /**
+   * The threads running tasks.
+   */
+  std::vector<std::thread> mThreads;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_HTTP_EXECUTOR_H_
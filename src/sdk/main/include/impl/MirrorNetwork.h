@@ -5,6 +5,7 @@
 #include "BaseNetwork.h"
 #include "BaseNodeAddress.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -66,12 +67,59 @@ public:
   [[nodiscard]] std::vector<std::string> getNetwork() const;
 
   /**
-   * Get a pointer to the next MirrorNode.
+   * Get a pointer to the next MirrorNode, i.e. the first MirrorNode returned by getMirrorNodesByHealth().
    *
-   * @return A pointer to the next MirrorNode.
+   * @return A pointer to the next MirrorNode, or nullptr if this MirrorNetwork has no MirrorNodes.
    */
   [[nodiscard]] std::shared_ptr<MirrorNode> getNextMirrorNode() const;
 
+  /**
+   * Get the MirrorNodes in this MirrorNetwork, ordered by the number of streaming calls open on them (fewest first).
+   * MirrorNodes with the same number of open streams are ordered randomly, and MirrorNodes that are backing off after
+   * a failure come last. Used to spread long-lived subscriptions evenly across the MirrorNetwork.
+   *
+   * @return The MirrorNodes in this MirrorNetwork, least loaded first.
+   */
+  [[nodiscard]] std::vector<std::shared_ptr<MirrorNode>> getMirrorNodesByLoad() const;
+
+  /**
+   * Get the MirrorNodes in this MirrorNetwork in the order in which a request should try them. Healthy MirrorNodes come
+   * first, ordered by their smoothed latency (MirrorNodes without a recorded latency first, so they get measured).
+   * MirrorNodes that are backing off after a failure come last, ordered by when they will be readmitted.
+   *
+   * @return The MirrorNodes in this MirrorNetwork, best first.
+   */
+  [[nodiscard]] std::vector<std::shared_ptr<MirrorNode>> getMirrorNodesByHealth() const;
+
+  /**
+   * Record that a request to a MirrorNode succeeded, decreasing its backoff.
+   *
+   * @param node    The MirrorNode to which the request was sent.
+   * @param latency The latency of the request, or zero if it shouldn't be recorded (e.g. for streaming calls).
+   */
+  void recordSuccess(const std::shared_ptr<MirrorNode>& node, const std::chrono::system_clock::duration& latency);
+
+  /**
+   * Record that a request to a MirrorNode failed, increasing its backoff so that it is tried last until readmitted.
+   *
+   * @param node The MirrorNode to which the request was sent.
+   */
+  void recordFailure(const std::shared_ptr<MirrorNode>& node);
+
+  /**
+   * Set whether REST requests to this MirrorNetwork should be compressed (see HttpClient::invokeRESTWithStatus()).
+   *
+   * @param compression \c TRUE if REST requests should be compressed, otherwise \c FALSE.
+   */
+  void setHttpCompression(bool compression);
+
+  /**
+   * Determine if REST requests to this MirrorNetwork should be compressed.
+   *
+   * @return \c TRUE if REST requests should be compressed, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isHttpCompression() const;
+
 private:
   /**
    * Derived from BaseNetwork. Create a MirrorNode for this MirrorNetwork based on a network entry.
@@ -82,6 +130,11 @@ private:
    */
   [[nodiscard]] std::shared_ptr<MirrorNode> createNodeFromNetworkEntry(std::string_view address,
                                                                        const BaseNodeAddress& /*key*/) const override;
+
+  /**
+   * Should REST requests to this MirrorNetwork be compressed?
+   */
+  bool mHttpCompression = true;
 };
 
 } // namespace Hiero::internal
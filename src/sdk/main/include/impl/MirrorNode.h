@@ -7,6 +7,8 @@
 
 #include "BaseNode.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string_view>
 
@@ -64,6 +66,41 @@ public:
     return mNetworkStub;
   }
 
+  /**
+   * Record that a streaming call (i.e. a topic subscription) was started on this MirrorNode.
+   */
+  inline void addActiveStream() { ++mActiveStreams; }
+
+  /**
+   * Record that a streaming call on this MirrorNode finished.
+   */
+  inline void removeActiveStream() { --mActiveStreams; }
+
+  /**
+   * Get the number of streaming calls currently open on this MirrorNode.
+   *
+   * @return The number of streaming calls currently open on this MirrorNode.
+   */
+  [[nodiscard]] inline unsigned int getActiveStreams() const { return mActiveStreams; }
+
+  /**
+   * Fold the latency of a successful request into this MirrorNode's smoothed latency. Concurrent updates may overwrite
+   * each other, which only makes the estimate slightly less smooth.
+   *
+   * @param latency The latency of the successful request.
+   */
+  void recordLatency(const std::chrono::system_clock::duration& latency);
+
+  /**
+   * Get the smoothed latency of the requests sent to this MirrorNode.
+   *
+   * @return The smoothed latency of the requests sent to this MirrorNode, or zero if none have been recorded.
+   */
+  [[nodiscard]] inline std::chrono::system_clock::duration getLatency() const
+  {
+    return std::chrono::system_clock::duration(mLatency.load());
+  }
+
 private:
   /**
    * Derived from BaseNode. Get the authority of this MirrorNode.
@@ -91,6 +128,16 @@ private:
    * Pointer to the gRPC stub used to communicate with the network service living on the remote mirror node.
    */
   std::shared_ptr<com::hedera::mirror::api::proto::NetworkService::Stub> mNetworkStub = nullptr;
+
+  /**
+   * The number of streaming calls currently open on this MirrorNode.
+   */
+  std::atomic<unsigned int> mActiveStreams = 0U;
+
+  /**
+   * The smoothed latency of the requests sent to this MirrorNode, in system clock ticks.
+   */
+  std::atomic<std::chrono::system_clock::duration::rep> mLatency = 0;
 };
 
 } // namespace Hiero::internal
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_MIRROR_NODE_CONTRACT_CALL_ENGINE_H_
+#define HIERO_SDK_CPP_MIRROR_NODE_CONTRACT_CALL_ENGINE_H_
+
+#include "Defaults.h"
+#include "impl/MirrorResponseCache.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Hiero
+{
+class Client;
+class MirrorNodeContractQuery;
+}
+
+namespace Hiero::internal
+{
+class MirrorNode;
+}
+
+namespace Hiero::internal
+{
+/**
+ * Runs many read-only mirror node contract calls (MirrorNodeContractCallQuery and MirrorNodeContractEstimateGasQuery)
+ * concurrently on the Client's HTTP executor.
+ *
+ * - Calls are spread across the healthy mirror nodes of the Client's mirror network, each failing over to the others.
+ * - Identical calls (i.e. with the same request body) that are in flight at the same time are sent once, and share
+ *   the result.
+ * - The results of calls pinned to a block number are cached, as they never change, so repeating one is free.
+ * - The EVM addresses of contracts are resolved once per contract ID.
+ *
+ * The Client used to construct a MirrorNodeContractCallEngine must outlive it and the futures it returns.
+ */
+class MirrorNodeContractCallEngine
+{
+public:
+  /**
+   * Counters of a MirrorNodeContractCallEngine's activity.
+   */
+  struct Statistics
+  {
+    /**
+     * The number of calls sent to the mirror network.
+     */
+    uint64_t mSentCalls = 0ULL;
+
+    /**
+     * The number of calls that shared the result of an identical call in flight.
+     */
+    uint64_t mCollapsedCalls = 0ULL;
+
+    /**
+     * The number of calls answered from the cache of block-pinned results.
+     */
+    uint64_t mCachedCalls = 0ULL;
+  };
+
+  /**
+   * Construct with the Client to use to send calls.
+   *
+   * @param client           The Client to use to send calls. It must outlive this MirrorNodeContractCallEngine.
+   * @param maxCachedResults The maximum number of block-pinned results to cache.
+   * @throws std::invalid_argument If maxCachedResults is zero.
+   */
+  explicit MirrorNodeContractCallEngine(const Client& client,
+                                        size_t maxCachedResults = DEFAULT_MAX_CACHED_CONTRACT_CALL_RESULTS);
+
+  /**
+   * Submit a call. The query is prepared (which may resolve its contract's EVM address using the Mirror Node) before
+   * this returns, so it may be changed or destroyed afterwards.
+   *
+   * @param query The query to submit.
+   * @return The future result of the call, in the format the query's execute() returns it. It holds the exception
+   *         execute() would throw, if any.
+   * @throws IllegalStateException If the Client is closed or has no mirror nodes.
+   */
+  [[nodiscard]] std::shared_future<std::string> submit(MirrorNodeContractQuery& query);
+
+  /**
+   * Submit many calls.
+   *
+   * @param queries The queries to submit.
+   * @return The future results of the calls, in the same order as the queries.
+   * @throws IllegalStateException If the Client is closed or has no mirror nodes.
+   */
+  [[nodiscard]] std::vector<std::shared_future<std::string>> submitAll(
+    const std::vector<std::shared_ptr<MirrorNodeContractQuery>>& queries);
+
+  /**
+   * Get the counters of this MirrorNodeContractCallEngine's activity.
+   *
+   * @return The counters of this MirrorNodeContractCallEngine's activity.
+   */
+  [[nodiscard]] Statistics getStatistics() const;
+
+  /**
+   * Rotate the healthy mirror nodes at the front of a list of mirror nodes sorted by health, so that consecutive calls
+   * are sent to different healthy mirror nodes first. The unhealthy mirror nodes are left at the back. Exposed for unit
+   * tests.
+   *
+   * @param nodes    The mirror nodes, sorted by health.
+   * @param nextNode The number of calls that rotated the mirror nodes before this one.
+   */
+  static void rotateHealthyNodes(std::vector<std::shared_ptr<MirrorNode>>& nodes, size_t nextNode);
+
+private:
+  /**
+   * The state shared with the calls in flight, which may finish after this MirrorNodeContractCallEngine is destroyed.
+   */
+  struct CallState
+  {
+    explicit CallState(size_t maxCachedResults)
+      : mResults(maxCachedResults)
+    {
+    }
+
+    /**
+     * The mutex guarding the calls in flight and the counters.
+     */
+    std::mutex mMutex;
+
+    /**
+     * The calls in flight, keyed by their request body.
+     */
+    std::unordered_map<std::string, std::shared_future<std::string>> mCallsInFlight;
+
+    /**
+     * The results of block-pinned calls.
+     */
+    MirrorResponseCache mResults;
+
+    /**
+     * The counters of the engine's activity.
+     */
+    Statistics mStatistics;
+  };
+
+  /**
+   * The Client to use to send calls.
+   */
+  const Client& mClient;
+
+  /**
+   * The state shared with the calls in flight.
+   */
+  std::shared_ptr<CallState> mState;
+
+  /**
+   * The EVM addresses of the contracts called so far, keyed by contract ID.
+   */
+  std::unordered_map<std::string, std::string> mContractEvmAddresses;
+
+  /**
+   * The mutex guarding the EVM addresses of the contracts.
+   */
+  std::mutex mContractEvmAddressesMutex;
+
+  /**
+   * The number of calls sent so far, used to rotate through the healthy mirror nodes.
+   */
+  std::atomic<size_t> mNextNode{ 0ULL };
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_MIRROR_NODE_CONTRACT_CALL_ENGINE_H_
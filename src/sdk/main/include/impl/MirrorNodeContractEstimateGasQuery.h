@@ -16,6 +16,15 @@ public:
    * @return The result of the execution in string format.
    */
   [[nodiscard]] std::string execute(const Client& client) override;
+
+protected:
+  /**
+   * Get this query ready to be sent, marking it as an estimate and resolving the contract's EVM address using the
+   * Mirror Node if it isn't set.
+   *
+   * @param client The Client object used for network access.
+   */
+  void prepare(const Client& client) override;
 };
 } // namespace Hiero
 
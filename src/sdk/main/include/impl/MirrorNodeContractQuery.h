@@ -9,6 +9,7 @@
 #include "impl/HexConverter.h"
 
 #include <cstdint>
+#include <future>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -18,6 +19,11 @@
 
 using json = nlohmann::json;
 
+namespace Hiero::internal
+{
+class MirrorNodeContractCallEngine;
+}
+
 namespace Hiero
 {
 /**
@@ -192,7 +198,29 @@ public:
    */
   [[nodiscard]] virtual std::string execute(const Client& client) = 0;
 
+  /**
+   * Executes the Mirror Node query asynchronously on the Client's HTTP executor. This query and the Client must outlive
+   * the returned future.
+   *
+   * @param client The Client object used for network access.
+   * @return The future result of the execution in string format. It holds the exception execute() would throw, if any.
+   * @throws IllegalStateException If the Client is closed.
+   */
+  [[nodiscard]] std::future<std::string> executeAsync(const Client& client);
+
 protected:
+  /**
+   * Allow MirrorNodeContractCallEngine to prepare queries for sending.
+   */
+  friend class internal::MirrorNodeContractCallEngine;
+
+  /**
+   * Get this query ready to be sent, resolving the contract's EVM address using the Mirror Node if it isn't set.
+   *
+   * @param client The Client object used for network access.
+   */
+  virtual void prepare(const Client& client);
+
   /**
    * Populates the EVM addresses using the Mirror Node.
    *
@@ -5,10 +5,21 @@
 #include "impl/HttpClient.h"
 #include "impl/MirrorNodeRouter.h"
 
+#include <chrono>
+#include <functional>
+#include <memory>
 #include <string_view>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
+namespace Hiero::internal
+{
+class MirrorNetwork;
+class MirrorNode;
+class MirrorResponseCache;
+}
+
 namespace Hiero::internal::MirrorNodeGateway
 {
 /**
@@ -32,6 +43,89 @@ nlohmann::json MirrorNodeQuery(std::string_view mirrorNodeUrl,
                                std::string_view requestBody = "",
                                std::string_view requestType = "GET");
 
+/**
+ * Perform a mirror node query against a MirrorNetwork, failing over between its mirror nodes.
+ *
+ * The mirror nodes are tried in the order given by MirrorNetwork::getMirrorNodesByHealth(), and the outcome of each
+ * attempt feeds the health and latency of the mirror node it was sent to (see invokeWithFailover()). If a cache is
+ * given, the response is cached for the query type's time-to-live (see MirrorNodeRouter::getCacheTtl()).
+ *
+ * @param network The MirrorNetwork to query.
+ * @param params A vector of strings representing parameters for the query.
+ * @param queryType The type of the query.
+ * @param requestBody Body for the request if one is set.
+ * @param requestType Type of the request if one is set.
+ * @param cache The cache of mirror node responses to use, if any.
+ * @return A JSON object representing the response of the mirror node query.
+ * @throws IllegalStateException If every mirror node fails the query, or its response can't be parsed.
+ */
+nlohmann::json MirrorNodeQuery(const std::shared_ptr<MirrorNetwork>& network,
+                               const std::vector<std::string>& params,
+                               std::string_view queryType,
+                               std::string_view requestBody = "",
+                               std::string_view requestType = "GET",
+                               const std::shared_ptr<MirrorResponseCache>& cache = nullptr);
+
+/**
+ * Send a REST request to the mirror nodes of a MirrorNetwork, healthiest and fastest first, until one of them answers.
+ *
+ * A mirror node that can't be reached, or that answers with a server error (5xx) or a rate limit (429), has its backoff
+ * increased and the next mirror node is tried. Any other answer (including a client error such as 404, which another
+ * mirror node would give as well) is returned, and the latency of the mirror node that gave it is recorded.
+ *
+ * If a cache and a positive time-to-live are given, a fresh cached response is returned without a request, a stale one
+ * is revalidated with its ETag, and successful (200) responses are cached.
+ *
+ * @param network     The MirrorNetwork to which to send the request.
+ * @param buildUrl    The function that builds the URL of the request for the address of a mirror node.
+ * @param requestType The HTTP method of the request.
+ * @param requestBody The body of the request.
+ * @param cache       The cache of mirror node responses to use, if any.
+ * @param cacheTtl    The amount of time for which the response may be served from the cache.
+ * @return The body of the response.
+ * @throws IllegalStateException If the MirrorNetwork has no mirror nodes, or every mirror node fails the request.
+ */
+std::string invokeWithFailover(MirrorNetwork& network,
+                               const std::function<std::string(std::string_view mirrorNodeUrl)>& buildUrl,
+                               std::string_view requestType = "GET",
+                               std::string_view requestBody = "",
+                               MirrorResponseCache* cache = nullptr,
+                               const std::chrono::system_clock::duration& cacheTtl =
+                                 std::chrono::system_clock::duration::zero());
+
+/**
+ * Send a REST request to the given mirror nodes of a MirrorNetwork, in the given order, until one of them answers. This
+ * behaves like invokeWithFailover() above, but lets the caller spread requests across the mirror nodes instead of
+ * always trying the healthiest one first.
+ *
+ * @param network     The MirrorNetwork whose mirror nodes are given. Their health and latency are recorded in it.
+ * @param nodes       The mirror nodes to which to send the request, in the order in which to try them.
+ * @param buildUrl    The function that builds the URL of the request for the address of a mirror node.
+ * @param requestType The HTTP method of the request.
+ * @param requestBody The body of the request.
+ * @param cache       The cache of mirror node responses to use, if any.
+ * @param cacheTtl    The amount of time for which the response may be served from the cache.
+ * @return The body of the response.
+ * @throws IllegalStateException If no mirror nodes are given, or every mirror node fails the request.
+ */
+std::string invokeWithFailover(MirrorNetwork& network,
+                               const std::vector<std::shared_ptr<MirrorNode>>& nodes,
+                               const std::function<std::string(std::string_view mirrorNodeUrl)>& buildUrl,
+                               std::string_view requestType,
+                               std::string_view requestBody,
+                               MirrorResponseCache* cache,
+                               const std::chrono::system_clock::duration& cacheTtl);
+
+/**
+ * Get the host a mirror node query against a MirrorNetwork will most likely be sent to (i.e. its next mirror node), for
+ * tagging the query on an HttpExecutor.
+ *
+ * @param network The MirrorNetwork to query.
+ * @return The host key (see HttpExecutor::getHost()) of the MirrorNetwork's next mirror node, or an empty string if it
+ *         has none.
+ */
+[[nodiscard]] std::string getQueryHost(const MirrorNetwork& network);
+
 /**
  * Replaces all occurrences of a substring in a string.
  *
@@ -44,6 +138,16 @@ nlohmann::json MirrorNodeQuery(std::string_view mirrorNodeUrl,
  */
 void replaceParameters(std::string& original, std::string_view search, std::string_view replace);
 
+/**
+ * Builds the base URL of a mirror node's REST API (scheme, host and port) from its address. Local mirror nodes are
+ * reached over HTTP on the port serving the request type.
+ *
+ * @param mirrorNodeUrl The mirror node URL.
+ * @param requestType The HTTP method of the request.
+ * @return The base URL of the mirror node's REST API.
+ */
+std::string buildBaseUrl(std::string_view mirrorNodeUrl, std::string_view requestType);
+
 /**
  * Builds a URL based on a mirror node URL, query type, and parameters.
  *
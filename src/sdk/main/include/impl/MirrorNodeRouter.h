@@ -2,6 +2,7 @@
 #ifndef HIERO_SDK_CPP_MIRRORNODEROUTER_H
 #define HIERO_SDK_CPP_MIRRORNODEROUTER_H
 
+#include <chrono>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -19,6 +20,8 @@ static constexpr std::string_view CONTRACT_INFO_QUERY = "contractInfoQuery";
 static constexpr std::string_view TOKEN_RELATIONSHIPS_QUERY = "tokenRelationshipsQuery";
 static constexpr std::string_view TOKEN_BALANCES_QUERY = "tokenBalancesQuery";
 static constexpr std::string_view REGISTERED_NODES_QUERY = "registeredNodesQuery";
+static constexpr std::string_view CONTRACT_CALL_QUERY = "contractCallQuery";
+static constexpr std::string_view PINNED_CONTRACT_CALL_QUERY = "pinnedContractCallQuery";
 
 /**
  * Class responsible for routing requests to different mirror node routes.
@@ -34,16 +37,38 @@ public:
    */
   [[nodiscard]] std::string getRoute(std::string_view queryType) const;
 
+  /**
+   * Retrieves the amount of time for which a response to a specific mirror node query type may be served from the
+   * mirror response cache.
+   *
+   * @param queryType The type of the mirror node query (e.g., "accountInfoQuery").
+   * @return The time-to-live of responses to the specified mirror node query, or zero if they shouldn't be cached.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getCacheTtl(std::string_view queryType) const;
+
 private:
   /**
    * Internal mapping of mirror node query types to their respective routes.
    */
   const std::unordered_map<std::string, std::string> routes = {
-    {std::string(ACCOUNT_INFO_QUERY),         "/api/v1/accounts/$"              },
-    { std::string(CONTRACT_INFO_QUERY),       "/api/v1/contracts/$"             },
-    { std::string(TOKEN_RELATIONSHIPS_QUERY), "/api/v1/accounts/$/tokens"       },
-    { std::string(TOKEN_BALANCES_QUERY),      "/api/v1/tokens/$/balances"       },
-    { std::string(REGISTERED_NODES_QUERY),    "/api/v1/network/registered-nodes"},
+    {std::string(ACCOUNT_INFO_QUERY),          "/api/v1/accounts/$"              },
+    { std::string(CONTRACT_INFO_QUERY),        "/api/v1/contracts/$"             },
+    { std::string(TOKEN_RELATIONSHIPS_QUERY),  "/api/v1/accounts/$/tokens"       },
+    { std::string(TOKEN_BALANCES_QUERY),       "/api/v1/tokens/$/balances"       },
+    { std::string(REGISTERED_NODES_QUERY),     "/api/v1/network/registered-nodes"},
+    { std::string(CONTRACT_CALL_QUERY),        "/api/v1/contracts/call"          },
+    { std::string(PINNED_CONTRACT_CALL_QUERY), "/api/v1/contracts/call"          },
+  };
+
+  /**
+   * Internal mapping of mirror node query types to the time-to-live of their cached responses. Query types that
+   * aren't listed (token balances and relationships, and contract calls against the latest block) aren't cached.
+   */
+  const std::unordered_map<std::string, std::chrono::system_clock::duration> cacheTtls = {
+    {std::string(ACCOUNT_INFO_QUERY),          std::chrono::seconds(30)},
+    { std::string(CONTRACT_INFO_QUERY),        std::chrono::minutes(5) },
+    { std::string(REGISTERED_NODES_QUERY),     std::chrono::minutes(1) },
+    { std::string(PINNED_CONTRACT_CALL_QUERY), std::chrono::hours(1)   },
   };
 };
 
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_MIRROR_PAGINATOR_H_
+#define HIERO_SDK_CPP_IMPL_MIRROR_PAGINATOR_H_
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace Hiero
+{
+class Client;
+}
+
+namespace Hiero::internal
+{
+/**
+ * A page of a mirror node REST collection (e.g. the "accounts" of "/api/v1/accounts").
+ */
+struct MirrorPage
+{
+  /**
+   * The elements of the collection on this page.
+   */
+  std::vector<nlohmann::json> mItems;
+
+  /**
+   * The path (or, if the mirror node gave an absolute one, the URL) of the next page, or an empty string if this is
+   * the last page.
+   */
+  std::string mNextPath;
+};
+
+/**
+ * Parse a page of a mirror node REST collection with a SAX parser. Only the elements of the collection's array and the
+ * "links.next" link are kept; every other part of the response is skipped without being built into a JSON DOM.
+ *
+ * @param body       The body of the response.
+ * @param collection The name of the collection's array in the response (e.g. "accounts").
+ * @return The parsed page.
+ * @throws IllegalStateException If the body isn't valid JSON.
+ */
+[[nodiscard]] MirrorPage parseMirrorPage(std::string_view body, std::string_view collection);
+
+/**
+ * Lazily pages through a mirror node REST collection, following "links.next" from page to page. While a page is
+ * consumed, the next one is fetched on the Client's HttpExecutor, so at most two pages are held at a time no matter
+ * how long the collection is. Pages are fetched with failover across the Client's mirror network.
+ *
+ * The Client must outlive a MirrorPaginator.
+ */
+class MirrorPaginator
+{
+public:
+  /**
+   * Construct a paginator over a collection. The first page is fetched right away.
+   *
+   * @param client     The Client whose mirror network to query.
+   * @param path       The path of the first page (e.g. "/api/v1/accounts?limit=100").
+   * @param collection The name of the collection's array in the responses (e.g. "accounts").
+   * @param getBaseUrl The function that builds the base URL of a mirror node's REST API from its address. Defaults to
+   *                   MirrorNodeGateway::buildBaseUrl().
+   * @param cacheTtl   The amount of time for which pages may be served from the Client's mirror response cache. Zero
+   *                   (the default) doesn't use the cache.
+   */
+  MirrorPaginator(const Client& client,
+                  std::string path,
+                  std::string collection,
+                  std::function<std::string(std::string_view mirrorNodeUrl)> getBaseUrl = {},
+                  const std::chrono::system_clock::duration& cacheTtl = std::chrono::system_clock::duration::zero());
+
+  /**
+   * Get the next element of the collection, waiting for its page to arrive if needed.
+   *
+   * @return The next element of the collection, or an empty optional if the collection is exhausted.
+   * @throws IllegalStateException If a page can't be fetched or parsed. The collection ends at that page.
+   */
+  [[nodiscard]] std::optional<nlohmann::json> next();
+
+private:
+  /**
+   * Start fetching a page.
+   *
+   * @param path The path (or URL) of the page to fetch. Only the path and query of a URL are used, and the page is
+   *             fetched from the mirror network like any other.
+   */
+  void prefetch(const std::string& path);
+
+  /**
+   * The Client whose mirror network to query.
+   */
+  const Client& mClient;
+
+  /**
+   * The name of the collection's array in the responses.
+   */
+  std::string mCollection;
+
+  /**
+   * The function that builds the base URL of a mirror node's REST API from its address.
+   */
+  std::function<std::string(std::string_view mirrorNodeUrl)> mGetBaseUrl;
+
+  /**
+   * The amount of time for which pages may be served from the Client's mirror response cache.
+   */
+  std::chrono::system_clock::duration mCacheTtl;
+
+  /**
+   * The elements of the page being consumed, and the index of the next one.
+   */
+  std::vector<nlohmann::json> mItems;
+  size_t mIndex = 0ULL;
+
+  /**
+   * The page being fetched, if there is one.
+   */
+  std::optional<std::future<MirrorPage>> mNextPage;
+};
+
+/**
+ * A range over a mirror node REST collection whose elements are converted to SDK types as they're consumed, for use
+ * in range-based for loops. A MirrorRange can be iterated once.
+ *
+ * @tparam T The SDK type of the collection's elements.
+ */
+template<typename T>
+class MirrorRange
+{
+public:
+  /**
+   * An input iterator over a MirrorRange.
+   */
+  class Iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    Iterator() = default;
+
+    explicit Iterator(MirrorRange* range)
+      : mRange(range)
+    {
+      advance();
+    }
+
+    [[nodiscard]] reference operator*() const { return *mCurrent; }
+    [[nodiscard]] pointer operator->() const { return &*mCurrent; }
+
+    Iterator& operator++()
+    {
+      advance();
+      return *this;
+    }
+
+    [[nodiscard]] bool operator==(const Iterator& other) const { return mRange == other.mRange; }
+    [[nodiscard]] bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+  private:
+    void advance()
+    {
+      if (std::optional<nlohmann::json> item = mRange->mPaginator.next(); item.has_value())
+      {
+        mCurrent = mRange->mConvert(*item);
+      }
+      else
+      {
+        mRange = nullptr;
+        mCurrent.reset();
+      }
+    }
+
+    MirrorRange* mRange = nullptr;
+    std::optional<T> mCurrent;
+  };
+
+  /**
+   * Construct a range over a collection.
+   *
+   * @param client     The Client whose mirror network to query.
+   * @param path       The path of the first page (e.g. "/api/v1/accounts?limit=100").
+   * @param collection The name of the collection's array in the responses (e.g. "accounts").
+   * @param convert    The function that converts an element of the collection to T.
+   * @param getBaseUrl The function that builds the base URL of a mirror node's REST API from its address.
+   * @param cacheTtl   The amount of time for which pages may be served from the Client's mirror response cache.
+   */
+  MirrorRange(const Client& client,
+              std::string path,
+              std::string collection,
+              std::function<T(const nlohmann::json&)> convert,
+              std::function<std::string(std::string_view mirrorNodeUrl)> getBaseUrl = {},
+              const std::chrono::system_clock::duration& cacheTtl = std::chrono::system_clock::duration::zero())
+    : mPaginator(client, std::move(path), std::move(collection), std::move(getBaseUrl), cacheTtl)
+    , mConvert(std::move(convert))
+  {
+  }
+
+  [[nodiscard]] Iterator begin() { return Iterator(this); }
+  [[nodiscard]] Iterator end() { return Iterator(); }
+
+private:
+  /**
+   * The paginator over the collection.
+   */
+  MirrorPaginator mPaginator;
+
+  /**
+   * The function that converts an element of the collection to T.
+   */
+  std::function<T(const nlohmann::json&)> mConvert;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_MIRROR_PAGINATOR_H_
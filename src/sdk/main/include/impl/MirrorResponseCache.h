@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_MIRROR_RESPONSE_CACHE_H_
+#define HIERO_SDK_CPP_IMPL_MIRROR_RESPONSE_CACHE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Hiero::internal
+{
+/**
+ * A size-bounded, least-recently-used cache of mirror node REST responses. Each response is fresh for a time-to-live
+ * given when it's stored (see MirrorNodeRouter::getCacheTtl()); a fresh response is served without a request. Once a
+ * response goes stale, its ETag (if the mirror node sent one) is used to revalidate it with a conditional request, so
+ * that an unchanged response doesn't have to be downloaded again.
+ *
+ * Responses are keyed by HTTP method, path and body, not by mirror node, so a response from one mirror node is served
+ * for requests that would fail over to another.
+ */
+class MirrorResponseCache
+{
+public:
+  /**
+   * Counters of the cache's activity.
+   */
+  struct Statistics
+  {
+    /**
+     * The number of lookups answered with a fresh response.
+     */
+    uint64_t mHits = 0ULL;
+
+    /**
+     * The number of lookups that found no fresh response.
+     */
+    uint64_t mMisses = 0ULL;
+
+    /**
+     * The number of stale responses a mirror node confirmed unchanged (i.e. answered with 304 Not Modified).
+     */
+    uint64_t mRevalidations = 0ULL;
+
+    /**
+     * The number of responses dropped to make room for newer ones.
+     */
+    uint64_t mEvictions = 0ULL;
+
+    /**
+     * The number of responses currently cached.
+     */
+    uint64_t mEntries = 0ULL;
+  };
+
+  /**
+   * The result of a lookup.
+   */
+  struct Lookup
+  {
+    /**
+     * The cached response, if it's fresh.
+     */
+    std::optional<std::string> mFreshBody;
+
+    /**
+     * The ETag of the cached response, if it's stale and has one. Empty otherwise.
+     */
+    std::string mETag;
+  };
+
+  /**
+   * Construct with the maximum number of responses to cache.
+   *
+   * @param maxEntries The maximum number of responses to cache.
+   * @throws std::invalid_argument If maxEntries is zero.
+   */
+  explicit MirrorResponseCache(size_t maxEntries);
+
+  /**
+   * Build the key of a request.
+   *
+   * @param method The HTTP method of the request.
+   * @param url    The URL of the request. Only its path (and query) is part of the key.
+   * @param body   The body of the request.
+   * @return The key of the request.
+   */
+  [[nodiscard]] static std::string makeKey(std::string_view method, std::string_view url, std::string_view body);
+
+  /**
+   * Build the key of the cost of a paid query: its type, and the size class of its request (the power of two its
+   * serialized size rounds up to). Queries of the same type whose requests are about the same size share a key.
+   *
+   * @param queryCase   The type of the query (its proto::Query::QueryCase).
+   * @param requestSize The size of the serialized query request, in bytes.
+   * @return The key of the query's cost.
+   */
+  [[nodiscard]] static std::string makeQueryCostKey(int queryCase, size_t requestSize);
+
+  /**
+   * Look up the response to a request. A fresh response counts as a hit and is marked most recently used; anything
+   * else counts as a miss.
+   *
+   * @param key The key of the request.
+   * @return The result of the lookup.
+   */
+  [[nodiscard]] Lookup lookup(const std::string& key);
+
+  /**
+   * Cache the response to a request, replacing any response already cached for it, and evicting the least recently
+   * used response if the cache is full.
+   *
+   * @param key  The key of the request.
+   * @param body The body of the response.
+   * @param eTag The ETag of the response, or an empty string if it has none.
+   * @param ttl  The amount of time for which the response is fresh.
+   */
+  void put(const std::string& key, std::string body, std::string eTag, const std::chrono::system_clock::duration& ttl);
+
+  /**
+   * Mark the stale response to a request as fresh again, after a mirror node confirmed it unchanged.
+   *
+   * @param key The key of the request.
+   * @param ttl The amount of time for which the response is fresh again.
+   * @return The cached response, or an empty optional if it was evicted in the meantime.
+   */
+  [[nodiscard]] std::optional<std::string> revalidate(const std::string& key,
+                                                      const std::chrono::system_clock::duration& ttl);
+
+  /**
+   * Drop the response to a request, e.g. after it turned out to be wrong. Dropping a response that isn't cached does
+   * nothing.
+   *
+   * @param key The key of the request.
+   */
+  void erase(const std::string& key);
+
+  /**
+   * Drop every cached response. The statistics are kept.
+   */
+  void clear();
+
+  /**
+   * Get the counters of the cache's activity.
+   *
+   * @return The counters of the cache's activity.
+   */
+  [[nodiscard]] Statistics getStatistics() const;
+
+  /**
+   * Get the maximum number of responses to cache.
+   *
+   * @return The maximum number of responses to cache.
+   */
+  [[nodiscard]] inline size_t getMaxEntries() const { return mMaxEntries; }
+
+private:
+  /**
+   * A cached response.
+   */
+  struct Entry
+  {
+    std::string mKey;
+    std::string mBody;
+    std::string mETag;
+    std::chrono::steady_clock::time_point mExpiry;
+  };
+
+  /**
+   * The maximum number of responses to cache.
+   */
+  const size_t mMaxEntries;
+
+  /**
+   * The cached responses, most recently used first.
+   */
+  std::list<Entry> mEntries;
+
+  /**
+   * The cached responses, keyed by request.
+   */
+  std::unordered_map<std::string, std::list<Entry>::iterator> mIndex;
+
+  /**
+   * The counters of the cache's activity.
+   */
+  Statistics mStatistics;
+
+  /**
+   * The mutex guarding the entries and counters.
+   */
+  mutable std::mutex mMutex;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_MIRROR_RESPONSE_CACHE_H_
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_SIGNATURE_VERIFIER_H_
+#define HIERO_SDK_CPP_IMPL_SIGNATURE_VERIFIER_H_
+
+#include "SignatureVerificationResult.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Hiero::internal::SignatureVerifier
+{
+/**
+ * A signature waiting to be verified, along with the bytes it purportedly signs. The signed bytes are shared between
+ * all signatures of the same SignedTransaction protobuf object so that they are only converted once.
+ */
+struct SignatureCheck
+{
+  /**
+   * The result to fill. mIsValid is written by verifySignatures().
+   */
+  SignatureVerificationResult mResult;
+
+  /**
+   * The TransactionBody protobuf object bytes that were signed.
+   */
+  std::shared_ptr<const std::vector<std::byte>> mSignedBytes;
+};
+
+/**
+ * Verify a list of signatures. Signatures are grouped by key type and the groups are split across worker threads once
+ * the list is large enough to make that worthwhile. Checks with no PublicKey or no signed bytes are marked invalid.
+ *
+ * @param checks The signatures to verify. Each check's mResult.mIsValid is updated in place.
+ */
+void verifySignatures(std::vector<SignatureCheck>& checks);
+
+} // namespace Hiero::internal::SignatureVerifier
+
+#endif // HIERO_SDK_CPP_IMPL_SIGNATURE_VERIFIER_H_
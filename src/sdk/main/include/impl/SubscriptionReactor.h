@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_SUBSCRIPTION_REACTOR_H_
+#define HIERO_SDK_CPP_IMPL_SUBSCRIPTION_REACTOR_H_
+
+#include "Defaults.h"
+#include "Logger.h"
+
+#include <grpcpp/completion_queue.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Hiero::internal
+{
+/**
+ * Drives the asynchronous gRPC calls of many streaming subscriptions with a fixed number of threads. All subscriptions
+ * share one completion queue, which is drained by a small set of poller threads, and subscription callbacks are run by
+ * a separate, fixed-size pool of callback threads. The number of threads therefore doesn't grow with the number of
+ * subscriptions.
+ *
+ * The queue of callbacks is bounded. A thread posting a callback while the queue is full waits for room, which holds
+ * the poller threads back (and with them the subscriptions' streams) until the callback threads catch up. Callbacks
+ * posted from the callback threads themselves are queued regardless, as waiting there could deadlock the reactor. A
+ * callback that throws is logged and dropped; it doesn't stop its thread.
+ *
+ * A SubscriptionReactor must not be shut down or destroyed from one of its own threads (i.e. from a subscription
+ * callback).
+ */
+class SubscriptionReactor
+{
+public:
+  /**
+   * A subscription driven by a SubscriptionReactor. The address of a Handler is used as the tag of every operation it
+   * starts on the reactor's completion queue, so a Handler must have at most one operation outstanding at a time.
+   */
+  class Handler
+  {
+  public:
+    virtual ~Handler() = default;
+
+    /**
+     * Process the completion of this Handler's outstanding operation. Called from a poller thread.
+     *
+     * @param ok The status of the completed operation, as reported by the completion queue.
+     * @return \c TRUE if this Handler started another operation, \c FALSE if it is finished and should be removed from
+     *         the reactor.
+     */
+    virtual bool onEvent(bool ok) = 0;
+
+    /**
+     * Cancel this Handler. A cancelled Handler must finish (i.e. return \c FALSE from onEvent()) once its outstanding
+     * operation completes. May be called from any thread.
+     */
+    virtual void cancel() = 0;
+  };
+
+  /**
+   * Construct and start the reactor's threads.
+   *
+   * @param pollerThreads   The number of threads to drain the completion queue.
+   * @param callbackThreads The number of threads to run subscription callbacks.
+   * @param maxPendingTasks The maximum number of posted tasks waiting to be run.
+   * @param logger          The Logger with which to report callbacks that throw.
+   * @throws std::invalid_argument If the maximum number of posted tasks waiting to be run is zero.
+   */
+  explicit SubscriptionReactor(unsigned int pollerThreads = DEFAULT_SUBSCRIPTION_POLLER_THREADS,
+                               unsigned int callbackThreads = DEFAULT_SUBSCRIPTION_CALLBACK_THREADS,
+                               size_t maxPendingTasks = DEFAULT_SUBSCRIPTION_MAX_PENDING_CALLBACKS,
+                               Logger logger = Logger(Logger::LoggingLevel::SILENT));
+
+  /**
+   * Shuts down the reactor.
+   */
+  ~SubscriptionReactor();
+
+  SubscriptionReactor(const SubscriptionReactor&) = delete;
+  SubscriptionReactor& operator=(const SubscriptionReactor&) = delete;
+  SubscriptionReactor(SubscriptionReactor&&) = delete;
+  SubscriptionReactor& operator=(SubscriptionReactor&&) = delete;
+
+  /**
+   * Add a Handler to this reactor. The reactor holds the Handler until it finishes. The Handler must be added before it
+   * starts its first operation on the completion queue.
+   *
+   * @param handler The Handler to add.
+   * @throws IllegalStateException If this reactor is shut down.
+   */
+  void add(const std::shared_ptr<Handler>& handler);
+
+  /**
+   * Run a task on one of the callback threads. If the maximum number of tasks are already waiting to be run, this waits
+   * for room, unless it's called from one of the callback threads or the reactor is shutting down.
+   *
+   * @param task The task to run.
+   */
+  void post(std::function<void()> task);
+
+  /**
+   * Run a task on one of the callback threads once a deadline passes, or when the reactor shuts down if that's sooner.
+   *
+   * @param deadline The time after which to run the task.
+   * @param task     The task to run.
+   * @throws IllegalStateException If this reactor is shut down.
+   */
+  void postAfter(const std::chrono::system_clock::time_point& deadline, std::function<void()> task);
+
+  /**
+   * Cancel every Handler, wait for them all to finish, and stop the reactor's threads. Tasks that have already been
+   * posted are run before the callback threads stop. Shutting down a shut down reactor does nothing.
+   */
+  void shutdown();
+
+  /**
+   * Get the completion queue on which Handlers should start their operations.
+   *
+   * @return A pointer to the completion queue on which Handlers should start their operations.
+   */
+  [[nodiscard]] grpc::CompletionQueue* getCompletionQueue() { return &mCompletionQueue; }
+
+  /**
+   * Get the Logger with which this reactor reports callbacks that throw, for Handlers that catch their own callbacks.
+   *
+   * @return The Logger with which this reactor reports callbacks that throw.
+   */
+  [[nodiscard]] const Logger& getLogger() const { return mLogger; }
+
+private:
+  /**
+   * Drain the completion queue, dispatching each event to the Handler that started the operation.
+   */
+  void poll();
+
+  /**
+   * Run posted tasks until the reactor is shut down and no tasks remain.
+   */
+  void runCallbacks();
+
+  /**
+   * The completion queue shared by every Handler.
+   */
+  grpc::CompletionQueue mCompletionQueue;
+
+  /**
+   * The Handlers that haven't finished, keyed by the tag they use.
+   */
+  std::unordered_map<Handler*, std::shared_ptr<Handler>> mHandlers;
+
+  /**
+   * The tasks waiting to be run by the callback threads.
+   */
+  std::deque<std::function<void()>> mTasks;
+
+  /**
+   * The maximum number of tasks waiting to be run before posting waits for room.
+   */
+  size_t mMaxPendingTasks = DEFAULT_SUBSCRIPTION_MAX_PENDING_CALLBACKS;
+
+  /**
+   * The Logger with which to report callbacks that throw.
+   */
+  Logger mLogger;
+
+  /**
+   * Has shutdown begun?
+   */
+  bool mShuttingDown = false;
+
+  /**
+   * Should the callback threads stop once the task queue is empty?
+   */
+  bool mStopCallbacks = false;
+
+  /**
+   * The mutex guarding the Handlers, tasks, and flags.
+   */
+  std::mutex mMutex;
+
+  /**
+   * Signaled when a Handler finishes.
+   */
+  std::condition_variable mHandlerFinished;
+
+  /**
+   * Signaled when a task is posted or the callback threads should stop.
+   */
+  std::condition_variable mTaskPosted;
+
+  /**
+   * Signaled when a task is taken off the queue or the callback threads should stop.
+   */
+  std::condition_variable mTaskTaken;
+
+  /**
+   * The threads draining the completion queue.
+   */
+  std::vector<std::thread> mPollerThreads;
+
+  /**
+   * The threads running posted tasks.
+   */
+  std::vector<std::thread> mCallbackThreads;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_SUBSCRIPTION_REACTOR_H_
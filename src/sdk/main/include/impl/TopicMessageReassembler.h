@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_TOPIC_MESSAGE_REASSEMBLER_H_
+#define HIERO_SDK_CPP_IMPL_TOPIC_MESSAGE_REASSEMBLER_H_
+
+#include "TopicMessage.h"
+#include "TransactionId.h"
+
+#include <mirror/consensus_service.pb.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Hiero::internal
+{
+/**
+ * Reassembles the chunks of multi-chunk topic messages received by a subscription. Chunks are held until every chunk of
+ * their message has been received, at which point the message is built and the chunks are released. Messages that are
+ * unlikely to ever complete are evicted, either because their first chunk reached consensus too long before the latest
+ * received chunk, or because the chunks held by the reassembler exceed its memory cap (oldest messages first). The IDs
+ * of the most recently evicted messages are remembered, so that their late chunks are dropped rather than starting new
+ * partial messages that would be evicted (and reported) again.
+ */
+class TopicMessageReassembler
+{
+public:
+  /**
+   * Counters describing the work done by a TopicMessageReassembler.
+   */
+  struct Statistics
+  {
+    /**
+     * The number of multi-chunk messages that were completed.
+     */
+    uint64_t mCompletedMessages = 0ULL;
+
+    /**
+     * The number of partial messages that were evicted.
+     */
+    uint64_t mEvictedMessages = 0ULL;
+
+    /**
+     * The number of chunks that were discarded because their message was evicted, including chunks received after it
+     * was evicted.
+     */
+    uint64_t mEvictedChunks = 0ULL;
+
+    /**
+     * The number of chunks that were ignored because they were duplicates or had invalid chunk info.
+     */
+    uint64_t mIgnoredChunks = 0ULL;
+
+    /**
+     * The number of partial messages currently held.
+     */
+    size_t mPendingMessages = 0ULL;
+
+    /**
+     * The number of message bytes currently held.
+     */
+    size_t mPendingBytes = 0ULL;
+  };
+
+  /**
+   * Construct with the eviction limits.
+   *
+   * @param maxPendingBytes The maximum number of message bytes to hold.
+   * @param maxPendingAge   The maximum amount of consensus time between the first chunk of a partial message and the
+   *                        latest received chunk.
+   * @param onEvicted       The function to run when a partial message is evicted. It is passed the ID of the
+   *                        message's first transaction, the number of chunks received, and the total number of chunks.
+   * @param views           \c TRUE to build completed messages as views of their chunks (see TopicMessage::viewOf()),
+   *                        \c FALSE to build them as copies.
+   */
+  TopicMessageReassembler(size_t maxPendingBytes,
+                          std::chrono::system_clock::duration maxPendingAge,
+                          std::function<void(const TransactionId&, uint64_t, uint64_t)> onEvicted = {},
+                          bool views = false);
+
+  /**
+   * Add a chunk. The chunk is moved into the reassembler rather than copied.
+   *
+   * @param chunk The chunk to add. Its chunk info must have more than one chunk in total.
+   * @return The complete message, if this chunk was its last missing chunk.
+   */
+  [[nodiscard]] std::optional<TopicMessage> add(com::hedera::mirror::api::proto::ConsensusTopicResponse&& chunk);
+
+  /**
+   * Get the statistics of this reassembler.
+   *
+   * @return The statistics of this reassembler.
+   */
+  [[nodiscard]] Statistics getStatistics() const;
+
+  /**
+   * Get the consensus timestamp of the first received chunk of the oldest partial message.
+   *
+   * @return The consensus timestamp of the first received chunk of the oldest partial message, or an uninitialized
+   *         optional if no partial message is held.
+   */
+  [[nodiscard]] std::optional<std::chrono::system_clock::time_point> getOldestPendingTimestamp() const;
+
+private:
+  /**
+   * A message whose chunks haven't all been received.
+   */
+  struct PendingMessage
+  {
+    /**
+     * The ID of the message's first transaction.
+     */
+    TransactionId mTransactionId;
+
+    /**
+     * The consensus timestamp of the first received chunk.
+     */
+    std::chrono::system_clock::time_point mFirstConsensusTimestamp;
+
+    /**
+     * The total number of chunks of the message.
+     */
+    uint64_t mTotalChunks = 0ULL;
+
+    /**
+     * The received chunks, keyed by chunk number. Only received chunks are stored, as the total number of chunks comes
+     * from the mirror node and may be far larger than the number that will ever be received.
+     */
+    std::map<int32_t, com::hedera::mirror::api::proto::ConsensusTopicResponse> mChunks;
+
+    /**
+     * The number of message bytes held for this message.
+     */
+    size_t mBytes = 0ULL;
+  };
+
+  /**
+   * Evict partial messages that are too old, or while too many bytes are held.
+   *
+   * @param latestConsensusTimestamp The consensus timestamp of the latest received chunk.
+   */
+  void evict(const std::chrono::system_clock::time_point& latestConsensusTimestamp);
+
+  /**
+   * Remove a pending message.
+   *
+   * @param iter An iterator to the pending message to remove.
+   */
+  void remove(std::list<PendingMessage>::iterator iter);
+
+  /**
+   * The maximum number of message bytes to hold.
+   */
+  size_t mMaxPendingBytes;
+
+  /**
+   * The maximum amount of consensus time a partial message can be held.
+   */
+  std::chrono::system_clock::duration mMaxPendingAge;
+
+  /**
+   * The function to run when a partial message is evicted.
+   */
+  std::function<void(const TransactionId&, uint64_t, uint64_t)> mOnEvicted;
+
+  /**
+   * Should completed messages be built as views of their chunks?
+   */
+  bool mViews = false;
+
+  /**
+   * The partial messages, oldest first.
+   */
+  std::list<PendingMessage> mPending;
+
+  /**
+   * Index of the partial messages by the ID of their first transaction.
+   */
+  std::unordered_map<TransactionId, std::list<PendingMessage>::iterator> mIndex;
+
+  /**
+   * The IDs of the first transactions of the most recently evicted messages, oldest first.
+   */
+  std::deque<TransactionId> mEvicted;
+
+  /**
+   * Index of the IDs of the first transactions of the most recently evicted messages.
+   */
+  std::unordered_set<TransactionId> mEvictedIndex;
+
+  /**
+   * The statistics of this reassembler.
+   */
+  Statistics mStatistics;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_TOPIC_MESSAGE_REASSEMBLER_H_
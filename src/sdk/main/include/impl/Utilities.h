@@ -4,6 +4,8 @@
 
 #include <array>
 #include <cstddef>
+#include <istream>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -134,6 +136,18 @@ template<typename T>
  */
 [[nodiscard]] std::string byteVectorToString(const std::vector<std::byte>& bytes);
 
+/**
+ * Read bytes from an input stream. The bytes are read in blocks, so a large maximum doesn't cause a large allocation
+ * up front.
+ *
+ * @param stream   The stream from which to read.
+ * @param maxBytes The maximum number of bytes to read.
+ * @return The bytes that were read. Fewer than maxBytes bytes are returned only if the end of the stream was reached or
+ *         the stream failed.
+ */
+[[nodiscard]] std::vector<std::byte> readBytes(std::istream& stream,
+                                               size_t maxBytes = std::numeric_limits<size_t>::max());
+
 /**
  * Get a random number between the two input inclusive bounds.
  *
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_KEY_DIGEST_CONTEXT_H_
+#define HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_KEY_DIGEST_CONTEXT_H_
+
+#include "impl/openssl_utils/EVP_MD_CTX.h"
+#include "impl/openssl_utils/EVP_PKEY.h"
+
+#include <functional>
+#include <mutex>
+
+namespace Hiero::internal::OpenSSLUtils
+{
+/**
+ * A digest-sign or digest-verify context that is bound to a single key. The context is initialized with the key once,
+ * on first use, and is then duplicated for every signing or verification operation. Duplicating an initialized context
+ * skips the key copy and signature algorithm fetch that a fresh EVP_DigestSignInit or EVP_DigestVerifyInit requires.
+ * The initialized context is never modified after initialization, so a KeyDigestContext can be shared between threads.
+ */
+class KeyDigestContext
+{
+public:
+  /**
+   * The operation for which the context should be initialized.
+   */
+  enum class Operation
+  {
+    SIGN,
+    VERIFY
+  };
+
+  /**
+   * Construct with the operation for which the context should be initialized.
+   *
+   * @param operation     The operation for which the context should be initialized.
+   * @param messageDigest The message digest to use, or nullptr for keys that don't use a separate message digest (e.g.
+   *                      ED25519). The message digest must outlive this KeyDigestContext.
+   */
+  explicit KeyDigestContext(Operation operation, const ::EVP_MD* messageDigest = nullptr);
+
+  /**
+   * Get a context that is ready for a one-shot EVP_DigestSign or EVP_DigestVerify call.
+   *
+   * @param getKey A function that provides the key with which to initialize the context. It is only called the first
+   *               time a context is requested.
+   * @return The initialized context.
+   * @throws OpenSSLException If OpenSSL is unable to initialize or duplicate the context.
+   */
+  [[nodiscard]] EVP_MD_CTX getContext(const std::function<EVP_PKEY()>& getKey);
+
+private:
+  /**
+   * Initialize the context that is duplicated for each operation.
+   *
+   * @param key The key with which to initialize the context.
+   * @throws OpenSSLException If OpenSSL is unable to initialize the context.
+   */
+  void initialize(EVP_PKEY key);
+
+  /**
+   * The operation for which the context is initialized.
+   */
+  Operation mOperation;
+
+  /**
+   * The message digest to use, or nullptr if the key doesn't use a separate message digest.
+   */
+  const ::EVP_MD* mMessageDigest = nullptr;
+
+  /**
+   * Flag used to initialize the context exactly once, even when first used by multiple threads.
+   */
+  std::once_flag mInitialized;
+
+  /**
+   * The initialized context that is duplicated for each operation.
+   */
+  EVP_MD_CTX mContext = EVP_MD_CTX(nullptr);
+};
+
+} // namespace Hiero::internal::OpenSSLUtils
+
+#endif // HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_KEY_DIGEST_CONTEXT_H_
@@ -2,6 +2,10 @@
 #ifndef HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_OPENSSL_UTILS_H_
 #define HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_OPENSSL_UTILS_H_
 
+#include "ByteView.h"
+
+#include <openssl/types.h>
+
 #include <string>
 #include <string_view>
 #include <vector>
@@ -35,7 +39,7 @@ constexpr const size_t ERROR_MSG_SIZE = 256ULL;
  * @param data The byte array of which to compute the hash.
  * @return The SHA256 hash of the data.
  */
-[[nodiscard]] std::vector<std::byte> computeSHA256(const std::vector<std::byte>& data);
+[[nodiscard]] std::vector<std::byte> computeSHA256(ByteView data);
 
 /**
  * Compute the SHA384 hash of a byte array.
@@ -43,7 +47,7 @@ constexpr const size_t ERROR_MSG_SIZE = 256ULL;
  * @param data The byte array of which to compute the hash.
  * @return The SHA384 hash of the data.
  */
-[[nodiscard]] std::vector<std::byte> computeSHA384(const std::vector<std::byte>& data);
+[[nodiscard]] std::vector<std::byte> computeSHA384(ByteView data);
 
 /**
  * Compute the KECCAK256 hash of a byte array.
@@ -51,7 +55,7 @@ constexpr const size_t ERROR_MSG_SIZE = 256ULL;
  * @param data The byte array of which to compute the hash.
  * @return The KECCAK256 hash of the data.
  */
-[[nodiscard]] std::vector<std::byte> computeKECCAK256(const std::vector<std::byte>& data);
+[[nodiscard]] std::vector<std::byte> computeKECCAK256(ByteView data);
 
 /**
  * Compute the HMAC-SHA512 hash of a key and data.
@@ -64,6 +68,14 @@ constexpr const size_t ERROR_MSG_SIZE = 256ULL;
 [[nodiscard]] std::vector<std::byte> computeSHA512HMAC(const std::vector<std::byte>& key,
                                                        const std::vector<std::byte>& data);
 
+/**
+ * Get the process-wide KECCAK256 message digest. It is fetched once, on first use, and can be shared by all threads.
+ *
+ * @return The KECCAK256 message digest.
+ * @throws OpenSSLException If OpenSSL is unable to fetch the message digest.
+ */
+[[nodiscard]] const ::EVP_MD* getKECCAK256MessageDigest();
+
 /**
  * Gets an error message for an OpenSSL error. Includes as much detail as possible.
  *
@@ -4,6 +4,7 @@
 
 #include "AccountId.h"
 #include "Client.h"
+#include "Defaults.h"
 #include "LedgerId.h"
 #include "PublicKey.h"
 #include "exceptions/BadKeyException.h"
@@ -11,19 +12,72 @@
 #include "exceptions/UninitializedException.h"
 
 #include "impl/EntityIdHelper.h"
-#include "impl/HttpClient.h"
+#include "impl/HttpExecutor.h"
 #include "impl/MirrorNetwork.h"
+#include "impl/MirrorNodeGateway.h"
 #include "impl/Utilities.h"
 
 #include <nlohmann/json.hpp>
 
+#include <deque>
+#include <future>
 #include <limits>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
 
 using json = nlohmann::json;
 
 namespace Hiero
 {
+namespace
+{
+// Fetch the EVM address of an account from the healthiest Mirror Node, failing over to the others. Returns an empty
+// optional instead of throwing if the account doesn't exist or can't be fetched.
+std::optional<EvmAddress> fetchEvmAddress(internal::MirrorNetwork& mirrorNetwork,
+                                          internal::MirrorResponseCache* cache,
+                                          const std::chrono::system_clock::duration& cacheTtl,
+                                          const std::string& accountPath)
+{
+  std::string response;
+  try
+  {
+    response = internal::MirrorNodeGateway::invokeWithFailover(
+      mirrorNetwork,
+      [&accountPath](std::string_view mirrorNodeUrl) { return "https://" + std::string(mirrorNodeUrl) + accountPath; },
+      "GET",
+      "",
+      cache,
+      cacheTtl);
+  }
+  catch (const std::exception&)
+  {
+    return {};
+  }
+
+  // Only the top-level "evm_address" field is kept, the rest of the account is discarded as it's parsed.
+  const json responseData = json::parse(
+    response,
+    [](int depth, json::parse_event_t event, const json& parsed)
+    { return event != json::parse_event_t::key || depth != 1 || parsed == "evm_address"; },
+    false);
+  if (responseData.is_discarded() || !responseData.contains("evm_address") || !responseData["evm_address"].is_string())
+  {
+    return {};
+  }
+
+  try
+  {
+    return EvmAddress::fromString(responseData["evm_address"].get<std::string>());
+  }
+  catch (const std::exception&)
+  {
+    return {};
+  }
+}
+
+} // anonymous namespace
+
 //-----
 AccountId::AccountId(uint64_t num)
   : mAccountNum(num)
@@ -246,25 +300,29 @@ AccountId& AccountId::populateAccountEvmAddress(const Client& client)
 {
   if (!mAccountNum.has_value())
   {
-    throw new IllegalStateException("member `mAccountNum` should not be empty");
+    throw IllegalStateException("member `mAccountNum` should not be empty");
   }
 
-  std::vector<std::string> mirrorNetworks = client.getClientMirrorNetwork()->getNetwork();
-  if (mirrorNetworks.empty())
+  const std::shared_ptr<internal::MirrorNetwork> mirrorNetwork = client.getClientMirrorNetwork();
+  if (!mirrorNetwork || mirrorNetwork->getNetwork().empty())
   {
-    throw new UninitializedException("mirrorNetworks vector not populated!");
+    throw UninitializedException("mirrorNetworks vector not populated!");
   }
 
-  // build url for Mirror Node
-  std::string url = "https://" + mirrorNetworks.front() + "/api/v1/accounts/" + toString();
-
-  // fetch account data for this account from Mirror Node
-  std::string response = internal::HttpClient::invokeREST(url, "GET");
+  // fetch account data for this account from the healthiest Mirror Node, failing over to the others
+  const std::string accountPath = "/api/v1/accounts/" + toString();
+  std::string response = internal::MirrorNodeGateway::invokeWithFailover(
+    *mirrorNetwork,
+    [&accountPath](std::string_view mirrorNodeUrl) { return "https://" + std::string(mirrorNodeUrl) + accountPath; },
+    "GET",
+    "",
+    client.getMirrorResponseCache().get(),
+    internal::MirrorNodeGateway::MirrorNodeRouter().getCacheTtl(internal::MirrorNodeGateway::ACCOUNT_INFO_QUERY));
   json responseData = json::parse(response);
 
   if (responseData["account"].empty() || responseData["evm_address"].empty())
   {
-    throw new IllegalStateException("No such account in MirrorNetwork: " + responseData.dump());
+    throw IllegalStateException("No such account in MirrorNetwork: " + responseData.dump());
   }
 
   std::string evmAddress = responseData["evm_address"].dump();
@@ -276,6 +334,82 @@ AccountId& AccountId::populateAccountEvmAddress(const Client& client)
   return *this;
 }
 
+//-----
+std::vector<std::optional<EvmAddress>> AccountId::populateAccountEvmAddresses(const Client& client,
+                                                                              std::vector<AccountId>& accountIds)
+{
+  const std::shared_ptr<internal::MirrorNetwork> mirrorNetwork = client.getClientMirrorNetwork();
+  if (!mirrorNetwork || mirrorNetwork->getNetwork().empty())
+  {
+    throw UninitializedException("mirrorNetworks vector not populated!");
+  }
+
+  // Each distinct account is fetched once, no matter how many times it appears.
+  std::vector<std::string> accountPaths;
+  std::unordered_map<std::string, size_t> accountPathIndices;
+  std::vector<std::optional<size_t>> accountIdPathIndices(accountIds.size());
+  for (size_t i = 0; i < accountIds.size(); ++i)
+  {
+    if (!accountIds.at(i).mAccountNum.has_value())
+    {
+      continue;
+    }
+
+    const auto [iter, inserted] =
+      accountPathIndices.try_emplace("/api/v1/accounts/" + accountIds.at(i).toString(), accountPaths.size());
+    if (inserted)
+    {
+      accountPaths.push_back(iter->first);
+    }
+
+    accountIdPathIndices.at(i) = iter->second;
+  }
+
+  // Keep a bounded number of fetches in flight, so a large batch doesn't crowd out the Client's other mirror node
+  // requests on the executor.
+  const std::shared_ptr<internal::HttpExecutor> executor = client.getHttpExecutor();
+  const std::shared_ptr<internal::MirrorResponseCache> cache = client.getMirrorResponseCache();
+  const std::chrono::system_clock::duration cacheTtl =
+    internal::MirrorNodeGateway::MirrorNodeRouter().getCacheTtl(internal::MirrorNodeGateway::ACCOUNT_INFO_QUERY);
+  const std::string host = internal::MirrorNodeGateway::getQueryHost(*mirrorNetwork);
+
+  std::vector<std::optional<EvmAddress>> evmAddresses(accountPaths.size());
+  std::deque<std::pair<size_t, std::future<std::optional<EvmAddress>>>> fetches;
+  size_t nextFetch = 0ULL;
+  while (nextFetch < accountPaths.size() || !fetches.empty())
+  {
+    if (nextFetch < accountPaths.size() && fetches.size() < DEFAULT_MAX_MIRROR_BATCH_REQUESTS_IN_FLIGHT)
+    {
+      std::future<std::optional<EvmAddress>> fetch =
+        executor->submit(host,
+                         [mirrorNetwork, cache, cacheTtl, accountPath = accountPaths.at(nextFetch)]()
+                         { return fetchEvmAddress(*mirrorNetwork, cache.get(), cacheTtl, accountPath); });
+      fetches.emplace_back(nextFetch, std::move(fetch));
+      ++nextFetch;
+    }
+    else
+    {
+      evmAddresses.at(fetches.front().first) = fetches.front().second.get();
+      fetches.pop_front();
+    }
+  }
+
+  std::vector<std::optional<EvmAddress>> results(accountIds.size());
+  for (size_t i = 0; i < accountIds.size(); ++i)
+  {
+    if (accountIdPathIndices.at(i).has_value())
+    {
+      results.at(i) = evmAddresses.at(*accountIdPathIndices.at(i));
+      if (results.at(i).has_value())
+      {
+        accountIds.at(i).mEvmAddressAlias = results.at(i);
+      }
+    }
+  }
+
+  return results;
+}
+
 //-----
 std::string AccountId::toString() const
 {
@@ -33,13 +33,16 @@ NodeAddressBook AddressBookQuery::execute(const Client& client, const std::chron
                                          std::to_string(mMaxAttempts));
     }
 
-    // Grab the MirrorNode to use to send this AddressBookQuery and make sure its connected.
-    std::shared_ptr<internal::MirrorNode> node = client.getClientMirrorNetwork()->getNextMirrorNode();
+    // Grab the MirrorNode to use to send this AddressBookQuery and make sure its connected. A MirrorNode that fails to
+    // connect backs off, so that the next healthiest one is picked.
+    const std::shared_ptr<internal::MirrorNetwork> network = client.getClientMirrorNetwork();
+    std::shared_ptr<internal::MirrorNode> node = network->getNextMirrorNode();
     while (node->channelFailedToConnect())
     {
       std::cout << "Failed to connect to node " << node->getAddress().toString() << " on attempt " << attempt
                 << std::endl;
-      node = client.getClientMirrorNetwork()->getNextMirrorNode();
+      network->recordFailure(node);
+      node = network->getNextMirrorNode();
     }
 
     // Send this AddressBookQuery.
@@ -62,13 +65,15 @@ NodeAddressBook AddressBookQuery::execute(const Client& client, const std::chron
                                                                 errorCode == grpc::StatusCode::RESOURCE_EXHAUSTED ||
                                                                 errorCode == grpc::StatusCode::INTERNAL)
     {
-      // Sleep and retry.
+      // Back the MirrorNode off, then sleep and retry.
+      network->recordFailure(node);
       std::this_thread::sleep_for(std::min(std::chrono::duration_cast<std::chrono::system_clock::duration>(
                                              DEFAULT_MIN_BACKOFF * pow(static_cast<double>(attempt), 2.0)),
                                            mMaxBackoff));
       continue;
     }
 
+    network->recordSuccess(node, std::chrono::system_clock::duration::zero());
     return NodeAddressBook().setNodeAddresses(nodeAddresses);
   }
 }
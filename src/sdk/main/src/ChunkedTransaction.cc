@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "ChunkedTransaction.h"
+#include "ByteView.h"
 #include "Client.h"
 #include "FileAppendTransaction.h"
 #include "TopicMessageSubmitTransaction.h"
@@ -13,12 +14,106 @@
 #include <services/transaction.pb.h>
 #include <services/transaction_contents.pb.h>
 
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <exception>
+#include <future>
 #include <iterator>
+#include <limits>
 
 namespace Hiero
 {
+namespace
+{
+/**
+ * Find the last occurrence of a length-delimited field in a serialized protobuf object, without parsing the object.
+ *
+ * @param bytes       The serialized protobuf object.
+ * @param fieldNumber The number of the field to find.
+ * @return A view of the field's bytes, or an empty view if the field isn't present or the object is malformed.
+ */
+ByteView findLengthDelimitedField(ByteView bytes, int fieldNumber)
+{
+  using google::protobuf::internal::WireFormatLite;
+
+  ByteView field;
+  google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(bytes.data()),
+                                               static_cast<int>(bytes.size()));
+  while (const uint32_t tag = input.ReadTag())
+  {
+    if (WireFormatLite::GetTagFieldNumber(tag) == fieldNumber &&
+        WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+    {
+      uint32_t length = 0U;
+      if (!input.ReadVarint32(&length) || length > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+      {
+        return {};
+      }
+
+      const auto offset = static_cast<size_t>(input.CurrentPosition());
+      if (!input.Skip(static_cast<int>(length)))
+      {
+        return {};
+      }
+
+      field = bytes.subview(offset, length);
+    }
+    else if (!WireFormatLite::SkipField(&input, tag))
+    {
+      return {};
+    }
+  }
+
+  return field;
+}
+
+/**
+ * Get the type of a Transaction protobuf object's body. Only the field tags of the serialized SignedTransaction and
+ * TransactionBody protobuf objects are read, so the body and its data (e.g. a chunk's contents) are never copied.
+ *
+ * @param transaction The Transaction protobuf object of which to get the type.
+ * @return The type of the Transaction protobuf object's body.
+ */
+proto::TransactionBody::DataCase getTransactionDataCase(const proto::Transaction& transaction)
+{
+  const ByteView bodyBytes = findLengthDelimitedField(ByteView(transaction.signedtransactionbytes()),
+                                                      proto::SignedTransaction::kBodyBytesFieldNumber);
+
+  using google::protobuf::internal::WireFormatLite;
+
+  // The last field of the body's data oneof is the one a parser would keep. Every data field is a message, so a data
+  // field number with any other wire type is an unknown field to a parser and must not be taken as the data case.
+  const google::protobuf::Descriptor* descriptor = proto::TransactionBody::descriptor();
+  proto::TransactionBody::DataCase dataCase = proto::TransactionBody::DATA_NOT_SET;
+  google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(bodyBytes.data()),
+                                               static_cast<int>(bodyBytes.size()));
+  while (const uint32_t tag = input.ReadTag())
+  {
+    const int fieldNumber = WireFormatLite::GetTagFieldNumber(tag);
+    if (const google::protobuf::FieldDescriptor* field = descriptor->FindFieldByNumber(fieldNumber);
+        field != nullptr && field->containing_oneof() != nullptr &&
+        WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+    {
+      dataCase = static_cast<proto::TransactionBody::DataCase>(fieldNumber);
+    }
+
+    if (!WireFormatLite::SkipField(&input, tag))
+    {
+      return proto::TransactionBody::DATA_NOT_SET;
+    }
+  }
+
+  return dataCase;
+}
+
+} // anonymous namespace
+
 //-----
 template<typename SdkRequestType>
 struct ChunkedTransaction<SdkRequestType>::ChunkedTransactionImpl
@@ -27,8 +122,9 @@ struct ChunkedTransaction<SdkRequestType>::ChunkedTransactionImpl
   // (which is stored in Transaction<SdkRequestType>::mTransactionId).
   std::vector<TransactionId> mChunkedTransactionIds;
 
-  // This ChunkedTransaction's data.
-  std::vector<std::byte> mData;
+  // This ChunkedTransaction's data. The data is never modified once set, so copies of this ChunkedTransaction share it
+  // instead of duplicating it.
+  std::shared_ptr<const std::vector<std::byte>> mData = std::make_shared<const std::vector<std::byte>>();
 
   // The size of this ChunkedTransaction's chunks, in bytes.
   unsigned int mChunkSize = DEFAULT_CHUNK_SIZE;
@@ -36,6 +132,9 @@ struct ChunkedTransaction<SdkRequestType>::ChunkedTransactionImpl
   // The maximum number of chunks into which this ChunkedTransaction will get broken up.
   unsigned int mMaxChunks = DEFAULT_MAX_CHUNKS;
 
+  // The maximum number of chunks executeAll() can have in flight at once.
+  unsigned int mMaxChunksInFlight = DEFAULT_MAX_CHUNKS_IN_FLIGHT;
+
   // Should this ChunkedTransaction get a receipt for each submitted chunk?
   bool mShouldGetReceipt = false;
 
@@ -94,6 +193,20 @@ std::vector<TransactionResponse> ChunkedTransaction<SdkRequestType>::executeAll(
   std::vector<TransactionResponse> responses;
   responses.reserve(requiredChunks);
 
+  // Getting a receipt after each chunk is what keeps chunks in order, so chunks can only be pipelined without it, and
+  // pipelined chunks get no receipts. The first chunk is always executed alone so that this ChunkedTransaction is
+  // frozen and signed before being copied.
+  if (mImpl->mMaxChunksInFlight > 1U && !mImpl->mShouldGetReceipt && requiredChunks > 1U)
+  {
+    mImpl->mCurrentChunk = 0U;
+    responses.push_back(
+      Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::execute(
+        client, timeout));
+
+    executeRemainingChunksPipelined(client, timeout, requiredChunks, responses);
+    return responses;
+  }
+
   for (; mImpl->mCurrentChunk < requiredChunks; ++mImpl->mCurrentChunk)
   {
     responses.push_back(
@@ -193,7 +306,7 @@ template<typename SdkRequestType>
 SdkRequestType& ChunkedTransaction<SdkRequestType>::addSignature(const std::shared_ptr<PublicKey>& publicKey,
                                                                  const std::vector<std::byte>& signature)
 {
-  if (mImpl->mData.size() > mImpl->mChunkSize)
+  if (mImpl->mData->size() > mImpl->mChunkSize)
   {
     throw IllegalStateException(
       "Cannot manually add a signature to a ChunkedTransaction with data length greater than " +
@@ -208,7 +321,7 @@ template<typename SdkRequestType>
 std::map<AccountId, std::map<std::shared_ptr<PublicKey>, std::vector<std::byte>>>
 ChunkedTransaction<SdkRequestType>::getSignatures() const
 {
-  if (mImpl->mData.size() > mImpl->mChunkSize)
+  if (mImpl->mData->size() > mImpl->mChunkSize)
   {
     throw IllegalStateException("Cannot get signatures for a ChunkedTransaction with data length greater than " +
                                 std::to_string(mImpl->mChunkSize) + " bytes. Try calling getAllSignatures() instead.");
@@ -295,10 +408,10 @@ ChunkedTransaction<SdkRequestType>::getAllTransactionHashesPerNode() const
     for (unsigned int j = 0; j < nodeAccountIds.size(); ++j)
     {
       hashMap.emplace(nodeAccountIds.at(j),
-                      internal::OpenSSLUtils::computeSHA384(internal::Utilities::stringToByteVector(
-                        Transaction<SdkRequestType>::getTransactionProtobufObject(
-                          (i * static_cast<unsigned int>(nodeAccountIds.size())) + j)
-                          .signedtransactionbytes())));
+                      internal::OpenSSLUtils::computeSHA384(
+                        ByteView(Transaction<SdkRequestType>::getTransactionProtobufObject(
+                                   (i * static_cast<unsigned int>(nodeAccountIds.size())) + j)
+                                   .signedtransactionbytes())));
     }
 
     hashes.push_back(hashMap);
@@ -325,6 +438,19 @@ SdkRequestType& ChunkedTransaction<SdkRequestType>::setChunkSize(unsigned int si
   return static_cast<SdkRequestType&>(*this);
 }
 
+//-----
+template<typename SdkRequestType>
+SdkRequestType& ChunkedTransaction<SdkRequestType>::setMaxChunksInFlight(unsigned int chunks)
+{
+  if (chunks == 0U)
+  {
+    throw std::invalid_argument("The maximum number of chunks in flight must be at least 1");
+  }
+
+  mImpl->mMaxChunksInFlight = chunks;
+  return static_cast<SdkRequestType&>(*this);
+}
+
 //-----
 template<typename SdkRequestType>
 unsigned int ChunkedTransaction<SdkRequestType>::getMaxChunks() const
@@ -339,6 +465,13 @@ unsigned int ChunkedTransaction<SdkRequestType>::getChunkSize() const
   return mImpl->mChunkSize;
 }
 
+//-----
+template<typename SdkRequestType>
+unsigned int ChunkedTransaction<SdkRequestType>::getMaxChunksInFlight() const
+{
+  return mImpl->mMaxChunksInFlight;
+}
+
 //-----
 template<typename SdkRequestType>
 ChunkedTransaction<SdkRequestType>::ChunkedTransaction()
@@ -420,13 +553,7 @@ ChunkedTransaction<SdkRequestType>::ChunkedTransaction(
   proto::TransactionBody::DataCase expectedDataCase = proto::TransactionBody::DATA_NOT_SET;
   if (!transactions.empty() && !transactions.cbegin()->second.empty())
   {
-    const proto::Transaction& firstTx = transactions.cbegin()->second.cbegin()->second;
-    proto::SignedTransaction signedTx;
-    signedTx.ParseFromArray(firstTx.signedtransactionbytes().data(),
-                            static_cast<int>(firstTx.signedtransactionbytes().size()));
-    proto::TransactionBody txBody;
-    txBody.ParseFromArray(signedTx.bodybytes().data(), static_cast<int>(signedTx.bodybytes().size()));
-    expectedDataCase = txBody.data_case();
+    expectedDataCase = getTransactionDataCase(transactions.cbegin()->second.cbegin()->second);
   }
 
   // Go through each additional TransactionId and store its information.
@@ -450,13 +577,7 @@ ChunkedTransaction<SdkRequestType>::ChunkedTransaction(
         // This is defense-in-depth against transaction smuggling attacks where an attacker
         // might try to inject a different transaction type (e.g., CryptoTransfer) as a "chunk"
         // of what appears to be a FileAppend or TopicMessageSubmit transaction.
-        proto::SignedTransaction signedTx;
-        signedTx.ParseFromArray(transaction.signedtransactionbytes().data(),
-                                static_cast<int>(transaction.signedtransactionbytes().size()));
-        proto::TransactionBody txBody;
-        txBody.ParseFromArray(signedTx.bodybytes().data(), static_cast<int>(signedTx.bodybytes().size()));
-
-        if (txBody.data_case() != expectedDataCase)
+        if (getTransactionDataCase(transaction) != expectedDataCase)
         {
           throw std::invalid_argument(
             "ChunkedTransaction contains chunks with inconsistent transaction types. "
@@ -473,7 +594,7 @@ ChunkedTransaction<SdkRequestType>::ChunkedTransaction(
 template<typename SdkRequestType>
 SdkRequestType& ChunkedTransaction<SdkRequestType>::setData(const std::vector<std::byte>& data)
 {
-  mImpl->mData = data;
+  mImpl->mData = std::make_shared<const std::vector<std::byte>>(data);
   return static_cast<SdkRequestType&>(*this);
 }
 
@@ -481,26 +602,44 @@ SdkRequestType& ChunkedTransaction<SdkRequestType>::setData(const std::vector<st
 template<typename SdkRequestType>
 SdkRequestType& ChunkedTransaction<SdkRequestType>::setData(std::string_view data)
 {
-  return setData(internal::Utilities::stringToByteVector(data));
+  mImpl->mData = std::make_shared<const std::vector<std::byte>>(internal::Utilities::stringToByteVector(data));
+  return static_cast<SdkRequestType&>(*this);
+}
+
+//-----
+template<typename SdkRequestType>
+SdkRequestType& ChunkedTransaction<SdkRequestType>::setData(std::shared_ptr<const std::vector<std::byte>> data)
+{
+  mImpl->mData = data ? std::move(data) : std::make_shared<const std::vector<std::byte>>();
+  return static_cast<SdkRequestType&>(*this);
 }
 
 //-----
 template<typename SdkRequestType>
 std::vector<std::byte> ChunkedTransaction<SdkRequestType>::getData() const
 {
-  return mImpl->mData;
+  return *mImpl->mData;
+}
+
+//-----
+template<typename SdkRequestType>
+ByteView ChunkedTransaction<SdkRequestType>::getDataView() const
+{
+  return *mImpl->mData;
 }
 
 //-----
 template<typename SdkRequestType>
 std::vector<std::byte> ChunkedTransaction<SdkRequestType>::getDataForChunk(unsigned int chunk) const
 {
-  const unsigned int startingByteForChunk = mImpl->mChunkSize * chunk;
-  const auto start = mImpl->mData.cbegin() + startingByteForChunk;
-  return { start,
-           start + ((mImpl->mChunkSize + startingByteForChunk > mImpl->mData.size())
-                      ? mImpl->mData.size() - startingByteForChunk
-                      : mImpl->mChunkSize) };
+  return getDataViewForChunk(chunk).toVector();
+}
+
+//-----
+template<typename SdkRequestType>
+ByteView ChunkedTransaction<SdkRequestType>::getDataViewForChunk(unsigned int chunk) const
+{
+  return getDataView().subview(static_cast<size_t>(mImpl->mChunkSize) * chunk, mImpl->mChunkSize);
 }
 
 //-----
@@ -535,17 +674,19 @@ proto::Transaction ChunkedTransaction<SdkRequestType>::makeRequest(unsigned int
 template<typename SdkRequestType>
 void ChunkedTransaction<SdkRequestType>::regenerateSignedTransactions(const Client* client) const
 {
-  // Get a TransactionBody protobuf object that contains all of this ChunkedTransaction's data.
+  // Update the source TransactionBody protobuf object, which holds all of this ChunkedTransaction's data. That is one
+  // copy of the whole payload, which the source body must hold for toBytes() and scheduling.
   Transaction<SdkRequestType>::updateSourceTransactionBody(client);
-  proto::TransactionBody sourceTransactionBody = Transaction<SdkRequestType>::getSourceTransactionBody();
 
   // Clear out any stale SignedTransaction and/or Transaction protobuf objects.
   clearTransactions();
 
   // If a TransactionId is set, then cascading TransactionIds can be created, and thus the chunks of this
   // ChunkedTransaction can be created.
-  if (sourceTransactionBody.has_transactionid())
+  if (Transaction<SdkRequestType>::getSourceTransactionBody().has_transactionid())
   {
+    // Each chunk's data replaces the source body's, so don't copy the whole payload only to drop it.
+    proto::TransactionBody sourceTransactionBody = Transaction<SdkRequestType>::getSourceTransactionBodyWithoutData();
     const unsigned int requiredChunks = getNumberOfChunksRequired();
     for (int i = 0; i < requiredChunks; ++i)
     {
@@ -573,7 +714,8 @@ void ChunkedTransaction<SdkRequestType>::regenerateSignedTransactions(const Clie
   // data contents for each node.
   else
   {
-    Transaction<SdkRequestType>::addSignedTransactionForEachNode(sourceTransactionBody);
+    Transaction<SdkRequestType>::addSignedTransactionForEachNode(
+      Transaction<SdkRequestType>::getSourceTransactionBody());
   }
 }
 
@@ -598,7 +740,7 @@ template<typename SdkRequestType>
 unsigned int ChunkedTransaction<SdkRequestType>::getNumberOfChunksRequired() const
 {
   return static_cast<unsigned int>(
-    std::ceil(static_cast<double>(mImpl->mData.size()) / static_cast<double>(mImpl->mChunkSize)));
+    std::ceil(static_cast<double>(mImpl->mData->size()) / static_cast<double>(mImpl->mChunkSize)));
 }
 
 //-----
@@ -625,6 +767,73 @@ std::vector<proto::Transaction> ChunkedTransaction<SdkRequestType>::getChunkedTr
   return result;
 }
 
+//-----
+template<typename SdkRequestType>
+void ChunkedTransaction<SdkRequestType>::executeRemainingChunksPipelined(
+  const Client& client,
+  const std::chrono::system_clock::duration& timeout,
+  unsigned int requiredChunks,
+  std::vector<TransactionResponse>& responses)
+{
+  // Build every chunk's Transaction protobuf objects once, so that the copies don't each have to sign them.
+  Transaction<SdkRequestType>::buildAllTransactions();
+  responses.resize(requiredChunks);
+
+  std::atomic<unsigned int> nextChunk{ 1U };
+  std::atomic_bool failed{ false };
+
+  // Each worker submits one chunk at a time, claiming chunks in order until they're all submitted. A worker uses its
+  // own copy of this ChunkedTransaction, since executing mutates the node selection and attempt state.
+  const auto worker = [&client, &timeout, &responses, &nextChunk, &failed, requiredChunks](SdkRequestType copy)
+  {
+    for (unsigned int chunk = nextChunk++; chunk < requiredChunks && !failed; chunk = nextChunk++)
+    {
+      try
+      {
+        static_cast<ChunkedTransaction<SdkRequestType>&>(copy).mImpl->mCurrentChunk = chunk;
+        responses[chunk] =
+          copy.Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::execute(
+            client, timeout);
+      }
+      catch (...)
+      {
+        failed = true;
+        throw;
+      }
+    }
+  };
+
+  const unsigned int workerCount = std::min(mImpl->mMaxChunksInFlight, requiredChunks - 1U);
+  std::vector<std::future<void>> workers;
+  workers.reserve(workerCount);
+  for (unsigned int i = 0; i < workerCount; ++i)
+  {
+    workers.push_back(std::async(std::launch::async, worker, static_cast<const SdkRequestType&>(*this)));
+  }
+
+  // Wait for every worker before rethrowing, since they all reference this stack frame.
+  std::exception_ptr exception;
+  for (std::future<void>& future : workers)
+  {
+    try
+    {
+      future.get();
+    }
+    catch (...)
+    {
+      if (!exception)
+      {
+        exception = std::current_exception();
+      }
+    }
+  }
+
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
 /**
  * Explicit template instantiations.
  */
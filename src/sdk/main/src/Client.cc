@@ -12,10 +12,14 @@
 #include "PrivateKey.h"
 #include "PublicKey.h"
 #include "SubscriptionHandle.h"
+#include "exceptions/IllegalStateException.h"
 #include "exceptions/UninitializedException.h"
 #include "impl/BaseNodeAddress.h"
+#include "impl/HttpExecutor.h"
 #include "impl/MirrorNetwork.h"
+#include "impl/MirrorResponseCache.h"
 #include "impl/Network.h"
+#include "impl/SubscriptionReactor.h"
 #include "impl/TLSBehavior.h"
 
 #include <condition_variable>
@@ -36,6 +40,39 @@ struct Client::ClientImpl
   // sending/receiving information to/from a Hiero mirror node.
   std::shared_ptr<internal::MirrorNetwork> mMirrorNetwork = nullptr;
 
+  // Pointer to the SubscriptionReactor that drives this Client's mirror node
+  // subscriptions. Created on first use.
+  std::shared_ptr<internal::SubscriptionReactor> mSubscriptionReactor = nullptr;
+
+  // Pointer to the HttpExecutor that runs this Client's asynchronous mirror node
+  // REST requests. Created on first use.
+  std::shared_ptr<internal::HttpExecutor> mHttpExecutor = nullptr;
+
+  // Has this Client been closed? Once closed, it won't create another
+  // SubscriptionReactor or HttpExecutor.
+  bool mClosed = false;
+
+  // Pointer to the cache of this Client's mirror node REST responses. Null if
+  // caching is disabled.
+  std::shared_ptr<internal::MirrorResponseCache> mMirrorResponseCache = nullptr;
+
+  // Pointer to the cache of this Client's fee estimates, and the amount of time
+  // for which they're cached. Null if caching is disabled.
+  std::shared_ptr<internal::MirrorResponseCache> mFeeEstimateCache = nullptr;
+  std::chrono::system_clock::duration mFeeEstimateCacheTtl = std::chrono::system_clock::duration::zero();
+
+  // Should mirror node REST requests and fee estimates be compressed?
+  bool mHttpCompression = true;
+
+  // Pointer to the cache of the costs of this Client's paid queries, and the
+  // amount of time for which they're cached. Null if caching is disabled.
+  std::shared_ptr<internal::MirrorResponseCache> mQueryCostCache = nullptr;
+  std::chrono::system_clock::duration mQueryCostCacheTtl = std::chrono::system_clock::duration::zero();
+
+  // Should paid queries whose cost isn't cached pay their maximum query payment
+  // up front?
+  bool mPrepayQueries = false;
+
   // The Logger used by this Client.
   Logger mLogger = Logger(Logger::LoggingLevel::SILENT);
 
@@ -594,6 +631,7 @@ void Client::close()
   cancelScheduledNetworkUpdate();
 
   std::unique_lock lock(mImpl->mMutex);
+  mImpl->mClosed = true;
 
   std::for_each(mImpl->mSubscriptions.begin(),
                 mImpl->mSubscriptions.end(),
@@ -608,6 +646,22 @@ void Client::close()
   {
     mImpl->mMirrorNetwork->close();
   }
+
+  // Shut down the subscription reactor and HTTP executor WITHOUT holding the mutex, as
+  // subscription callbacks and requests that are still running may call into this Client.
+  const std::shared_ptr<internal::SubscriptionReactor> reactor = std::move(mImpl->mSubscriptionReactor);
+  const std::shared_ptr<internal::HttpExecutor> httpExecutor = std::move(mImpl->mHttpExecutor);
+  lock.unlock();
+
+  if (reactor)
+  {
+    reactor->shutdown();
+  }
+
+  if (httpExecutor)
+  {
+    httpExecutor->shutdown();
+  }
 }
 
 //-----
@@ -747,6 +801,7 @@ Client& Client::setMirrorNetwork(const std::vector<std::string>& network)
 {
   std::unique_lock lock(mImpl->mMutex);
   mImpl->mMirrorNetwork = std::make_shared<internal::MirrorNetwork>(internal::MirrorNetwork::forNetwork(network));
+  mImpl->mMirrorNetwork->setHttpCompression(mImpl->mHttpCompression);
   return *this;
 }
 
@@ -757,6 +812,103 @@ std::vector<std::string> Client::getMirrorNetwork() const
   return mImpl->mMirrorNetwork ? mImpl->mMirrorNetwork->getNetwork() : std::vector<std::string>();
 }
 
+//-----
+Client& Client::setMirrorResponseCacheSize(size_t maxEntries)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mMirrorResponseCache =
+    (maxEntries == 0ULL) ? nullptr : std::make_shared<internal::MirrorResponseCache>(maxEntries);
+  return *this;
+}
+
+//-----
+size_t Client::getMirrorResponseCacheSize() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mMirrorResponseCache ? mImpl->mMirrorResponseCache->getMaxEntries() : 0ULL;
+}
+
+//-----
+Client& Client::setFeeEstimateCacheTtl(const std::chrono::system_clock::duration& ttl)
+{
+  if (ttl < std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("Fee estimate cache time-to-live cannot be negative");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mFeeEstimateCacheTtl = ttl;
+  mImpl->mFeeEstimateCache = (ttl == std::chrono::system_clock::duration::zero())
+                               ? nullptr
+                               : std::make_shared<internal::MirrorResponseCache>(DEFAULT_MAX_CACHED_FEE_ESTIMATES);
+  return *this;
+}
+
+//-----
+std::chrono::system_clock::duration Client::getFeeEstimateCacheTtl() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mFeeEstimateCacheTtl;
+}
+
+//-----
+Client& Client::setHttpCompression(bool enable)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mHttpCompression = enable;
+  if (mImpl->mMirrorNetwork)
+  {
+    mImpl->mMirrorNetwork->setHttpCompression(enable);
+  }
+
+  return *this;
+}
+
+//-----
+bool Client::isHttpCompression() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mHttpCompression;
+}
+
+//-----
+Client& Client::setQueryCostCacheTtl(const std::chrono::system_clock::duration& ttl)
+{
+  if (ttl < std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("Query cost cache time-to-live cannot be negative");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mQueryCostCacheTtl = ttl;
+  mImpl->mQueryCostCache = (ttl == std::chrono::system_clock::duration::zero())
+                             ? nullptr
+                             : std::make_shared<internal::MirrorResponseCache>(DEFAULT_MAX_CACHED_QUERY_COSTS);
+  return *this;
+}
+
+//-----
+std::chrono::system_clock::duration Client::getQueryCostCacheTtl() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mQueryCostCacheTtl;
+}
+
+//-----
+Client& Client::setPrepayQueries(bool prepay)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mPrepayQueries = prepay;
+  return *this;
+}
+
+//-----
+bool Client::isPrepayQueries() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mPrepayQueries;
+}
+
 //-----
 Client& Client::setLogger(const Logger& logger)
 {
@@ -1120,6 +1272,65 @@ std::shared_ptr<internal::MirrorNetwork> Client::getClientMirrorNetwork() const
   return mImpl->mMirrorNetwork;
 }
 
+//-----
+std::shared_ptr<internal::SubscriptionReactor> Client::getSubscriptionReactor() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  if (mImpl->mClosed)
+  {
+    throw IllegalStateException("Client is closed");
+  }
+
+  if (!mImpl->mSubscriptionReactor)
+  {
+    mImpl->mSubscriptionReactor =
+      std::make_shared<internal::SubscriptionReactor>(DEFAULT_SUBSCRIPTION_POLLER_THREADS,
+                                                      DEFAULT_SUBSCRIPTION_CALLBACK_THREADS,
+                                                      DEFAULT_SUBSCRIPTION_MAX_PENDING_CALLBACKS,
+                                                      mImpl->mLogger);
+  }
+
+  return mImpl->mSubscriptionReactor;
+}
+
+//-----
+std::shared_ptr<internal::HttpExecutor> Client::getHttpExecutor() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  if (mImpl->mClosed)
+  {
+    throw IllegalStateException("Client is closed");
+  }
+
+  if (!mImpl->mHttpExecutor)
+  {
+    mImpl->mHttpExecutor = std::make_shared<internal::HttpExecutor>();
+  }
+
+  return mImpl->mHttpExecutor;
+}
+
+//-----
+std::shared_ptr<internal::MirrorResponseCache> Client::getMirrorResponseCache() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mMirrorResponseCache;
+}
+
+//-----
+std::shared_ptr<internal::MirrorResponseCache> Client::getFeeEstimateCache() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mFeeEstimateCache;
+}
+
+//-----
+std::shared_ptr<internal::MirrorResponseCache> Client::getQueryCostCache() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mQueryCostCache;
+}
+
 //-----
 void Client::setNetworkFromAddressBookInternal(const NodeAddressBook& addressBook)
 {
@@ -9,11 +9,22 @@
 #include "FileId.h"
 #include "PrivateKey.h"
 #include "TransactionReceipt.h"
+#include "exceptions/IllegalStateException.h"
 #include "exceptions/UninitializedException.h"
 #include "impl/Utilities.h"
 
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
 namespace Hiero
 {
+namespace
+{
+// The maximum number of bytecode bytes to put in the FileCreateTransaction. The rest is appended.
+constexpr size_t FILE_CREATE_MAX_BYTES = 2048ULL;
+} // anonymous namespace
+
 //-----
 TransactionResponse ContractCreateFlow::execute(const Client& client)
 {
@@ -24,17 +35,51 @@ TransactionResponse ContractCreateFlow::execute(const Client& client)
 TransactionResponse ContractCreateFlow::execute(const Client& client,
                                                 const std::chrono::system_clock::duration& timeout)
 {
-  // First determine if the input bytecode needs to be split.
+  // Bytecode from a stream or file is read a piece at a time as it's submitted. A stream can only be read once, but a
+  // file is opened again for each execution.
+  std::ifstream bytecodeFile;
+  std::istream* bytecodeStream = mBytecodeStream;
+  if (mBytecodeStream != nullptr)
+  {
+    if (mBytecodeStreamConsumed)
+    {
+      throw IllegalStateException("The bytecode stream was read by a previous execution. Set the bytecode again");
+    }
+
+    mBytecodeStreamConsumed = true;
+  }
+  else if (!mBytecodeFile.empty())
+  {
+    bytecodeFile.open(mBytecodeFile, std::ios_base::binary);
+    if (!bytecodeFile.is_open())
+    {
+      throw std::invalid_argument("Bytecode file cannot be found at " + mBytecodeFile);
+    }
+
+    bytecodeStream = &bytecodeFile;
+  }
+
+  // First determine if the input bytecode needs to be split. The bytecode set on this flow is left as it is, so that it
+  // can be executed again.
+  std::vector<std::byte> createdByteCode;
   std::vector<std::byte> appendedByteCode;
-  if (mBytecode.size() > 2048ULL)
+  if (bytecodeStream != nullptr)
   {
-    appendedByteCode = internal::Utilities::removePrefix(mBytecode, 2048);
-    mBytecode = { mBytecode.cbegin(), mBytecode.cbegin() + 2048 };
+    createdByteCode = internal::Utilities::readBytes(*bytecodeStream, FILE_CREATE_MAX_BYTES);
+  }
+  else if (mBytecode.size() > FILE_CREATE_MAX_BYTES)
+  {
+    createdByteCode = { mBytecode.cbegin(), mBytecode.cbegin() + static_cast<long>(FILE_CREATE_MAX_BYTES) };
+    appendedByteCode = internal::Utilities::removePrefix(mBytecode, static_cast<long>(FILE_CREATE_MAX_BYTES));
+  }
+  else
+  {
+    createdByteCode = mBytecode;
   }
 
   // Create the file.
   FileCreateTransaction fileCreateTransaction =
-    FileCreateTransaction().setKeys({ client.getOperatorPublicKey() }).setContents(mBytecode);
+    FileCreateTransaction().setKeys({ client.getOperatorPublicKey() }).setContents(createdByteCode);
 
   if (!mNodeAccountIds.empty())
   {
@@ -44,10 +89,10 @@ TransactionResponse ContractCreateFlow::execute(const Client& client,
   const FileId fileId = fileCreateTransaction.execute(client, timeout).getReceipt(client, timeout).mFileId.value();
 
   // Append to the file if needed.
-  if (!appendedByteCode.empty())
+  const auto appendToFile = [this, &client, &timeout, &fileId](const std::vector<std::byte>& contents)
   {
     FileAppendTransaction fileAppendTransaction =
-      FileAppendTransaction().setFileId(fileId).setContents(appendedByteCode).setMaxChunks(mMaxChunks);
+      FileAppendTransaction().setFileId(fileId).setContents(contents).setMaxChunks(mMaxChunks);
 
     if (!mNodeAccountIds.empty())
     {
@@ -55,6 +100,28 @@ TransactionResponse ContractCreateFlow::execute(const Client& client,
     }
 
     fileAppendTransaction.execute(client, timeout);
+  };
+
+  if (bytecodeStream != nullptr)
+  {
+    // Each FileAppendTransaction appends as much of the stream as fits in its maximum number of chunks, so only that
+    // much of the bytecode is in memory at once.
+    const size_t appendSize = static_cast<size_t>(FileAppendTransaction::DEFAULT_CHUNK_SIZE) * mMaxChunks;
+    for (std::vector<std::byte> contents = internal::Utilities::readBytes(*bytecodeStream, appendSize);
+         !contents.empty();
+         contents = internal::Utilities::readBytes(*bytecodeStream, appendSize))
+    {
+      appendToFile(contents);
+    }
+
+    if (bytecodeStream->bad())
+    {
+      throw std::invalid_argument("Unable to read the bytecode stream");
+    }
+  }
+  else if (!appendedByteCode.empty())
+  {
+    appendToFile(appendedByteCode);
   }
 
   // Create the smart contract instance using the bytecode in the file.
@@ -127,6 +194,8 @@ TransactionResponse ContractCreateFlow::execute(const Client& client,
 ContractCreateFlow& ContractCreateFlow::setBytecode(const std::vector<std::byte>& initCode)
 {
   mBytecode = initCode;
+  mBytecodeStream = nullptr;
+  mBytecodeFile.clear();
   return *this;
 }
 
@@ -134,6 +203,25 @@ ContractCreateFlow& ContractCreateFlow::setBytecode(const std::vector<std::byte>
 ContractCreateFlow& ContractCreateFlow::setBytecode(std::string_view byteCode)
 {
   mBytecode = internal::Utilities::stringToByteVector(byteCode);
+  mBytecodeStream = nullptr;
+  mBytecodeFile.clear();
+  return *this;
+}
+
+//-----
+ContractCreateFlow& ContractCreateFlow::setBytecode(std::istream& byteCode)
+{
+  mBytecodeStream = &byteCode;
+  mBytecodeStreamConsumed = false;
+  mBytecodeFile.clear();
+  return *this;
+}
+
+//-----
+ContractCreateFlow& ContractCreateFlow::setBytecodeFile(std::string_view path)
+{
+  mBytecodeFile = path;
+  mBytecodeStream = nullptr;
   return *this;
 }
 
@@ -11,18 +11,19 @@
 #include "impl/Utilities.h"
 #include "impl/openssl_utils/BIGNUM.h"
 #include "impl/openssl_utils/ECDSA_SIG.h"
-#include "impl/openssl_utils/EVP_MD.h"
 #include "impl/openssl_utils/EVP_MD_CTX.h"
-#include "impl/openssl_utils/OSSL_LIB_CTX.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 #include "impl/openssl_utils/Secp256k1Context.h"
 
+#include <openssl/crypto.h>
 #include <openssl/ec.h>
 #include <openssl/x509.h>
 
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 #include <services/basic_types.pb.h>
@@ -35,6 +36,8 @@ namespace
 const std::vector<std::byte> BIP32_SEED = { std::byte('B'), std::byte('i'), std::byte('t'), std::byte('c'),
                                             std::byte('o'), std::byte('i'), std::byte('n'), std::byte(' '),
                                             std::byte('s'), std::byte('e'), std::byte('e'), std::byte('d') };
+// The size of the seed used to randomize the shared secp256k1 context.
+constexpr int SECP256K1_SEED_SIZE = 32;
 // The order of the secp256k1 curve.
 const internal::OpenSSLUtils::BIGNUM CURVE_ORDER =
   internal::OpenSSLUtils::BIGNUM::fromHex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141");
@@ -113,6 +116,148 @@ const internal::OpenSSLUtils::BIGNUM CURVE_ORDER =
   return outputLen == expectedPubKey.size() && std::memcmp(serializedPubKey, expectedPubKey.data(), outputLen) == 0;
 }
 
+/**
+ * Get the process-wide secp256k1 context. It is created and randomized once on first use and never modified again, so
+ * it can be shared by all threads for signing and recovery. Signing uses the precomputed tables from
+ * secp256k1_precomputed, so no per-context table generation is needed.
+ *
+ * @return A pointer to the shared secp256k1 context, or nullptr if it could not be created.
+ */
+[[nodiscard]] const secp256k1_context* getSecp256k1Context()
+{
+  static const internal::OpenSSLUtils::Secp256k1Context context = []()
+  {
+    internal::OpenSSLUtils::Secp256k1Context ctx(secp256k1_context_create(SECP256K1_CONTEXT_NONE));
+    if (ctx)
+    {
+      // Randomization only adds side-channel blinding, so a context that couldn't be randomized is still usable.
+      try
+      {
+        const std::vector<std::byte> seed = internal::OpenSSLUtils::getRandomBytes(SECP256K1_SEED_SIZE);
+        static_cast<void>(
+          secp256k1_context_randomize(ctx.get(), internal::Utilities::toTypePtr<unsigned char>(seed.data())));
+      }
+      catch (const OpenSSLException&)
+      {
+      }
+    }
+
+    return ctx;
+  }();
+
+  return context.get();
+}
+
+/**
+ * Sign a Keccak-256 message hash with libsecp256k1. The produced signature is already normalized to lower-S form.
+ *
+ * @param ctx         The secp256k1 context.
+ * @param messageHash The 32-byte Keccak-256 hash of the message to sign.
+ * @param privateKey  The 32 raw private key bytes.
+ * @return The 64-byte compact signature (r || s), or an empty vector if libsecp256k1 couldn't sign with the key.
+ */
+[[nodiscard]] std::vector<std::byte> signWithSecp256k1(const secp256k1_context* ctx,
+                                                       const std::vector<std::byte>& messageHash,
+                                                       const unsigned char* privateKey)
+{
+  secp256k1_ecdsa_signature signature;
+  if (secp256k1_ecdsa_sign(ctx,
+                           &signature,
+                           internal::Utilities::toTypePtr<unsigned char>(messageHash.data()),
+                           privateKey,
+                           nullptr,
+                           nullptr) != 1)
+  {
+    return {};
+  }
+
+  std::vector<std::byte> outputArray(ECDSAsecp256k1PrivateKey::RAW_SIGNATURE_SIZE);
+  secp256k1_ecdsa_signature_serialize_compact(
+    ctx, internal::Utilities::toTypePtr<unsigned char>(outputArray.data()), &signature);
+  return outputArray;
+}
+
+/**
+ * Sign bytes with OpenSSL. This is the fallback for when libsecp256k1 can't be used.
+ *
+ * @param key         The wrapped OpenSSL key object with which to sign.
+ * @param bytesToSign The bytes to sign.
+ * @return The 64-byte raw signature (r || s).
+ * @throws OpenSSLException If OpenSSL is unable to generate a signature.
+ */
+[[nodiscard]] std::vector<std::byte> signWithOpenSSL(internal::OpenSSLUtils::EVP_PKEY key,
+                                                     const std::vector<std::byte>& bytesToSign)
+{
+  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
+  if (!messageDigestContext)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
+  }
+
+  if (EVP_DigestSignInit(messageDigestContext.get(),
+                         nullptr,
+                         internal::OpenSSLUtils::getKECCAK256MessageDigest(),
+                         nullptr,
+                         key.get()) <= 0)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestSignInit"));
+  }
+
+  // 72 is the maximum required size. actual signature may be slightly smaller
+  size_t signatureLength = ECDSAsecp256k1PrivateKey::MAX_SIGNATURE_SIZE;
+  std::vector<std::byte> signature(signatureLength);
+
+  if (EVP_DigestSign(messageDigestContext.get(),
+                     internal::Utilities::toTypePtr<unsigned char>(signature.data()),
+                     &signatureLength,
+                     internal::Utilities::toTypePtr<unsigned char>(bytesToSign.data()),
+                     bytesToSign.size()) <= 0)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestSign"));
+  }
+
+  // we have the signature complete, now we need to turn it into its raw form of (r,s)
+
+  const unsigned char* signaturePointer = internal::Utilities::toTypePtr<unsigned char>(signature.data());
+  const internal::OpenSSLUtils::ECDSA_SIG signatureObject(
+    d2i_ECDSA_SIG(nullptr, &signaturePointer, static_cast<long>(signatureLength)));
+  if (!signatureObject)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("d2i_ECDSA_SIG"));
+  }
+
+  const BIGNUM* signatureR = ECDSA_SIG_get0_r(signatureObject.get());
+  if (!signatureR)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("ECDSA_SIG_get0_r"));
+  }
+
+  const BIGNUM* signatureS = ECDSA_SIG_get0_s(signatureObject.get());
+  if (!signatureS)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("ECDSA_SIG_get0_s"));
+  }
+
+  // signature is returned in the raw, 64 byte form (r, s)
+  std::vector<std::byte> outputArray(ECDSAsecp256k1PrivateKey::RAW_SIGNATURE_SIZE);
+
+  if (BN_bn2binpad(signatureR,
+                   internal::Utilities::toTypePtr<unsigned char>(outputArray.data()),
+                   ECDSAsecp256k1PrivateKey::R_SIZE) <= 0)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("BN_bn2binpad"));
+  }
+
+  if (BN_bn2binpad(signatureS,
+                   internal::Utilities::toTypePtr<unsigned char>(outputArray.data()) + ECDSAsecp256k1PrivateKey::R_SIZE,
+                   ECDSAsecp256k1PrivateKey::S_SIZE) <= 0)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("BN_bn2binpad"));
+  }
+
+  return outputArray;
+}
+
 } // namespace
 
 //-----
@@ -230,79 +375,21 @@ std::unique_ptr<PrivateKey> ECDSAsecp256k1PrivateKey::derive(uint32_t childIndex
 //-----
 std::vector<std::byte> ECDSAsecp256k1PrivateKey::sign(const std::vector<std::byte>& bytesToSign) const
 {
-  internal::OpenSSLUtils::OSSL_LIB_CTX libraryContext(OSSL_LIB_CTX_new());
-  if (!libraryContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("OSSL_LIB_CTX_new"));
-  }
-
-  const internal::OpenSSLUtils::EVP_MD messageDigest(EVP_MD_fetch(libraryContext.get(), "KECCAK-256", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_fetch"));
-  }
-
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
-  }
-
-  if (EVP_DigestSignInit(messageDigestContext.get(), nullptr, messageDigest.get(), nullptr, getInternalKey().get()) <=
-      0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestSignInit"));
-  }
-
-  // 72 is the maximum required size. actual signature may be slightly smaller
-  size_t signatureLength = MAX_SIGNATURE_SIZE;
-  std::vector<std::byte> signature(signatureLength);
-
-  if (EVP_DigestSign(messageDigestContext.get(),
-                     internal::Utilities::toTypePtr<unsigned char>(signature.data()),
-                     &signatureLength,
-                     internal::Utilities::toTypePtr<unsigned char>(bytesToSign.data()),
-                     bytesToSign.size()) <= 0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestSign"));
-  }
-
-  // we have the signature complete, now we need to turn it into its raw form of (r,s)
-
-  const unsigned char* signaturePointer = internal::Utilities::toTypePtr<unsigned char>(signature.data());
-  const internal::OpenSSLUtils::ECDSA_SIG signatureObject(
-    d2i_ECDSA_SIG(nullptr, &signaturePointer, static_cast<long>(signatureLength)));
-  if (!signatureObject)
+  // Prefer libsecp256k1, which signs the Keccak-256 hash directly into the compact (r,s) form. OpenSSL is only used if
+  // the shared context couldn't be created or libsecp256k1 rejected the key.
+  if (const secp256k1_context* context = getSecp256k1Context(); context)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("d2i_ECDSA_SIG"));
-  }
-
-  const BIGNUM* signatureR = ECDSA_SIG_get0_r(signatureObject.get());
-  if (!signatureR)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("ECDSA_SIG_get0_r"));
-  }
-
-  const BIGNUM* signatureS = ECDSA_SIG_get0_s(signatureObject.get());
-  if (!signatureS)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("ECDSA_SIG_get0_s"));
-  }
-
-  // signature is returned in the raw, 64 byte form (r, s)
-  std::vector<std::byte> outputArray(RAW_SIGNATURE_SIZE);
-
-  if (BN_bn2binpad(signatureR, internal::Utilities::toTypePtr<unsigned char>(outputArray.data()), R_SIZE) <= 0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("BN_bn2binpad"));
-  }
-
-  if (BN_bn2binpad(signatureS, internal::Utilities::toTypePtr<unsigned char>(outputArray.data()) + R_SIZE, S_SIZE) <= 0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("BN_bn2binpad"));
+    std::vector<std::byte> signature =
+      signWithSecp256k1(context,
+                        internal::OpenSSLUtils::computeKECCAK256(bytesToSign),
+                        internal::Utilities::toTypePtr<unsigned char>(mSecret->mBytes.data()));
+    if (!signature.empty())
+    {
+      return signature;
+    }
   }
 
-  return outputArray;
+  return signWithOpenSSL(getInternalKey(), bytesToSign);
 }
 
 //-----
@@ -328,8 +415,8 @@ int ECDSAsecp256k1PrivateKey::getRecoveryId(const std::vector<std::byte>& r,
   const std::vector<std::byte> expectedPubKeyBytes =
     ECDSAsecp256k1PublicKey::uncompressBytes(getPublicKey()->toBytesRaw());
 
-  // Create a secp256k1 context for verification/recovery using RAII.
-  internal::OpenSSLUtils::Secp256k1Context ctx(secp256k1_context_create(SECP256K1_CONTEXT_NONE));
+  // Use the shared secp256k1 context for recovery.
+  const secp256k1_context* ctx = getSecp256k1Context();
   if (!ctx)
   {
     return -1;
@@ -338,7 +425,7 @@ int ECDSAsecp256k1PrivateKey::getRecoveryId(const std::vector<std::byte>& r,
   // Try each recovery ID (0-3) and check which one recovers our public key.
   for (int recId = 0; recId < 4; ++recId)
   {
-    if (tryRecoverWithId(ctx.get(),
+    if (tryRecoverWithId(ctx,
                          compactSig.data(),
                          recId,
                          reinterpret_cast<const unsigned char*>(messageHash.data()),
@@ -378,26 +465,41 @@ std::vector<std::byte> ECDSAsecp256k1PrivateKey::toBytesDer() const
 //-----
 std::vector<std::byte> ECDSAsecp256k1PrivateKey::toBytesRaw() const
 {
-  std::vector<std::byte> outputBytes(i2d_PrivateKey(getInternalKey().get(), nullptr));
+  return { mSecret->mBytes.cbegin(), mSecret->mBytes.cend() };
+}
 
-  if (auto rawBytes = internal::Utilities::toTypePtr<unsigned char>(outputBytes.data());
-      i2d_PrivateKey(getInternalKey().get(), &rawBytes) <= 0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("i2d_PrivateKey"));
-  }
+//-----
+struct ECDSAsecp256k1PrivateKey::Secret
+{
+  ~Secret() { OPENSSL_cleanse(mBytes.data(), mBytes.size()); }
 
-  // The return value of i2d_PrivateKey can be either 48 or 118 bytes, depending on how the private key was constructed.
-  // This difference doesn't change anything with the return here: the first 7 bytes of each are algorithm identifiers,
-  // the next 32 are private key bytes, and the rest are for other purposes.
-  return { outputBytes.cbegin() + static_cast<long>(internal::asn1::ASN1_PRK_PREFIX_BYTES.size()),
-           outputBytes.cbegin() + static_cast<long>(internal::asn1::ASN1_PRK_PREFIX_BYTES.size()) + KEY_SIZE };
-}
+  std::array<std::byte, KEY_SIZE> mBytes{};
+};
 
 //-----
 ECDSAsecp256k1PrivateKey::ECDSAsecp256k1PrivateKey(internal::OpenSSLUtils::EVP_PKEY&& key,
                                                    std::vector<std::byte> chainCode)
   : PrivateKey(std::move(key), std::move(chainCode))
 {
+  // Only copy the internal key once, since every copy duplicates the whole OpenSSL key object.
+  const internal::OpenSSLUtils::EVP_PKEY internalKey = getInternalKey();
+  std::vector<std::byte> outputBytes(i2d_PrivateKey(internalKey.get(), nullptr));
+
+  if (auto rawBytes = internal::Utilities::toTypePtr<unsigned char>(outputBytes.data());
+      i2d_PrivateKey(internalKey.get(), &rawBytes) <= 0)
+  {
+    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("i2d_PrivateKey"));
+  }
+
+  // The return value of i2d_PrivateKey can be either 48 or 118 bytes, depending on how the private key was constructed.
+  // This difference doesn't change anything here: the first 7 bytes of each are algorithm identifiers, the next 32 are
+  // private key bytes, and the rest are for other purposes. The encoding is cleansed once the key bytes are copied out.
+  auto secret = std::make_shared<Secret>();
+  std::copy_n(outputBytes.cbegin() + static_cast<long>(internal::asn1::ASN1_PRK_PREFIX_BYTES.size()),
+              KEY_SIZE,
+              secret->mBytes.begin());
+  OPENSSL_cleanse(outputBytes.data(), outputBytes.size());
+  mSecret = std::move(secret);
 }
 
 } // namespace Hiero
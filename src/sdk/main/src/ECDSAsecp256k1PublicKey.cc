@@ -4,6 +4,7 @@
 #include "EvmAddress.h"
 #include "exceptions/BadKeyException.h"
 #include "exceptions/OpenSSLException.h"
+#include "exceptions/UninitializedException.h"
 
 #include "impl/ASN1ECPublicKey.h"
 #include "impl/HexConverter.h"
@@ -14,10 +15,9 @@
 #include "impl/openssl_utils/ECDSA_SIG.h"
 #include "impl/openssl_utils/EC_GROUP.h"
 #include "impl/openssl_utils/EC_POINT.h"
-#include "impl/openssl_utils/EVP_MD.h"
 #include "impl/openssl_utils/EVP_MD_CTX.h"
+#include "impl/openssl_utils/KeyDigestContext.h"
 #include "impl/openssl_utils/OSSL_DECODER_CTX.h"
-#include "impl/openssl_utils/OSSL_LIB_CTX.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <openssl/decoder.h>
@@ -309,29 +309,13 @@ bool ECDSAsecp256k1PublicKey::verifySignature(const std::vector<std::byte>& sign
     throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("i2d_ECDSA_SIG"));
   }
 
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
+  if (!mVerifyContext)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
+    throw UninitializedException("ECDSAsecp256k1PublicKey has no key with which to verify");
   }
 
-  internal::OpenSSLUtils::OSSL_LIB_CTX libraryContext(OSSL_LIB_CTX_new());
-  if (!libraryContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("OSSL_LIB_CTX_new"));
-  }
-
-  const internal::OpenSSLUtils::EVP_MD messageDigest(EVP_MD_fetch(libraryContext.get(), "KECCAK-256", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_fetch"));
-  }
-
-  if (EVP_DigestVerifyInit(messageDigestContext.get(), nullptr, messageDigest.get(), nullptr, getInternalKey().get()) <=
-      0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestVerifyInit"));
-  }
+  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext =
+    mVerifyContext->getContext([this]() { return getInternalKey(); });
 
   const int verificationResult =
     EVP_DigestVerify(messageDigestContext.get(),
@@ -412,6 +396,9 @@ EvmAddress ECDSAsecp256k1PublicKey::toEvmAddress() const
 //-----
 ECDSAsecp256k1PublicKey::ECDSAsecp256k1PublicKey(internal::OpenSSLUtils::EVP_PKEY&& key)
   : PublicKey(std::move(key))
+  , mVerifyContext(std::make_shared<internal::OpenSSLUtils::KeyDigestContext>(
+      internal::OpenSSLUtils::KeyDigestContext::Operation::VERIFY,
+      internal::OpenSSLUtils::getKECCAK256MessageDigest()))
 {
 }
 
@@ -12,6 +12,7 @@
 #include "impl/openssl_utils/EVP_MD_CTX.h"
 #include "impl/openssl_utils/EVP_PKEY.h"
 #include "impl/openssl_utils/EVP_PKEY_CTX.h"
+#include "impl/openssl_utils/KeyDigestContext.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <openssl/x509.h>
@@ -166,16 +167,13 @@ std::unique_ptr<proto::Key> ED25519PrivateKey::toProtobufKey() const
 //-----
 std::vector<std::byte> ED25519PrivateKey::sign(const std::vector<std::byte>& bytesToSign) const
 {
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
+  if (!mSignContext)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
+    throw UninitializedException("ED25519PrivateKey has no key with which to sign");
   }
 
-  if (EVP_DigestSignInit(messageDigestContext.get(), nullptr, nullptr, nullptr, getInternalKey().get()) <= 0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestSignInit"));
-  }
+  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext =
+    mSignContext->getContext([this]() { return getInternalKey(); });
 
   // Calculate the required size for the signature
   size_t signatureLength;
@@ -272,6 +270,8 @@ std::unique_ptr<PrivateKey> ED25519PrivateKey::derive(uint32_t childIndex) const
 //-----
 ED25519PrivateKey::ED25519PrivateKey(internal::OpenSSLUtils::EVP_PKEY&& key, std::vector<std::byte> chainCode)
   : PrivateKey(std::move(key), std::move(chainCode))
+  , mSignContext(std::make_shared<internal::OpenSSLUtils::KeyDigestContext>(
+      internal::OpenSSLUtils::KeyDigestContext::Operation::SIGN))
 {
 }
 
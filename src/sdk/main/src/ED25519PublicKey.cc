@@ -2,11 +2,13 @@
 #include "ED25519PublicKey.h"
 #include "exceptions/BadKeyException.h"
 #include "exceptions/OpenSSLException.h"
+#include "exceptions/UninitializedException.h"
 #include "impl/ASN1ED25519PublicKey.h"
 #include "impl/HexConverter.h"
 #include "impl/PublicKeyImpl.h"
 #include "impl/Utilities.h"
 #include "impl/openssl_utils/EVP_MD_CTX.h"
+#include "impl/openssl_utils/KeyDigestContext.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <openssl/x509.h>
@@ -112,16 +114,13 @@ std::unique_ptr<proto::Key> ED25519PublicKey::toProtobufKey() const
 bool ED25519PublicKey::verifySignature(const std::vector<std::byte>& signatureBytes,
                                        const std::vector<std::byte>& signedBytes) const
 {
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
+  if (!mVerifyContext)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
+    throw UninitializedException("ED25519PublicKey has no key with which to verify");
   }
 
-  if (EVP_DigestVerifyInit(messageDigestContext.get(), nullptr, nullptr, nullptr, getInternalKey().get()) <= 0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestVerifyInit"));
-  }
+  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext =
+    mVerifyContext->getContext([this]() { return getInternalKey(); });
 
   const int verificationResult = EVP_DigestVerify(messageDigestContext.get(),
                                                   internal::Utilities::toTypePtr<unsigned char>(signatureBytes.data()),
@@ -191,6 +190,8 @@ std::unique_ptr<proto::SignaturePair> ED25519PublicKey::toSignaturePairProtobuf(
 //-----
 ED25519PublicKey::ED25519PublicKey(internal::OpenSSLUtils::EVP_PKEY&& key)
   : PublicKey(std::move(key))
+  , mVerifyContext(std::make_shared<internal::OpenSSLUtils::KeyDigestContext>(
+      internal::OpenSSLUtils::KeyDigestContext::Operation::VERIFY))
 {
 }
 
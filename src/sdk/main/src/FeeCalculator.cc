@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "FeeCalculator.h"
+#include "Client.h"
+#include "FeeComponents.h"
+#include "FeeData.h"
+#include "FeeSchedule.h"
+#include "FileContentsQuery.h"
+#include "FileId.h"
+#include "TransactionFeeSchedule.h"
+#include "WrappedTransaction.h"
+
+#include <services/transaction.pb.h>
+#include <services/transaction_contents.pb.h>
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace Hiero
+{
+namespace
+{
+// The number of bytes an ED25519 signature adds to a transaction: the public key prefix and signature, and the
+// framing of the signature pair.
+constexpr size_t ED25519_SIGNATURE_BYTES = 104ULL;
+
+// The fee schedule entry of each transaction type that can be priced.
+const std::unordered_map<proto::TransactionBody::DataCase, RequestType> gDataCaseToRequestType = {
+  {proto::TransactionBody::kCryptoApproveAllowance,  RequestType::CRYPTO_APPROVE_ALLOWANCE     },
+  { proto::TransactionBody::kCryptoCreateAccount,    RequestType::CRYPTO_CREATE                },
+  { proto::TransactionBody::kCryptoDelete,           RequestType::CRYPTO_DELETE                },
+  { proto::TransactionBody::kCryptoDeleteAllowance,  RequestType::CRYPTO_DELETE_ALLOWANCE      },
+  { proto::TransactionBody::kCryptoTransfer,         RequestType::CRYPTO_TRANSFER              },
+  { proto::TransactionBody::kCryptoUpdateAccount,    RequestType::CRYPTO_UPDATE                },
+  { proto::TransactionBody::kConsensusCreateTopic,   RequestType::CONSENSUS_CREATE_TOPIC       },
+  { proto::TransactionBody::kConsensusDeleteTopic,   RequestType::CONSENSUS_DELETE_TOPIC       },
+  { proto::TransactionBody::kConsensusSubmitMessage, RequestType::CONSENSUS_SUBMIT_MESSAGE     },
+  { proto::TransactionBody::kConsensusUpdateTopic,   RequestType::CONSENSUS_UPDATE_TOPIC       },
+  { proto::TransactionBody::kContractCall,           RequestType::CONTRACT_CALL                },
+  { proto::TransactionBody::kContractCreateInstance, RequestType::CONTRACT_CREATE              },
+  { proto::TransactionBody::kContractDeleteInstance, RequestType::CONTRACT_DELETE              },
+  { proto::TransactionBody::kContractUpdateInstance, RequestType::CONTRACT_UPDATE              },
+  { proto::TransactionBody::kEthereumTransaction,    RequestType::ETHEREUM_TRANSACTION         },
+  { proto::TransactionBody::kFileAppend,             RequestType::FILE_APPEND                  },
+  { proto::TransactionBody::kFileCreate,             RequestType::FILE_CREATE                  },
+  { proto::TransactionBody::kFileDelete,             RequestType::FILE_DELETE                  },
+  { proto::TransactionBody::kFileUpdate,             RequestType::FILE_UPDATE                  },
+  { proto::TransactionBody::kFreeze,                 RequestType::FREEZE                       },
+  { proto::TransactionBody::kScheduleCreate,         RequestType::SCHEDULE_CREATE              },
+  { proto::TransactionBody::kScheduleDelete,         RequestType::SCHEDULE_DELETE              },
+  { proto::TransactionBody::kScheduleSign,           RequestType::SCHEDULE_SIGN                },
+  { proto::TransactionBody::kSystemDelete,           RequestType::SYSTEM_DELETE                },
+  { proto::TransactionBody::kSystemUndelete,         RequestType::SYSTEM_UNDELETE              },
+  { proto::TransactionBody::kTokenAssociate,         RequestType::TOKEN_ASSOCIATE_TO_ACCOUNT   },
+  { proto::TransactionBody::kTokenBurn,              RequestType::TOKEN_BURN                   },
+  { proto::TransactionBody::kTokenCreation,          RequestType::TOKEN_CREATE                 },
+  { proto::TransactionBody::kTokenDeletion,          RequestType::TOKEN_DELETE                 },
+  { proto::TransactionBody::kTokenDissociate,        RequestType::TOKEN_DISSOCIATE_FROM_ACCOUNT},
+  { proto::TransactionBody::kTokenFeeScheduleUpdate, RequestType::TOKEN_FEE_SCHEDULE_UPDATE    },
+  { proto::TransactionBody::kTokenFreeze,            RequestType::TOKEN_FREEZE_ACCOUNT         },
+  { proto::TransactionBody::kTokenGrantKyc,          RequestType::TOKEN_GRANT_KYC_TO_ACCOUNT   },
+  { proto::TransactionBody::kTokenMint,              RequestType::TOKEN_MINT                   },
+  { proto::TransactionBody::kTokenPause,             RequestType::TOKEN_PAUSE                  },
+  { proto::TransactionBody::kTokenRevokeKyc,         RequestType::TOKEN_REVOKE_KYC_FROM_ACCOUNT},
+  { proto::TransactionBody::kTokenUnfreeze,          RequestType::TOKEN_UNFREEZE_ACCOUNT       },
+  { proto::TransactionBody::kTokenUnpause,           RequestType::TOKEN_UNPAUSE                },
+  { proto::TransactionBody::kTokenUpdate,            RequestType::TOKEN_UPDATE                 },
+  { proto::TransactionBody::kTokenUpdateNfts,        RequestType::TOKEN_UPDATE_NFTS            },
+  { proto::TransactionBody::kTokenWipe,              RequestType::TOKEN_ACCOUNT_WIPE           },
+  { proto::TransactionBody::kUtilPrng,               RequestType::UTIL_PRNG                    },
+};
+
+//-----
+// Price one component of a fee, in tinycents. Fee schedule prices are in thousandths of a tinycent.
+int64_t priceComponent(const FeeComponents& prices, size_t transactionBytes, size_t signatures)
+{
+  int64_t fee = prices.getConstant() + prices.getTransactionBandwidthBytes() * static_cast<int64_t>(transactionBytes) +
+                prices.getTransactionVerification() * static_cast<int64_t>(signatures);
+
+  fee = std::max(fee, prices.getMin());
+  if (prices.getMax() > 0LL)
+  {
+    fee = std::min(fee, prices.getMax());
+  }
+
+  return fee / 1000LL;
+}
+
+} // anonymous namespace
+
+//-----
+struct FeeCalculator::FeeTables
+{
+  // The fee schedule entries of one fee schedule, by request type and scope.
+  using Entries = std::map<std::pair<RequestType, FeeDataType>, FeeData>;
+
+  FeeTables(const FeeSchedules& feeSchedules, const ExchangeRates& exchangeRates)
+    : mCurrentEntries(index(feeSchedules.getCurrent()))
+    , mNextEntries(index(feeSchedules.getNext()))
+    , mCurrentExpirationTime(feeSchedules.getCurrent().getExpirationTime())
+    , mNextExpirationTime(feeSchedules.getNext().getExpirationTime())
+    , mExchangeRates(exchangeRates)
+  {
+    if (exchangeRates.mCurrentRate.mCents <= 0 || exchangeRates.mNextRate.mCents <= 0)
+    {
+      throw std::invalid_argument("Exchange rates must be worth a positive number of cents");
+    }
+  }
+
+  // Index the entries of a fee schedule.
+  [[nodiscard]] static Entries index(const FeeSchedule& schedule)
+  {
+    Entries entries;
+    for (const TransactionFeeSchedule& transactionSchedule : schedule.getTransactionFeeSchedules())
+    {
+      for (const FeeData& fee : transactionSchedule.getFees())
+      {
+        entries.try_emplace({ transactionSchedule.getRequestType(), fee.getType() }, fee);
+      }
+    }
+
+    return entries;
+  }
+
+  // The entries of the current and next fee schedules.
+  Entries mCurrentEntries;
+  Entries mNextEntries;
+
+  // The times at which the current and next fee schedules expire.
+  std::chrono::system_clock::time_point mCurrentExpirationTime;
+  std::chrono::system_clock::time_point mNextExpirationTime;
+
+  // The current and next exchange rates.
+  ExchangeRates mExchangeRates;
+};
+
+//-----
+FeeCalculator::FeeCalculator(const FeeSchedules& feeSchedules, const ExchangeRates& exchangeRates)
+  : mTables(std::make_shared<const FeeTables>(feeSchedules, exchangeRates))
+{
+}
+
+//-----
+FeeCalculator FeeCalculator::fromNetwork(const Client& client)
+{
+  return FeeCalculator(FeeSchedules::fromBytes(FileContentsQuery().setFileId(FileId::FEE_SCHEDULE).execute(client)),
+                       ExchangeRates::fromBytes(FileContentsQuery().setFileId(FileId::EXCHANGE_RATES).execute(client)));
+}
+
+//-----
+void FeeCalculator::update(const FeeSchedules& feeSchedules, const ExchangeRates& exchangeRates)
+{
+  // Index outside the lock, so that pricing isn't held up.
+  auto tables = std::make_shared<const FeeTables>(feeSchedules, exchangeRates);
+
+  std::unique_lock lock(mMutex);
+  mTables = std::move(tables);
+}
+
+//-----
+void FeeCalculator::refresh(const Client& client)
+{
+  update(FeeSchedules::fromBytes(FileContentsQuery().setFileId(FileId::FEE_SCHEDULE).execute(client)),
+         ExchangeRates::fromBytes(FileContentsQuery().setFileId(FileId::EXCHANGE_RATES).execute(client)));
+}
+
+//-----
+bool FeeCalculator::refreshIfExpired(const Client& client)
+{
+  if (!isExpired())
+  {
+    return false;
+  }
+
+  refresh(client);
+  return true;
+}
+
+//-----
+bool FeeCalculator::isExpired(const std::chrono::system_clock::time_point& time) const
+{
+  std::shared_ptr<const FeeTables> tables;
+  {
+    std::unique_lock lock(mMutex);
+    tables = mTables;
+  }
+
+  return time >= tables->mNextExpirationTime || time >= tables->mExchangeRates.mNextRate.mExpirationTime;
+}
+
+//-----
+Hbar FeeCalculator::calculateFee(const WrappedTransaction& transaction,
+                                 const std::chrono::system_clock::time_point& time) const
+{
+  return calculateFee(*transaction.toProtobufTransaction(), time);
+}
+
+//-----
+Hbar FeeCalculator::calculateFee(const proto::Transaction& transaction,
+                                 const std::chrono::system_clock::time_point& time) const
+{
+  proto::SignedTransaction signedTx;
+  proto::TransactionBody body;
+  if (!signedTx.ParseFromString(transaction.signedtransactionbytes()) || !body.ParseFromString(signedTx.bodybytes()))
+  {
+    throw std::invalid_argument("Unable to parse transaction");
+  }
+
+  const auto iter = gDataCaseToRequestType.find(body.data_case());
+  if (iter == gDataCaseToRequestType.cend())
+  {
+    throw std::invalid_argument("Transaction type has no fee schedule entry");
+  }
+
+  size_t transactionBytes = transaction.ByteSizeLong();
+  auto signatures = static_cast<size_t>(signedTx.sigmap().sigpair_size());
+  if (signatures == 0ULL)
+  {
+    transactionBytes += ED25519_SIGNATURE_BYTES;
+    signatures = 1ULL;
+  }
+
+  return calculateFee(iter->second, transactionBytes, signatures, FeeDataType::DEFAULT, time);
+}
+
+//-----
+Hbar FeeCalculator::calculateFee(RequestType type,
+                                 size_t transactionBytes,
+                                 size_t signatures,
+                                 FeeDataType subType,
+                                 const std::chrono::system_clock::time_point& time) const
+{
+  std::shared_ptr<const FeeTables> tables;
+  {
+    std::unique_lock lock(mMutex);
+    tables = mTables;
+  }
+
+  const FeeTables::Entries& entries =
+    (time < tables->mCurrentExpirationTime) ? tables->mCurrentEntries : tables->mNextEntries;
+  auto iter = entries.find({ type, subType });
+  if (iter == entries.cend())
+  {
+    iter = entries.find({ type, FeeDataType::DEFAULT });
+  }
+
+  if (iter == entries.cend())
+  {
+    throw std::invalid_argument("Fee schedule has no entry for request type " + gRequestTypeToString.at(type));
+  }
+
+  const FeeData& fee = iter->second;
+  const int64_t tinycents = priceComponent(fee.getNodeData(), transactionBytes, signatures) +
+                            priceComponent(fee.getNetworkData(), transactionBytes, signatures) +
+                            priceComponent(fee.getServiceData(), transactionBytes, signatures);
+
+  // Convert at the exchange rate in effect at the time, splitting the division to keep the product in range.
+  const ExchangeRate& rate = (time < tables->mExchangeRates.mCurrentRate.mExpirationTime)
+                               ? tables->mExchangeRates.mCurrentRate
+                               : tables->mExchangeRates.mNextRate;
+  return Hbar::fromTinybars(tinycents / rate.mCents * rate.mHbars +
+                            tinycents % rate.mCents * rate.mHbars / rate.mCents);
+}
+
+} // namespace Hiero
@@ -8,16 +8,22 @@
 #include "TopicMessageSubmitTransaction.h"
 #include "exceptions/IllegalStateException.h"
 #include "impl/HttpClient.h"
+#include "impl/HttpExecutor.h"
 #include "impl/MirrorNetwork.h"
+#include "impl/MirrorResponseCache.h"
 
 #include <algorithm>
 #include <chrono>
+#include <exception>
 #include <stdexcept>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
 
 #include <nlohmann/json.hpp>
+#include <services/consensus_submit_message.pb.h>
 #include <services/transaction.pb.h>
+#include <services/transaction_contents.pb.h>
 
 namespace Hiero
 {
@@ -59,13 +65,13 @@ struct AttemptResult
 };
 
 //-----
-AttemptResult performSingleAttempt(const std::string& url, const std::string& txBytes)
+AttemptResult performSingleAttempt(const std::string& url, const std::string& txBytes, bool compression)
 {
   AttemptResult result;
   try
   {
     result.body = internal::HttpClient::invokeRESTWithStatus(
-      url, "POST", txBytes, "application/protobuf", result.statusCode, result.isTimeout);
+      url, "POST", txBytes, "application/protobuf", result.statusCode, result.isTimeout, compression);
     if (result.statusCode != HTTP_OK)
     {
       result.errorMessage = "HTTP " + std::to_string(result.statusCode) + " - " + result.body;
@@ -92,14 +98,14 @@ FeeEstimateResponse parseFeeEstimateJson(const std::string& body)
 }
 
 //-----
-void backoffSleep(uint64_t attempt)
+std::chrono::milliseconds getBackoff(uint64_t attempt)
 {
   auto delayMs = static_cast<uint64_t>(static_cast<double>(BACKOFF_INITIAL_MS) * static_cast<double>(1ULL << attempt));
   if (delayMs > BACKOFF_CAP_MS)
   {
     delayMs = BACKOFF_CAP_MS;
   }
-  std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+  return std::chrono::milliseconds(delayMs);
 }
 
 //-----
@@ -147,8 +153,168 @@ std::string normalizeMirrorBaseUrl(std::string_view mirrorUrl)
 
 } // namespace
 
+//-----
+struct FeeEstimateQuery::PendingEstimate
+{
+  // The Client making the estimate.
+  const Client* mClient = nullptr;
+
+  // The URL to which to send the transactions, and its host.
+  std::string mUrl;
+  std::string mHost;
+
+  // Should the requests be compressed?
+  bool mCompression = false;
+
+  // The serialized transactions (one per chunk) to estimate, and their cache keys (empty if they can't be cached).
+  std::vector<std::string> mTransactions;
+  std::vector<std::string> mCacheKeys;
+
+  // Are the transactions the chunks of one chunked transaction?
+  bool mChunked = false;
+
+  // The estimates of the transactions made so far.
+  std::vector<FeeEstimateResponse> mResponses;
+
+  // The number of failed attempts at estimating the current transaction, the maximum number allowed, and why the last
+  // one failed.
+  uint64_t mAttempt = 0ULL;
+  uint64_t mMaxAttempts = 0ULL;
+  std::string mLastError;
+
+  // The Client's fee estimate cache and its time-to-live, if the cache is enabled.
+  std::shared_ptr<internal::MirrorResponseCache> mCache;
+  std::chrono::system_clock::duration mCacheTtl = std::chrono::system_clock::duration::zero();
+
+  // Should retries back off on the calling thread (for execute()) rather than on the Client's HTTP executor?
+  bool mBlocking = false;
+
+  // The promise of the estimate.
+  std::promise<FeeEstimateResponse> mPromise;
+
+  ~PendingEstimate()
+  {
+    // An estimate dropped before it's made (e.g. a retry discarded at shutdown) fails rather than breaking its promise.
+    try
+    {
+      mPromise.set_exception(
+        std::make_exception_ptr(IllegalStateException("Fee estimate was abandoned before it completed")));
+    }
+    catch (const std::future_error&)
+    {
+      // The estimate was made or failed already.
+    }
+  }
+};
+
 //-----
 FeeEstimateResponse FeeEstimateQuery::execute(const Client& client)
+{
+  // Every attempt runs on this thread, which sleeps through the backoff between them.
+  const std::shared_ptr<PendingEstimate> estimate = prepareEstimate(client);
+  estimate->mBlocking = true;
+  std::future<FeeEstimateResponse> response = estimate->mPromise.get_future();
+  runEstimate(estimate);
+  return response.get();
+}
+
+//-----
+std::future<FeeEstimateResponse> FeeEstimateQuery::executeAsync(const Client& client)
+{
+  std::shared_ptr<PendingEstimate> estimate;
+  try
+  {
+    estimate = prepareEstimate(client);
+  }
+  catch (const std::exception&)
+  {
+    std::promise<FeeEstimateResponse> failed;
+    failed.set_exception(std::current_exception());
+    return failed.get_future();
+  }
+
+  // Tag the request with the mirror node it's sent to, so that it counts towards that host's concurrency limit.
+  std::future<FeeEstimateResponse> response = estimate->mPromise.get_future();
+  try
+  {
+    client.getHttpExecutor()->post(estimate->mHost, [estimate]() { runEstimate(estimate); });
+  }
+  catch (const std::exception&)
+  {
+    estimate->mPromise.set_exception(std::current_exception());
+  }
+
+  return response;
+}
+
+//-----
+std::vector<std::shared_future<FeeEstimateResponse>> FeeEstimateQuery::executeAll(
+  const Client& client,
+  std::vector<FeeEstimateQuery>& queries)
+{
+  // Queries of the same shape share one estimate.
+  std::unordered_map<std::string, std::shared_future<FeeEstimateResponse>> estimatesByShape;
+  std::vector<std::shared_future<FeeEstimateResponse>> responses;
+  responses.reserve(queries.size());
+  for (FeeEstimateQuery& query : queries)
+  {
+    std::shared_ptr<PendingEstimate> estimate;
+    try
+    {
+      estimate = query.prepareEstimate(client);
+    }
+    catch (const std::exception&)
+    {
+      std::promise<FeeEstimateResponse> failed;
+      failed.set_exception(std::current_exception());
+      responses.push_back(failed.get_future().share());
+      continue;
+    }
+
+    std::string shape;
+    for (const std::string& cacheKey : estimate->mCacheKeys)
+    {
+      if (cacheKey.empty())
+      {
+        shape.clear();
+        break;
+      }
+
+      shape += std::to_string(cacheKey.size()) + ':' + cacheKey;
+    }
+
+    if (!shape.empty())
+    {
+      if (const auto iter = estimatesByShape.find(shape); iter != estimatesByShape.end())
+      {
+        responses.push_back(iter->second);
+        continue;
+      }
+    }
+
+    std::shared_future<FeeEstimateResponse> response = estimate->mPromise.get_future().share();
+    try
+    {
+      client.getHttpExecutor()->post(estimate->mHost, [estimate]() { runEstimate(estimate); });
+    }
+    catch (const std::exception&)
+    {
+      estimate->mPromise.set_exception(std::current_exception());
+    }
+
+    if (!shape.empty())
+    {
+      estimatesByShape.try_emplace(std::move(shape), response);
+    }
+
+    responses.push_back(std::move(response));
+  }
+
+  return responses;
+}
+
+//-----
+std::shared_ptr<FeeEstimateQuery::PendingEstimate> FeeEstimateQuery::prepareEstimate(const Client& client)
 {
   if (!mTransaction.has_value())
   {
@@ -162,24 +328,131 @@ FeeEstimateResponse FeeEstimateQuery::execute(const Client& client)
 
   freezeIfNeeded(*mTransaction, client);
 
-  // Detect chunked transactions and dispatch to the per-chunk aggregation path when more than one chunk is
+  // Detect chunked transactions, whose chunks are estimated one by one and aggregated when more than one chunk is
   // required.
-  if (auto* fileAppend = mTransaction->getTransaction<FileAppendTransaction>())
+  std::vector<proto::Transaction> protoTxs;
+  if (auto* fileAppend = mTransaction->getTransaction<FileAppendTransaction>();
+      fileAppend && fileAppend->getNumberOfChunksRequired() > 1)
+  {
+    protoTxs = fileAppend->getChunkedTransactionProtobufObjects();
+  }
+  else if (auto* topicSubmit = mTransaction->getTransaction<TopicMessageSubmitTransaction>();
+           topicSubmit && topicSubmit->getNumberOfChunksRequired() > 1)
+  {
+    protoTxs = topicSubmit->getChunkedTransactionProtobufObjects();
+  }
+  else
   {
-    if (fileAppend->getNumberOfChunksRequired() > 1)
+    std::unique_ptr<proto::Transaction> protoTx = mTransaction->toProtobufTransaction();
+    if (!protoTx)
     {
-      return estimateChunkedTransaction(client, fileAppend->getChunkedTransactionProtobufObjects());
+      throw IllegalStateException("Failed to build protobuf transaction");
     }
+
+    protoTxs.push_back(std::move(*protoTx));
   }
-  else if (auto* topicSubmit = mTransaction->getTransaction<TopicMessageSubmitTransaction>())
+
+  auto estimate = std::make_shared<PendingEstimate>();
+  estimate->mClient = &client;
+  estimate->mUrl = buildMirrorNodeUrl(client);
+  estimate->mHost = internal::HttpExecutor::getHost(estimate->mUrl);
+  estimate->mCompression = client.isHttpCompression();
+  estimate->mChunked = protoTxs.size() > 1;
+  estimate->mMaxAttempts = mMaxAttempts;
+  estimate->mCache = client.getFeeEstimateCache();
+  estimate->mCacheTtl = client.getFeeEstimateCacheTtl();
+  for (const proto::Transaction& protoTx : protoTxs)
+  {
+    estimate->mTransactions.push_back(protoTx.SerializeAsString());
+    estimate->mCacheKeys.push_back(makeShapeKey(protoTx, mMode, mHighVolumeThrottle));
+  }
+
+  return estimate;
+}
+
+//-----
+void FeeEstimateQuery::runEstimate(const std::shared_ptr<PendingEstimate>& estimate)
+{
+  try
   {
-    if (topicSubmit->getNumberOfChunksRequired() > 1)
+    while (estimate->mResponses.size() < estimate->mTransactions.size())
     {
-      return estimateChunkedTransaction(client, topicSubmit->getChunkedTransactionProtobufObjects());
+      const size_t index = estimate->mResponses.size();
+      const std::string& cacheKey = estimate->mCacheKeys.at(index);
+      const bool cacheable = estimate->mCache && !cacheKey.empty();
+      if (cacheable)
+      {
+        if (internal::MirrorResponseCache::Lookup lookup = estimate->mCache->lookup(cacheKey);
+            lookup.mFreshBody.has_value())
+        {
+          estimate->mResponses.push_back(parseFeeEstimateJson(*lookup.mFreshBody));
+          continue;
+        }
+      }
+
+      if (estimate->mAttempt >= estimate->mMaxAttempts)
+      {
+        throw IllegalStateException("Failed to call fee estimate API after " + std::to_string(estimate->mMaxAttempts) +
+                                    " attempts: " + estimate->mLastError);
+      }
+
+      const AttemptResult attempt =
+        performSingleAttempt(estimate->mUrl, estimate->mTransactions.at(index), estimate->mCompression);
+      if (attempt.statusCode == HTTP_OK)
+      {
+        estimate->mResponses.push_back(parseFeeEstimateJson(attempt.body));
+        if (cacheable)
+        {
+          estimate->mCache->put(cacheKey,
+                                attempt.body,
+                                std::string(),
+                                getEstimateTtl(estimate->mCacheTtl, std::chrono::system_clock::now()));
+        }
+
+        estimate->mAttempt = 0ULL;
+        continue;
+      }
+
+      if (!shouldRetry(attempt.statusCode, attempt.isTimeout))
+      {
+        throw IllegalStateException("Fee estimate API returned status " + std::to_string(attempt.statusCode) + ": " +
+                                    attempt.errorMessage);
+      }
+
+      estimate->mLastError = attempt.errorMessage;
+      if (++estimate->mAttempt >= estimate->mMaxAttempts)
+      {
+        continue;
+      }
+
+      if (estimate->mBlocking)
+      {
+        std::this_thread::sleep_for(getBackoff(estimate->mAttempt - 1ULL));
+        continue;
+      }
+
+      // Wait out the backoff on the Client's HTTP executor without holding one of its threads, then retry there.
+      try
+      {
+        estimate->mClient->getHttpExecutor()->postAfter(estimate->mHost,
+                                                        std::chrono::system_clock::now() +
+                                                          getBackoff(estimate->mAttempt - 1ULL),
+                                                        [estimate]() { runEstimate(estimate); });
+      }
+      catch (const std::exception&)
+      {
+        estimate->mPromise.set_exception(std::current_exception());
+      }
+      return;
     }
-  }
 
-  return estimateSingleTransaction(client);
+    estimate->mPromise.set_value(estimate->mChunked ? aggregateChunkResponses(estimate->mResponses)
+                                                    : estimate->mResponses.front());
+  }
+  catch (const std::exception&)
+  {
+    estimate->mPromise.set_exception(std::current_exception());
+  }
 }
 
 //-----
@@ -238,57 +511,6 @@ uint64_t FeeEstimateQuery::getMaxAttempts() const
   return mMaxAttempts;
 }
 
-//-----
-FeeEstimateResponse FeeEstimateQuery::callGetFeeEstimate(const Client& client, const proto::Transaction& protoTx)
-{
-  const std::string url = buildMirrorNodeUrl(client);
-  const std::string txBytes = protoTx.SerializeAsString();
-
-  std::string lastError;
-  for (mAttempt = 0; mAttempt < mMaxAttempts; ++mAttempt)
-  {
-    const AttemptResult attempt = performSingleAttempt(url, txBytes);
-    if (attempt.statusCode == HTTP_OK)
-    {
-      return parseFeeEstimateJson(attempt.body);
-    }
-    if (!shouldRetry(attempt.statusCode, attempt.isTimeout))
-    {
-      throw IllegalStateException("Fee estimate API returned status " + std::to_string(attempt.statusCode) + ": " +
-                                  attempt.errorMessage);
-    }
-    lastError = attempt.errorMessage;
-    backoffSleep(mAttempt);
-  }
-
-  throw IllegalStateException("Failed to call fee estimate API after " + std::to_string(mMaxAttempts) +
-                              " attempts: " + lastError);
-}
-
-//-----
-FeeEstimateResponse FeeEstimateQuery::estimateSingleTransaction(const Client& client)
-{
-  std::unique_ptr<proto::Transaction> protoTx = mTransaction->toProtobufTransaction();
-  if (!protoTx)
-  {
-    throw IllegalStateException("Failed to build protobuf transaction");
-  }
-  return callGetFeeEstimate(client, *protoTx);
-}
-
-//-----
-FeeEstimateResponse FeeEstimateQuery::estimateChunkedTransaction(const Client& client,
-                                                                 std::vector<proto::Transaction> chunkProtos)
-{
-  std::vector<FeeEstimateResponse> perChunk;
-  perChunk.reserve(chunkProtos.size());
-  for (const auto& chunk : chunkProtos)
-  {
-    perChunk.push_back(callGetFeeEstimate(client, chunk));
-  }
-  return aggregateChunkResponses(perChunk);
-}
-
 //-----
 FeeEstimateResponse FeeEstimateQuery::aggregateChunkResponses(const std::vector<FeeEstimateResponse>& chunks)
 {
@@ -324,6 +546,40 @@ FeeEstimateResponse FeeEstimateQuery::aggregateChunkResponses(const std::vector<
   return aggregated;
 }
 
+//-----
+std::string FeeEstimateQuery::makeShapeKey(const proto::Transaction& transaction,
+                                           FeeEstimateMode mode,
+                                           uint16_t highVolumeThrottle)
+{
+  proto::SignedTransaction signedTx;
+  proto::TransactionBody body;
+  if (!signedTx.ParseFromString(transaction.signedtransactionbytes()) || !body.ParseFromString(signedTx.bodybytes()))
+  {
+    return {};
+  }
+
+  body.clear_transactionid();
+  body.clear_nodeaccountid();
+  body.clear_memo();
+
+  // The chunks of a topic message carry the ID of its first chunk's transaction, which differs between messages.
+  if (body.has_consensussubmitmessage() && body.consensussubmitmessage().has_chunkinfo())
+  {
+    body.mutable_consensussubmitmessage()->mutable_chunkinfo()->clear_initialtransactionid();
+  }
+
+  return gFeeEstimateModeToString.at(mode) + ':' + std::to_string(highVolumeThrottle) + ':' +
+         std::to_string(signedTx.sigmap().sigpair_size()) + ':' + body.SerializeAsString();
+}
+
+//-----
+std::chrono::system_clock::duration FeeEstimateQuery::getEstimateTtl(
+  const std::chrono::system_clock::duration& cacheTtl,
+  const std::chrono::system_clock::time_point& now)
+{
+  return std::min(cacheTtl, std::chrono::floor<std::chrono::hours>(now) + std::chrono::hours(1) - now);
+}
+
 //-----
 bool FeeEstimateQuery::shouldRetry(int statusCode, bool isTimeout)
 {
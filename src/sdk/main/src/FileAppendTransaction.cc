@@ -6,6 +6,10 @@
 #include <services/file_append.pb.h>
 #include <services/transaction.pb.h>
 
+#include <memory>
+#include <string>
+#include <utility>
+
 namespace Hiero
 {
 //-----
@@ -54,7 +58,23 @@ FileAppendTransaction& FileAppendTransaction::setContents(const std::vector<std:
 FileAppendTransaction& FileAppendTransaction::setContents(std::string_view contents)
 {
   requireNotFrozen();
-  setData(internal::Utilities::stringToByteVector(contents));
+  setData(contents);
+  return *this;
+}
+
+//-----
+FileAppendTransaction& FileAppendTransaction::setContents(std::shared_ptr<const std::vector<std::byte>> contents)
+{
+  requireNotFrozen();
+  setData(std::move(contents));
+  return *this;
+}
+
+//-----
+FileAppendTransaction& FileAppendTransaction::setContents(std::istream& contents)
+{
+  requireNotFrozen();
+  setData(std::make_shared<const std::vector<std::byte>>(internal::Utilities::readBytes(contents)));
   return *this;
 }
 
@@ -76,6 +96,8 @@ void FileAppendTransaction::validateChecksums(const Client& client) const
 //-----
 void FileAppendTransaction::addToBody(proto::TransactionBody& body) const
 {
+  // The source body holds all the contents, for toBytes() and scheduling. Chunks are built from a copy of it without
+  // them (see addToChunk()), so this is the only copy of all the contents made when this transaction is frozen.
   body.set_allocated_fileappend(build());
 }
 
@@ -88,7 +110,7 @@ void FileAppendTransaction::addToChunk(uint32_t chunk, uint32_t, proto::Transact
 //-----
 void FileAppendTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_fileappend())
   {
@@ -102,7 +124,7 @@ void FileAppendTransaction::initFromSourceTransactionBody()
     mFileId = FileId::fromProtobuf(body.fileid());
   }
 
-  setData(internal::Utilities::stringToByteVector(body.contents()));
+  setData(std::string_view(body.contents()));
 }
 
 //-----
@@ -110,8 +132,8 @@ proto::FileAppendTransactionBody* FileAppendTransaction::build(int chunk) const
 {
   auto body = std::make_unique<proto::FileAppendTransactionBody>();
   body->set_allocated_fileid(mFileId.toProtobuf().release());
-  body->set_contents(internal::Utilities::byteVectorToString(
-    (chunk >= 0) ? getDataForChunk(static_cast<unsigned int>(chunk)) : getData()));
+  body->set_contents(
+    std::string(((chunk >= 0) ? getDataViewForChunk(static_cast<unsigned int>(chunk)) : getDataView()).toStringView()));
   return body.release();
 }
 
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "FileTopicCheckpointStore.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace Hiero
+{
+//-----
+FileTopicCheckpointStore::FileTopicCheckpointStore(std::string_view path)
+  : mPath(path)
+{
+  std::ifstream infile(mPath);
+  if (!infile.is_open())
+  {
+    // No checkpoints have been flushed yet.
+    return;
+  }
+
+  std::string line;
+  size_t lineNumber = 0ULL;
+  while (std::getline(infile, line))
+  {
+    ++lineNumber;
+    if (line.empty())
+    {
+      continue;
+    }
+
+    std::istringstream stream(line);
+    std::string topicId;
+    int64_t nanoseconds = 0LL;
+    if (!(stream >> topicId >> nanoseconds))
+    {
+      throw std::invalid_argument("Malformed checkpoint on line " + std::to_string(lineNumber) + " of " + mPath);
+    }
+
+    mCheckpoints[TopicId::fromString(topicId)] = std::chrono::system_clock::time_point(
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanoseconds)));
+  }
+}
+
+//-----
+std::optional<std::chrono::system_clock::time_point> FileTopicCheckpointStore::load(const TopicId& topicId)
+{
+  std::unique_lock lock(mMutex);
+  if (const auto iter = mCheckpoints.find(topicId); iter != mCheckpoints.cend())
+  {
+    return iter->second;
+  }
+
+  return {};
+}
+
+//-----
+void FileTopicCheckpointStore::save(const TopicId& topicId, const std::chrono::system_clock::time_point& checkpoint)
+{
+  std::unique_lock lock(mMutex);
+  mCheckpoints[topicId] = checkpoint;
+  mDirty = true;
+}
+
+//-----
+void FileTopicCheckpointStore::flush()
+{
+  std::unique_lock flushLock(mFlushMutex);
+
+  // Snapshot the checkpoints so they can still be saved while the file is written.
+  std::vector<std::pair<TopicId, std::chrono::system_clock::time_point>> checkpoints;
+  {
+    std::unique_lock lock(mMutex);
+    if (!mDirty)
+    {
+      return;
+    }
+
+    checkpoints.assign(mCheckpoints.cbegin(), mCheckpoints.cend());
+    mDirty = false;
+  }
+
+  const std::string tempPath = mPath + ".tmp";
+  {
+    std::ofstream outfile(tempPath, std::ios_base::trunc);
+    for (const auto& [topicId, checkpoint] : checkpoints)
+    {
+      outfile << topicId.toString() << ' '
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(checkpoint.time_since_epoch()).count() << '\n';
+    }
+
+    outfile.flush();
+    if (!outfile)
+    {
+      std::unique_lock lock(mMutex);
+      mDirty = true;
+      throw std::runtime_error("Unable to write checkpoints to " + tempPath);
+    }
+  }
+
+  if (std::rename(tempPath.c_str(), mPath.c_str()) != 0)
+  {
+    std::unique_lock lock(mMutex);
+    mDirty = true;
+    throw std::runtime_error("Unable to replace checkpoint file " + mPath);
+  }
+}
+
+} // namespace Hiero
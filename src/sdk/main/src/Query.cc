@@ -35,13 +35,17 @@
 #include "TransactionRecordQuery.h"
 #include "TransferTransaction.h"
 #include "exceptions/MaxQueryPaymentExceededException.h"
+#include "exceptions/PrecheckStatusException.h"
 #include "exceptions/UninitializedException.h"
+#include "impl/MirrorResponseCache.h"
 #include "impl/Network.h"
 
 #include <services/query.pb.h>
 #include <services/query_header.pb.h>
 #include <services/transaction.pb.h>
 
+#include <string>
+
 namespace Hiero
 {
 //-----
@@ -63,10 +67,58 @@ struct Query<SdkRequestType, SdkResponseType>::QueryImpl
   // The cost to execute this Query.
   Hbar mCost;
 
+  // Was the cost paid for this Query taken from the Client's query cost cache or prepaid, rather than asked for, so
+  // that it may be too low?
+  bool mUnconfirmedCost = false;
+
+  // Should this Query ask for its cost, regardless of the Client's query cost cache and prepayment policy?
+  bool mForceGetCost = false;
+
+  // The key of this Query's cost in the Client's query cost cache.
+  std::string mCostCacheKey;
+
   // The Client that should be used to pay for the payment transaction of this Query.
   const Client* mClient = nullptr;
 };
 
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+SdkResponseType Query<SdkRequestType, SdkResponseType>::execute(const Client& client,
+                                                                const std::chrono::system_clock::duration& timeout)
+{
+  try
+  {
+    return Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::execute(client, timeout);
+  }
+  catch (const PrecheckStatusException& exception)
+  {
+    if (exception.mStatus != Status::INSUFFICIENT_TX_FEE || !mImpl->mUnconfirmedCost)
+    {
+      throw;
+    }
+  }
+
+  // The cost paid without asking for it was too low. Drop it from the cache, and run again after asking for the cost.
+  if (const std::shared_ptr<internal::MirrorResponseCache> cache = client.getQueryCostCache(); cache)
+  {
+    cache->erase(mImpl->mCostCacheKey);
+  }
+
+  mImpl->mForceGetCost = true;
+  try
+  {
+    SdkResponseType response =
+      Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::execute(client, timeout);
+    mImpl->mForceGetCost = false;
+    return response;
+  }
+  catch (...)
+  {
+    mImpl->mForceGetCost = false;
+    throw;
+  }
+}
+
 //-----
 template<typename SdkRequestType, typename SdkResponseType>
 Hbar Query<SdkRequestType, SdkResponseType>::getCost(const Client& client)
@@ -352,12 +404,55 @@ void Query<SdkRequestType, SdkResponseType>::onExecute(const Client& client)
   // Save the Client for use later to generate payment Transaction protobuf objects.
   mImpl->mClient = &client;
 
-  // Get the cost and make sure it's willing to be paid.
-  mImpl->mCost = getCost(client);
-  if (mImpl->mCost.toTinybars() > ((mImpl->mMaxPayment.has_value()) ? mImpl->mMaxPayment->toTinybars()
-                                                                    : ((client.getMaxQueryPayment().has_value())
-                                                                         ? client.getMaxQueryPayment()->toTinybars()
-                                                                         : DEFAULT_MAX_QUERY_PAYMENT.toTinybars())))
+  const int64_t maxPayment = (mImpl->mMaxPayment.has_value())       ? mImpl->mMaxPayment->toTinybars()
+                             : (client.getMaxQueryPayment().has_value()) ? client.getMaxQueryPayment()->toTinybars()
+                                                                         : DEFAULT_MAX_QUERY_PAYMENT.toTinybars();
+
+  // Pay the cached cost of Queries of this type and size class, or prepay the maximum payment, without asking for the
+  // cost. If that's too low, execute() asks for the cost and runs again.
+  const std::shared_ptr<internal::MirrorResponseCache> cache = client.getQueryCostCache();
+  if (cache)
+  {
+    auto header = std::make_unique<proto::QueryHeader>();
+    header->set_responsetype(proto::ResponseType::COST_ANSWER);
+    const proto::Query request = buildRequest(header.release());
+    mImpl->mCostCacheKey =
+      internal::MirrorResponseCache::makeQueryCostKey(static_cast<int>(request.query_case()), request.ByteSizeLong());
+  }
+
+  mImpl->mUnconfirmedCost = false;
+  if (!mImpl->mForceGetCost)
+  {
+    if (cache)
+    {
+      if (const internal::MirrorResponseCache::Lookup lookup = cache->lookup(mImpl->mCostCacheKey);
+          lookup.mFreshBody.has_value())
+      {
+        mImpl->mCost = Hbar::fromTinybars(std::stoll(*lookup.mFreshBody));
+        mImpl->mUnconfirmedCost = true;
+      }
+    }
+
+    if (!mImpl->mUnconfirmedCost && client.isPrepayQueries() && maxPayment > 0LL)
+    {
+      mImpl->mCost = Hbar::fromTinybars(maxPayment);
+      mImpl->mUnconfirmedCost = true;
+    }
+  }
+
+  // Otherwise, get the cost and cache it.
+  if (!mImpl->mUnconfirmedCost)
+  {
+    mImpl->mCost = getCost(client);
+    if (cache)
+    {
+      cache->put(
+        mImpl->mCostCacheKey, std::to_string(mImpl->mCost.toTinybars()), std::string(), client.getQueryCostCacheTtl());
+    }
+  }
+
+  // Make sure the cost is willing to be paid.
+  if (mImpl->mCost.toTinybars() > maxPayment)
   {
     throw MaxQueryPaymentExceededException("Cost to execute Query (" + std::to_string(mImpl->mCost.toTinybars()) +
                                            HbarUnit::TINYBAR().getSymbol() + ") is larger than allowed amount.");
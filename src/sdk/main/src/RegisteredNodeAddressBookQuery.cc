@@ -3,10 +3,13 @@
 #include "Client.h"
 #include "RegisteredNode.h"
 #include "RegisteredNodeAddressBook.h"
-#include "impl/HttpClient.h"
+#include "impl/MirrorNetwork.h"
+#include "impl/MirrorNodeGateway.h"
+#include "impl/MirrorPaginator.h"
 
-#include <nlohmann/json.hpp>
+#include <memory>
 #include <string>
+#include <string_view>
 
 namespace Hiero
 {
@@ -14,33 +17,14 @@ namespace Hiero
 namespace
 {
 
-void appendNodes(const nlohmann::json& json, RegisteredNodeAddressBook& result)
+// Get the base URL of the mirror node Java REST API served by a mirror node. For local environments that's
+// 127.0.0.1:8084, not the gRPC port (5600) stored in the mirror network. For remote environments, the same hostname
+// serves both gRPC (port 443) and the REST API.
+std::string getMirrorBase(std::string_view mirrorAddress)
 {
-  if (json.contains("registered_nodes") && json["registered_nodes"].is_array())
-  {
-    for (const auto& nodeJson : json["registered_nodes"])
-    {
-      result.mRegisteredNodes.push_back(RegisteredNode::fromJson(nodeJson));
-    }
-  }
-}
-
-std::string resolveNextUrl(const nlohmann::json& json, const std::string& mirrorBase)
-{
-  if (!json.contains("links") || !json["links"].is_object() || !json["links"].contains("next"))
-  {
-    return {};
-  }
-  if (json["links"]["next"].is_null())
-  {
-    return {};
-  }
-  const std::string next = json["links"]["next"].get<std::string>();
-  if (next.empty())
-  {
-    return {};
-  }
-  return (next.rfind("http", 0) == 0) ? next : mirrorBase + next;
+  const std::string host(mirrorAddress.substr(0, mirrorAddress.find(':')));
+  const bool isLocal = (host == "127.0.0.1" || host == "localhost");
+  return isLocal ? "http://" + host + ":8084" : "https://" + std::string(mirrorAddress);
 }
 
 } // namespace
@@ -48,32 +32,31 @@ std::string resolveNextUrl(const nlohmann::json& json, const std::string& mirror
 //-----
 RegisteredNodeAddressBook RegisteredNodeAddressBookQuery::execute(const Client& client) const
 {
-  const std::vector<std::string> mirrorNetworks = client.getMirrorNetwork();
-  if (mirrorNetworks.empty())
+  const std::shared_ptr<internal::MirrorNetwork> mirrorNetwork = client.getClientMirrorNetwork();
+  if (mirrorNetwork->getNetwork().empty())
   {
     return {};
   }
 
-  // The registered-nodes endpoint lives on the mirror node Java REST API. For local environments that's
-  // 127.0.0.1:8084, not the gRPC port (5600) stored in mirrorNetwork. For remote environments, the same
-  // hostname serves both gRPC (port 443) and the REST API.
-  const std::string& mirrorAddress = mirrorNetworks.front();
-  const std::string host = mirrorAddress.substr(0, mirrorAddress.find(':'));
-  const bool isLocal = (host == "127.0.0.1" || host == "localhost");
-  const std::string mirrorBase = isLocal ? "http://" + host + ":8084" : "https://" + mirrorAddress;
-  std::string currentUrl = mirrorBase + "/api/v1/network/registered-nodes";
-
+  std::string path = "/api/v1/network/registered-nodes";
   if (mLimit.has_value())
   {
-    currentUrl += "?limit=" + std::to_string(mLimit.value());
+    path += "?limit=" + std::to_string(mLimit.value());
   }
 
+  // Pages are streamed, each requested from the healthiest mirror node (failing over to the others) while the
+  // previous one is converted.
   RegisteredNodeAddressBook result;
-  while (!currentUrl.empty())
+  for (const RegisteredNode& node : internal::MirrorRange<RegisteredNode>(
+         client,
+         path,
+         "registered_nodes",
+         &RegisteredNode::fromJson,
+         &getMirrorBase,
+         internal::MirrorNodeGateway::MirrorNodeRouter().getCacheTtl(
+           internal::MirrorNodeGateway::REGISTERED_NODES_QUERY)))
   {
-    const nlohmann::json json = nlohmann::json::parse(internal::HttpClient::invokeREST(currentUrl, "GET"));
-    appendNodes(json, result);
-    currentUrl = resolveNextUrl(json, mirrorBase);
+    result.mRegisteredNodes.push_back(node);
   }
 
   return result;
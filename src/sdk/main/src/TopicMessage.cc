@@ -5,6 +5,7 @@
 
 #include <mirror/consensus_service.pb.h>
 
+#include <stdexcept>
 #include <utility>
 
 namespace Hiero
@@ -40,29 +41,149 @@ TopicMessage TopicMessage::ofSingle(const com::hedera::mirror::api::proto::Conse
 //-----
 TopicMessage TopicMessage::ofMany(const std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>& protos)
 {
-  // Place the responses in order from oldest to newest.
-  std::vector<TopicMessageChunk> chunks(protos.size(), TopicMessageChunk());
-  std::vector<std::vector<std::byte>> contents(protos.size(), std::vector<std::byte>());
-  TransactionId transactionId;
+  // Place the responses in order from oldest to newest, and size the contents so that each chunk's message is copied
+  // exactly once, straight into its place.
+  std::vector<const com::hedera::mirror::api::proto::ConsensusTopicResponse*> ordered(protos.size(), nullptr);
+  size_t contentsSize = 0ULL;
+  TopicMessage topicMessage;
 
   for (const auto& proto : protos)
   {
     if (proto.has_chunkinfo() && proto.chunkinfo().has_initialtransactionid())
     {
-      transactionId = TransactionId::fromProtobuf(proto.chunkinfo().initialtransactionid());
+      topicMessage.mTransactionId = TransactionId::fromProtobuf(proto.chunkinfo().initialtransactionid());
     }
 
-    const int32_t index = proto.chunkinfo().number() - 1;
-    chunks[index] = TopicMessageChunk(proto);
-    contents[index] = internal::Utilities::stringToByteVector(proto.message());
+    ordered[proto.chunkinfo().number() - 1] = &proto;
+    contentsSize += proto.message().size();
   }
 
-  return { chunks.back().mConsensusTimestamp,
-           internal::Utilities::concatenateVectors(contents),
-           chunks.back().mRunningHash,
-           chunks.back().mSequenceNumber,
-           chunks,
-           transactionId };
+  topicMessage.mContents.reserve(contentsSize);
+  topicMessage.mChunks.reserve(ordered.size());
+  for (const auto* proto : ordered)
+  {
+    const auto* data = reinterpret_cast<const std::byte*>(proto->message().data());
+    topicMessage.mContents.insert(topicMessage.mContents.end(), data, data + proto->message().size());
+    topicMessage.mChunks.emplace_back(*proto);
+  }
+
+  const TopicMessageChunk& last = topicMessage.mChunks.back();
+  topicMessage.mConsensusTimestamp = last.mConsensusTimestamp;
+  topicMessage.mRunningHash = last.mRunningHash;
+  topicMessage.mSequenceNumber = last.mSequenceNumber;
+  return topicMessage;
+}
+
+//-----
+TopicMessage TopicMessage::viewOf(
+  std::shared_ptr<const std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>> protos)
+{
+  if (!protos || protos->empty())
+  {
+    throw std::invalid_argument("A TopicMessage view requires at least one ConsensusTopicResponse");
+  }
+
+  TopicMessage topicMessage;
+  const com::hedera::mirror::api::proto::ConsensusTopicResponse& first = protos->front();
+  const com::hedera::mirror::api::proto::ConsensusTopicResponse& last = protos->back();
+
+  if (first.has_chunkinfo() && first.chunkinfo().has_initialtransactionid())
+  {
+    topicMessage.mTransactionId = TransactionId::fromProtobuf(first.chunkinfo().initialtransactionid());
+  }
+
+  topicMessage.mConsensusTimestamp = internal::TimestampConverter::fromProtobuf(last.consensustimestamp());
+  topicMessage.mSequenceNumber = last.sequencenumber();
+
+  // The contents must be contiguous, so the chunk bodies of a multi-chunk message are concatenated here, once.
+  if (protos->size() > 1)
+  {
+    size_t contentsSize = 0ULL;
+    for (const auto& proto : *protos)
+    {
+      contentsSize += proto.message().size();
+    }
+
+    auto contents = std::make_shared<std::vector<std::byte>>();
+    contents->reserve(contentsSize);
+    for (const auto& proto : *protos)
+    {
+      const ByteView message(proto.message());
+      contents->insert(contents->end(), message.begin(), message.end());
+    }
+
+    topicMessage.mSharedContents = std::move(contents);
+  }
+
+  topicMessage.mProtos = std::move(protos);
+  return topicMessage;
+}
+
+//-----
+TopicMessage& TopicMessage::materialize()
+{
+  if (!isView())
+  {
+    return *this;
+  }
+
+  mContents = getContents().toVector();
+  mRunningHash = getRunningHash().toVector();
+  mChunks = getChunks();
+  mProtos.reset();
+  mSharedContents.reset();
+  return *this;
+}
+
+//-----
+ByteView TopicMessage::getContents() const
+{
+  if (mSharedContents)
+  {
+    return *mSharedContents;
+  }
+
+  if (mProtos)
+  {
+    return ByteView(mProtos->front().message());
+  }
+
+  return mContents;
+}
+
+//-----
+ByteView TopicMessage::getRunningHash() const
+{
+  if (mProtos)
+  {
+    return ByteView(mProtos->back().runninghash());
+  }
+
+  return mRunningHash;
+}
+
+//-----
+size_t TopicMessage::getChunkCount() const
+{
+  return mProtos ? mProtos->size() : mChunks.size();
+}
+
+//-----
+std::vector<TopicMessageChunk> TopicMessage::getChunks() const
+{
+  if (!mProtos)
+  {
+    return mChunks;
+  }
+
+  std::vector<TopicMessageChunk> chunks;
+  chunks.reserve(mProtos->size());
+  for (const auto& proto : *mProtos)
+  {
+    chunks.emplace_back(proto);
+  }
+
+  return chunks;
 }
 
 } // namespace Hiero
@@ -8,14 +8,22 @@
 #include "exceptions/IllegalStateException.h"
 #include "impl/MirrorNetwork.h"
 #include "impl/MirrorNode.h"
+#include "impl/SubscriptionReactor.h"
 #include "impl/TimestampConverter.h"
-#include "impl/Utilities.h"
+#include "impl/TopicMessageReassembler.h"
 
+#include <grpcpp/alarm.h>
 #include <mirror/consensus_service.grpc.pb.h>
 
 #include <chrono>
-#include <thread>
-#include <unordered_map>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace Hiero
 {
@@ -26,10 +34,12 @@ enum class CallStatus
 {
   STATUS_CREATE = 0,
   STATUS_PROCESSING = 1,
-  STATUS_FINISH = 2
+  STATUS_FINISH = 2,
+  STATUS_RETRY = 3
 };
 
-// Helper function used to get a connected mirror node.
+// Helper function used to get the connected mirror node with the fewest open subscriptions, so that subscriptions are
+// spread across the mirror network.
 std::shared_ptr<internal::MirrorNode> getConnectedMirrorNode(const std::shared_ptr<internal::MirrorNetwork>& network)
 {
   if (!network)
@@ -37,219 +47,640 @@ std::shared_ptr<internal::MirrorNode> getConnectedMirrorNode(const std::shared_p
     throw IllegalStateException("Mirror network is not configured");
   }
 
-  std::shared_ptr<internal::MirrorNode> node = network->getNextMirrorNode();
-  while (node && node->channelFailedToConnect())
+  for (const std::shared_ptr<internal::MirrorNode>& node : network->getMirrorNodesByLoad())
   {
-    node = network->getNextMirrorNode();
+    if (!node->channelFailedToConnect())
+    {
+      return node;
+    }
   }
 
-  if (!node)
+  throw IllegalStateException("No mirror node is available for topic message subscription");
+}
+
+// Does a status with which a subscription call finished mean that its mirror node failed (as opposed to the query
+// being invalid)?
+bool isMirrorNodeFailure(const grpc::Status& status)
+{
+  switch (status.error_code())
   {
-    throw IllegalStateException("No mirror node is available for topic message subscription");
+    case grpc::StatusCode::UNAVAILABLE:
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+    case grpc::StatusCode::INTERNAL:
+    case grpc::StatusCode::UNKNOWN:
+    case grpc::StatusCode::DEADLINE_EXCEEDED:
+      return true;
+    default:
+      return false;
   }
+}
 
-  return node;
-}
-
-// Subscriber function called by TopicMessageQuery::subscribe().
-void startSubscription(
-  const std::shared_ptr<internal::MirrorNetwork>& network,
-  std::unique_ptr<grpc::ClientAsyncReader<com::hedera::mirror::api::proto::ConsensusTopicResponse>> reader,
-  std::unique_ptr<grpc::ClientContext> context,
-  std::unique_ptr<grpc::CompletionQueue> queue,
-  std::unique_ptr<CallStatus> callStatus,
-  com::hedera::mirror::api::proto::ConsensusTopicQuery query,
-  std::function<void(grpc::Status)> errorHandler,
-  std::function<bool(grpc::Status)> retryHandler,
-  std::function<void(void)> completionHandler,
-  std::function<void(const TopicMessage&)> onNext,
-  uint32_t maxAttempts,
-  std::chrono::system_clock::duration maxBackoff,
-  std::shared_ptr<SubscriptionHandle> handle)
-{
-  // Grab moved objects.
-  std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
-  std::vector<std::unique_ptr<grpc::CompletionQueue>> queues;
-  contexts.push_back(std::move(context));
-  queues.push_back(std::move(queue));
-
-  handle->setOnUnsubscribe([&contexts]() { contexts.back()->TryCancel(); });
-
-  // Declare needed variables.
-  com::hedera::mirror::api::proto::ConsensusTopicResponse response;
-  std::unordered_map<TransactionId, std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>>
-    pendingMessages;
-  std::chrono::system_clock::duration backoff = DEFAULT_MIN_BACKOFF;
-  grpc::Status grpcStatus;
-  uint64_t attempt = 0ULL;
-  bool complete = false;
-  bool ok = false;
-  void* tag;
-
-  // Loop until the RPC completes.
-  while (true)
-  {
-    // Process based on the completion queue status.
-    switch (queues.back()->AsyncNext(
-      &tag, &ok, std::chrono::system_clock::now() + std::chrono::duration_cast<std::chrono::milliseconds>(backoff)))
+// One of the smallest denomination of time this machine can handle.
+constexpr std::chrono::duration<int, std::ratio<1, std::chrono::system_clock::period::den>> SMALLEST_TIME_STEP(1);
+
+// The settings of a topic subscription, captured from its TopicMessageQuery when subscribing.
+struct SubscriptionSettings
+{
+  com::hedera::mirror::api::proto::ConsensusTopicQuery mQuery;
+  std::function<void(grpc::Status)> mErrorHandler;
+  std::function<bool(grpc::Status)> mRetryHandler;
+  std::function<void(void)> mCompletionHandler;
+  std::function<void(const TransactionId&, uint64_t, uint64_t)> mIncompleteMessageHandler;
+  std::function<void(const std::chrono::system_clock::time_point&)> mCheckpointHandler;
+  uint32_t mMaxAttempts = DEFAULT_MAX_ATTEMPTS;
+  std::chrono::system_clock::duration mMaxBackoff = DEFAULT_MAX_BACKOFF;
+  size_t mMaxPendingChunkBytes = DEFAULT_MAX_PENDING_CHUNK_BYTES;
+  std::chrono::system_clock::duration mMaxPendingChunkAge = DEFAULT_MAX_PENDING_CHUNK_AGE;
+  size_t mMaxQueuedMessages = 0ULL;
+  TopicMessageQuery::OverflowPolicy mOverflowPolicy = TopicMessageQuery::OverflowPolicy::BLOCK;
+  size_t mMaxBatchSize = DEFAULT_MAX_TOPIC_MESSAGE_BATCH_SIZE;
+  std::chrono::system_clock::duration mMaxBatchDelay = DEFAULT_MAX_TOPIC_MESSAGE_BATCH_DELAY;
+  bool mDeliverViews = false;
+};
+
+// A single topic subscription, driven by a Client's SubscriptionReactor.
+class TopicSubscription
+  : public internal::SubscriptionReactor::Handler
+  , public std::enable_shared_from_this<TopicSubscription>
+{
+public:
+  TopicSubscription(internal::SubscriptionReactor& reactor,
+                    std::shared_ptr<internal::MirrorNetwork> network,
+                    SubscriptionSettings settings,
+                    std::function<void(const TopicMessage&)> onNext,
+                    std::function<void(const std::vector<TopicMessage>&)> onNextBatch)
+    : mReactor(reactor)
+    , mNetwork(std::move(network))
+    , mSettings(std::move(settings))
+    , mOnNext(std::move(onNext))
+    , mOnNextBatch(std::move(onNextBatch))
+    , mReassembler(mSettings.mMaxPendingChunkBytes,
+                   mSettings.mMaxPendingChunkAge,
+                   [this](const TransactionId& transactionId, uint64_t received, uint64_t total)
+                   {
+                     if (const auto& handler = mSettings.mIncompleteMessageHandler; handler)
+                     {
+                       dispatch([handler, transactionId, received, total]()
+                                { handler(transactionId, received, total); });
+                     }
+                   },
+                   mSettings.mDeliverViews)
+  {
+  }
+
+  // Send the query to a mirror node. Must be called after this subscription has been added to the reactor.
+  void start(const std::shared_ptr<internal::MirrorNode>& node)
+  {
+    std::unique_lock lock(mMutex);
+    startCall(node);
+  }
+
+  bool onEvent(bool ok) override
+  {
+    std::unique_lock lock(mMutex);
+
+    switch (mCallStatus)
     {
-      case grpc::CompletionQueue::TIMEOUT:
+      case CallStatus::STATUS_CREATE:
       {
-        // Backoff if the completion queue timed out.
-        backoff = (backoff * 2 > maxBackoff) ? maxBackoff : backoff * 2;
-        break;
+        if (ok)
+        {
+          // Update the call status to processing.
+          mCallStatus = CallStatus::STATUS_PROCESSING;
+          readNext();
+        }
+        else
+        {
+          finishCall();
+        }
+
+        return true;
       }
-      case grpc::CompletionQueue::GOT_EVENT:
+      case CallStatus::STATUS_PROCESSING:
       {
-        // Decrease the backoff time.
-        backoff = (backoff / 2 < DEFAULT_MIN_BACKOFF) ? DEFAULT_MIN_BACKOFF : backoff / 2;
+        // If the response shouldn't be processed (due to completion or error), finish the RPC.
+        if (!ok)
+        {
+          finishCall();
+          return true;
+        }
 
-        // Process based on the call status.
-        switch (static_cast<CallStatus>(*internal::Utilities::toTypePtr<long>(tag)))
+        // The first response of a call shows that its mirror node is serving again.
+        if (!mNodeResponded)
         {
-          case CallStatus::STATUS_CREATE:
-          {
-            if (ok)
-            {
-              // Update the call status to processing.
-              *callStatus = CallStatus::STATUS_PROCESSING;
-            }
-
-            // Let fall through to process message.
-            [[fallthrough]];
-          }
-          case CallStatus::STATUS_PROCESSING:
-          {
-            // If the response should be processed, process it.
-            if (ok)
-            {
-              // Read the response.
-              reader->Read(&response, callStatus.get());
-
-              // Adjust the query timestamp and limit, in case a retry is triggered.
-              if (response.has_consensustimestamp())
-              {
-                // Add one of the smallest denomination of time this machine can handle.
-                query.set_allocated_consensusstarttime(internal::TimestampConverter::toProtobuf(
-                  internal::TimestampConverter::fromProtobuf(response.consensustimestamp()) +
-                  std::chrono::duration<int, std::ratio<1, std::chrono::system_clock::period::den>>()));
-              }
-
-              if (query.limit() > 0ULL)
-              {
-                query.set_limit(query.limit() - 1ULL);
-              }
-
-              // Process the received message.
-              if (!response.has_chunkinfo() || response.chunkinfo().total() == 1)
-              {
-                onNext(TopicMessage::ofSingle(response));
-              }
-              else
-              {
-                const TransactionId transactionId =
-                  TransactionId::fromProtobuf(response.chunkinfo().initialtransactionid());
-                pendingMessages[transactionId].push_back(response);
-
-                if (pendingMessages[transactionId].size() == response.chunkinfo().total())
-                {
-                  onNext(TopicMessage::ofMany(pendingMessages[transactionId]));
-                }
-              }
-            }
-
-            // If the response shouldn't be processed (due to completion or error), finish the RPC.
-            else
-            {
-              *callStatus = CallStatus::STATUS_FINISH;
-              reader->Finish(&grpcStatus, callStatus.get());
-            }
-
-            break;
-          }
-          case CallStatus::STATUS_FINISH:
-          {
-            if (grpcStatus.ok())
-            {
-              // RPC completed successfully.
-              completionHandler();
-
-              // Shutdown the completion queue.
-              queues.back()->Shutdown();
-
-              // Mark the RPC as complete.
-              complete = true;
-              break;
-            }
-            else
-            {
-              // An error occurred. Whether retrying or not, cancel the call and close the queue.
-              contexts.back()->TryCancel();
-              queues.back()->Shutdown();
-
-              if (attempt >= maxAttempts || !retryHandler(grpcStatus))
-              {
-                // This RPC call shouldn't be retried, handle the error and mark as complete to exit.
-                errorHandler(grpcStatus);
-                complete = true;
-              }
-            }
-
-            break;
-          }
-          default:
-          {
-            // Unrecognized call status, do nothing for now (not sure if this is correct).
-            break;
-          }
+          mNodeResponded = true;
+          mNetwork->recordSuccess(mNode, std::chrono::system_clock::duration::zero());
         }
 
-        break;
+        processResponse();
+        readNext();
+        return true;
       }
-      case grpc::CompletionQueue::SHUTDOWN:
+      case CallStatus::STATUS_FINISH:
       {
-        // Getting here means the RPC is reached completion or encountered an un-retriable error, and the completion
-        // queue has been shut down. End the subscription.
-        if (complete)
+        // The call is over, so it no longer counts towards its mirror node's load. A mirror node that failed the call
+        // backs off, so that retries and new subscriptions prefer the other mirror nodes.
+        mNode->removeActiveStream();
+        if (!mCancelled && isMirrorNodeFailure(mGrpcStatus))
         {
-          // Give a second for the queue to finish its processing.
-          std::this_thread::sleep_for(std::chrono::seconds(1));
-          return;
+          mNetwork->recordFailure(mNode);
+        }
+
+        mNode.reset();
+
+        if (mOverflowed)
+        {
+          // The delivery queue overflowed with the FAIL policy, which isn't retried.
+          reportError(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Topic message delivery queue is full"));
+          return false;
+        }
+
+        if (mGrpcStatus.ok())
+        {
+          // RPC completed successfully.
+          dispatch(mSettings.mCompletionHandler);
+          return false;
         }
 
-        // If the completion queue has been shut down and the RPC hasn't completed, that means the RPC needs to be
-        // retried. Increase the backoff for the retry.
-        backoff = (backoff * 2 > maxBackoff) ? maxBackoff : backoff * 2;
-        std::this_thread::sleep_for(backoff);
-        ++attempt;
+        if (mCancelled || mAttempt >= mSettings.mMaxAttempts || !shouldRetry())
+        {
+          // This RPC call shouldn't be retried, handle the error.
+          reportError(mGrpcStatus);
+          return false;
+        }
 
-        // Resend the query to a different node with a different completion queue and client context.
-        contexts.push_back(std::make_unique<grpc::ClientContext>());
-        queues.push_back(std::make_unique<grpc::CompletionQueue>());
+        // Wait out the backoff on the completion queue instead of blocking a poller thread.
+        mBackoff = (mBackoff * 2 > mSettings.mMaxBackoff) ? mSettings.mMaxBackoff : mBackoff * 2;
+        mCallStatus = CallStatus::STATUS_RETRY;
+        mAlarm = std::make_unique<grpc::Alarm>();
+        mAlarm->Set(mReactor.getCompletionQueue(), std::chrono::system_clock::now() + mBackoff, this);
+        return true;
+      }
+      case CallStatus::STATUS_RETRY:
+      {
+        // The alarm was cancelled, which only happens when unsubscribing.
+        if (!ok || mCancelled)
+        {
+          reportError(mGrpcStatus);
+          return false;
+        }
 
-        // Reset the call status and send the query.
-        *callStatus = CallStatus::STATUS_CREATE;
+        // Resend the query to a different node with a different client context.
+        ++mAttempt;
         try
         {
-          reader = getConnectedMirrorNode(network)->getConsensusServiceStub()->AsyncsubscribeTopic(
-            contexts.back().get(), query, queues.back().get(), callStatus.get());
+          startCall(getConnectedMirrorNode(mNetwork));
         }
         catch (const IllegalStateException& e)
         {
-          errorHandler(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, e.what()));
-          complete = true;
+          reportError(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, e.what()));
+          return false;
         }
 
-        break;
+        return true;
       }
       default:
       {
-        // Not sure what to do here, just fail out.
-        std::cout << "Unknown gRPC completion queue event, failing.." << std::endl;
+        // Unrecognized call status, end the subscription.
+        return false;
+      }
+    }
+  }
+
+  void cancel() override
+  {
+    std::unique_lock lock(mMutex);
+    mCancelled = true;
+
+    if (mContext)
+    {
+      mContext->TryCancel();
+    }
+
+    if (mAlarm)
+    {
+      mAlarm->Cancel();
+    }
+
+    // A paused read loop has no operation outstanding, so finish the call to get one.
+    if (mReadPaused)
+    {
+      mReadPaused = false;
+      finishCall();
+    }
+  }
+
+private:
+  // Start a call with a fresh client context. mMutex must be held.
+  void startCall(const std::shared_ptr<internal::MirrorNode>& node)
+  {
+    // The previous call (if any) has finished, so its reader and context can be released.
+    mReader.reset();
+    mContext = std::make_unique<grpc::ClientContext>();
+
+    // A call started on a cancelled context is cancelled as soon as it starts.
+    if (mCancelled)
+    {
+      mContext->TryCancel();
+    }
+
+    mNode = node;
+    mNode->addActiveStream();
+    mNodeResponded = false;
+
+    mCallStatus = CallStatus::STATUS_CREATE;
+    mReader = node->getConsensusServiceStub()->AsyncsubscribeTopic(
+      mContext.get(), mSettings.mQuery, mReactor.getCompletionQueue(), this);
+  }
+
+  // Read the next response. With the BLOCK policy, reading is paused instead while the delivery queue is full; the
+  // stream is then held back by gRPC flow control until the consumer catches up. mMutex must be held.
+  void readNext()
+  {
+    if (!mOverflowed && mSettings.mOverflowPolicy == TopicMessageQuery::OverflowPolicy::BLOCK && isQueueFull())
+    {
+      mReadPaused = true;
+      return;
+    }
+
+    mReader->Read(&mResponse, this);
+  }
+
+  // Finish the current call and retrieve its status. mMutex must be held.
+  void finishCall()
+  {
+    mCallStatus = CallStatus::STATUS_FINISH;
+    mReader->Finish(&mGrpcStatus, this);
+  }
+
+  // Process a received response. mMutex must be held.
+  void processResponse()
+  {
+    mBackoff = DEFAULT_MIN_BACKOFF;
+
+    // Adjust the query timestamp and limit, in case a retry is triggered.
+    const std::chrono::system_clock::time_point consensusTimestamp =
+      internal::TimestampConverter::fromProtobuf(mResponse.consensustimestamp());
+    if (mResponse.has_consensustimestamp())
+    {
+      // Add one of the smallest denomination of time this machine can handle.
+      mSettings.mQuery.set_allocated_consensusstarttime(
+        internal::TimestampConverter::toProtobuf(consensusTimestamp + SMALLEST_TIME_STEP));
+    }
+
+    if (mSettings.mQuery.limit() > 0ULL)
+    {
+      mSettings.mQuery.set_limit(mSettings.mQuery.limit() - 1ULL);
+    }
+
+    // Process the received message. Chunks are moved (not copied) into the reassembler or a message view; the next
+    // read overwrites the moved-from response.
+    std::optional<TopicMessage> message;
+    if (!mResponse.has_chunkinfo() || mResponse.chunkinfo().total() == 1)
+    {
+      if (mSettings.mDeliverViews)
+      {
+        auto protos = std::make_shared<std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>>(1);
+        protos->front() = std::move(mResponse);
+        message = TopicMessage::viewOf(std::move(protos));
+      }
+      else
+      {
+        message = TopicMessage::ofSingle(mResponse);
+      }
+    }
+    else
+    {
+      message = mReassembler.add(std::move(mResponse));
+    }
+
+    if (message.has_value())
+    {
+      deliver(std::move(*message), getCheckpoint(consensusTimestamp));
+    }
+  }
+
+  // Get the checkpoint reached once the message received at a consensus timestamp is delivered. The chunks of partial
+  // messages are only held in memory, so the checkpoint can't pass the first chunk of the oldest partial message.
+  std::chrono::system_clock::time_point getCheckpoint(const std::chrono::system_clock::time_point& consensusTimestamp)
+  {
+    if (const std::optional<std::chrono::system_clock::time_point> oldestPending =
+          mReassembler.getOldestPendingTimestamp();
+        oldestPending.has_value())
+    {
+      return *oldestPending - SMALLEST_TIME_STEP;
+    }
+
+    return consensusTimestamp;
+  }
+
+  // Report an error to the error handler, after every queued message has been delivered.
+  void reportError(const grpc::Status& status)
+  {
+    dispatch([errorHandler = mSettings.mErrorHandler, status]() { errorHandler(status); });
+  }
+
+  // Is the delivery queue full?
+  bool isQueueFull()
+  {
+    std::unique_lock lock(mCallbackMutex);
+    return mSettings.mMaxQueuedMessages > 0ULL && mMessages.size() >= mSettings.mMaxQueuedMessages;
+  }
+
+  // Queue a message for delivery, applying the overflow policy if the queue is full. mMutex must be held.
+  void deliver(TopicMessage message, const std::chrono::system_clock::time_point& checkpoint)
+  {
+    if (mOverflowed)
+    {
+      return;
+    }
+
+    std::unique_lock lock(mCallbackMutex);
+    if (mSettings.mMaxQueuedMessages > 0ULL && mMessages.size() >= mSettings.mMaxQueuedMessages)
+    {
+      if (mSettings.mOverflowPolicy == TopicMessageQuery::OverflowPolicy::FAIL)
+      {
+        // Fail the subscription. Cancelling the call finishes it, and the error is reported when it does.
+        mOverflowed = true;
+        mContext->TryCancel();
+        return;
+      }
+
+      if (mSettings.mOverflowPolicy == TopicMessageQuery::OverflowPolicy::DROP_OLDEST)
+      {
+        mMessages.pop_front();
+      }
+    }
+
+    mMessages.push_back({ std::move(message), checkpoint });
+    scheduleDrain(lock);
+  }
+
+  // Run a callback on the reactor's callback threads, after every queued message has been delivered. Callbacks of one
+  // subscription run one at a time, in order.
+  void dispatch(std::function<void()> callback)
+  {
+    std::unique_lock lock(mCallbackMutex);
+    mCallbacks.push_back(std::move(callback));
+    scheduleDrain(lock);
+  }
+
+  // Make sure queued messages and callbacks will be run. mCallbackMutex must be held by the input lock.
+  void scheduleDrain(std::unique_lock<std::mutex>& lock)
+  {
+    if (mDraining)
+    {
+      return;
+    }
+
+    // When delivering batches, give a partial batch until the batch delay to fill up.
+    if (mOnNextBatch && mSettings.mMaxBatchDelay > std::chrono::system_clock::duration::zero() &&
+        mMessages.size() < mSettings.mMaxBatchSize && mCallbacks.empty())
+    {
+      if (!mBatchTimerArmed)
+      {
+        mBatchTimerArmed = true;
+        lock.unlock();
+
+        try
+        {
+          mReactor.postAfter(std::chrono::system_clock::now() + mSettings.mMaxBatchDelay,
+                             [self = shared_from_this()]() { self->onBatchTimer(); });
+        }
+        catch (const IllegalStateException&)
+        {
+          // The reactor is shutting down, so deliver right away.
+          mReactor.post([self = shared_from_this()]() { self->onBatchTimer(); });
+        }
+      }
+
+      return;
+    }
+
+    mDraining = true;
+    lock.unlock();
+    mReactor.post([self = shared_from_this()]() { self->drain(); });
+  }
+
+  // Deliver the partial batch that was waiting for the batch delay.
+  void onBatchTimer()
+  {
+    {
+      std::unique_lock lock(mCallbackMutex);
+      mBatchTimerArmed = false;
+      if (mDraining || (mMessages.empty() && mCallbacks.empty()))
+      {
         return;
       }
+
+      mDraining = true;
     }
+
+    drain();
   }
+
+  // Deliver queued messages, then run queued callbacks, until there are none left.
+  void drain()
+  {
+    const size_t batchSize = mOnNextBatch ? mSettings.mMaxBatchSize : 1ULL;
+
+    while (true)
+    {
+      std::vector<TopicMessage> batch;
+      std::chrono::system_clock::time_point checkpoint;
+      std::function<void()> callback;
+      {
+        std::unique_lock lock(mCallbackMutex);
+        if (!mMessages.empty())
+        {
+          while (!mMessages.empty() && batch.size() < batchSize)
+          {
+            batch.push_back(std::move(mMessages.front().mMessage));
+            checkpoint = mMessages.front().mCheckpoint;
+            mMessages.pop_front();
+          }
+        }
+        else if (!mCallbacks.empty())
+        {
+          callback = std::move(mCallbacks.front());
+          mCallbacks.pop_front();
+        }
+        else
+        {
+          mDraining = false;
+          return;
+        }
+      }
+
+      if (batch.empty())
+      {
+        runConsumerCallback(callback);
+        continue;
+      }
+
+      runConsumerCallback(
+        [this, &batch]()
+        {
+          if (mOnNextBatch)
+          {
+            mOnNextBatch(batch);
+          }
+          else
+          {
+            mOnNext(batch.front());
+          }
+        });
+
+      if (mSettings.mCheckpointHandler)
+      {
+        runConsumerCallback([this, &checkpoint]() { mSettings.mCheckpointHandler(checkpoint); });
+      }
+
+      resumeReading();
+    }
+  }
+
+  // Run one of the consumer's callbacks. One that throws is logged and dropped, like a throwing reactor task, but
+  // without leaving this subscription marked as draining (which would stop its delivery for good).
+  void runConsumerCallback(const std::function<void()>& callback) const
+  {
+    try
+    {
+      callback();
+    }
+    catch (const std::exception& exception)
+    {
+      mReactor.getLogger().error(std::string("Topic message subscription callback threw an exception: ") +
+                                 exception.what());
+    }
+    catch (...)
+    {
+      mReactor.getLogger().error("Topic message subscription callback threw an unknown exception");
+    }
+  }
+
+  // Ask the consumer's retry handler whether to retry the call. A handler that throws (on a poller thread, where the
+  // exception would end the process) is logged and taken to mean no.
+  [[nodiscard]] bool shouldRetry() const
+  {
+    bool retry = false;
+    runConsumerCallback([this, &retry]() { retry = mSettings.mRetryHandler(mGrpcStatus); });
+    return retry;
+  }
+
+  // Resume a read loop paused by a full delivery queue, if the queue now has room.
+  void resumeReading()
+  {
+    std::unique_lock lock(mMutex);
+    if (!mReadPaused || isQueueFull())
+    {
+      return;
+    }
+
+    mReadPaused = false;
+    mReader->Read(&mResponse, this);
+  }
+
+  // The reactor driving this subscription.
+  internal::SubscriptionReactor& mReactor;
+
+  // A received message waiting to be delivered, with the checkpoint reached once it is.
+  struct QueuedMessage
+  {
+    TopicMessage mMessage;
+    std::chrono::system_clock::time_point mCheckpoint;
+  };
+
+  // The mirror network from which to pick nodes when retrying.
+  std::shared_ptr<internal::MirrorNetwork> mNetwork;
+
+  // The settings of this subscription. The query is adjusted as messages are received, so that a retry resumes where
+  // the previous call stopped.
+  SubscriptionSettings mSettings;
+
+  // The consumer's callback, either for single messages or for batches.
+  std::function<void(const TopicMessage&)> mOnNext;
+  std::function<void(const std::vector<TopicMessage>&)> mOnNextBatch;
+
+  // Guards the call state below, which is touched by the poller threads, the callback threads, and unsubscribing.
+  std::mutex mMutex;
+  std::shared_ptr<internal::MirrorNode> mNode;
+  std::unique_ptr<grpc::ClientContext> mContext;
+  std::unique_ptr<grpc::ClientAsyncReader<com::hedera::mirror::api::proto::ConsensusTopicResponse>> mReader;
+  std::unique_ptr<grpc::Alarm> mAlarm;
+  CallStatus mCallStatus = CallStatus::STATUS_CREATE;
+  com::hedera::mirror::api::proto::ConsensusTopicResponse mResponse;
+  grpc::Status mGrpcStatus;
+  std::chrono::system_clock::duration mBackoff = DEFAULT_MIN_BACKOFF;
+  uint32_t mAttempt = 0U;
+  bool mCancelled = false;
+  bool mReadPaused = false;
+  bool mOverflowed = false;
+  bool mNodeResponded = false;
+
+  // Reassembles the chunks of multi-chunk messages.
+  internal::TopicMessageReassembler mReassembler;
+
+  // Guards the delivery state below. May be locked while mMutex is held, but not the other way around.
+  std::mutex mCallbackMutex;
+  std::deque<QueuedMessage> mMessages;
+  std::deque<std::function<void()>> mCallbacks;
+  bool mDraining = false;
+  bool mBatchTimerArmed = false;
+};
+
+// Start a subscription on a Client's reactor. Exactly one of onNext and onNextBatch should be set.
+std::shared_ptr<SubscriptionHandle> startSubscription(
+  const Client& client,
+  SubscriptionSettings settings,
+  const std::function<void(const TopicMessage&)>& onNext,
+  const std::function<void(const std::vector<TopicMessage>&)>& onNextBatch)
+{
+  // Create the subscription handle and assign its unsubscribe function to cancel the subscription (which will cancel
+  // the gRPC call).
+  auto handle = std::make_shared<SubscriptionHandle>();
+
+  std::shared_ptr<internal::MirrorNode> node;
+  // The subscription is driven by the Client's reactor instead of a dedicated thread.
+  std::shared_ptr<internal::SubscriptionReactor> reactor;
+  try
+  {
+    node = getConnectedMirrorNode(client.getClientMirrorNetwork());
+    reactor = client.getSubscriptionReactor();
+  }
+  catch (const IllegalStateException& e)
+  {
+    settings.mErrorHandler(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, e.what()));
+    return handle;
+  }
+
+  const std::function<void(grpc::Status)> errorHandler = settings.mErrorHandler;
+  auto subscription = std::make_shared<TopicSubscription>(
+    *reactor, client.getClientMirrorNetwork(), std::move(settings), onNext, onNextBatch);
+
+  handle->setOnUnsubscribe(
+    [weakSubscription = std::weak_ptr<TopicSubscription>(subscription)]()
+    {
+      if (const std::shared_ptr<TopicSubscription> subscription = weakSubscription.lock())
+      {
+        subscription->cancel();
+      }
+    });
+
+  try
+  {
+    reactor->add(subscription);
+  }
+  catch (const IllegalStateException& e)
+  {
+    errorHandler(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, e.what()));
+    return handle;
+  }
+
+  // Send the query and initiate the subscription.
+  subscription->start(node);
+
+  return handle;
 }
 
 } // namespace
@@ -281,6 +712,55 @@ struct TopicMessageQuery::TopicMessageQueryImpl
 
   // The function to run when streaming is complete.
   std::function<void(void)> mCompletionHandler = []() { std::cout << "RPC subscription complete!" << std::endl; };
+
+  // The maximum number of message bytes to hold for partially-received multi-chunk messages.
+  size_t mMaxPendingChunkBytes = DEFAULT_MAX_PENDING_CHUNK_BYTES;
+
+  // The maximum amount of consensus time to wait for the rest of a multi-chunk message.
+  std::chrono::system_clock::duration mMaxPendingChunkAge = DEFAULT_MAX_PENDING_CHUNK_AGE;
+
+  // The function to run when a partially-received multi-chunk message is dropped.
+  std::function<void(const TransactionId&, uint64_t, uint64_t)> mIncompleteMessageHandler;
+
+  // The function to run with the subscription's checkpoint after messages are delivered.
+  std::function<void(const std::chrono::system_clock::time_point&)> mCheckpointHandler;
+
+  // The maximum number of received messages that can wait to be delivered (0 for unbounded).
+  size_t mMaxQueuedMessages = 0ULL;
+
+  // What to do when a message is received while the delivery queue is full.
+  OverflowPolicy mOverflowPolicy = OverflowPolicy::BLOCK;
+
+  // The maximum number of messages delivered in one batch.
+  size_t mMaxBatchSize = DEFAULT_MAX_TOPIC_MESSAGE_BATCH_SIZE;
+
+  // The maximum amount of time to wait for a batch to fill up.
+  std::chrono::system_clock::duration mMaxBatchDelay = DEFAULT_MAX_TOPIC_MESSAGE_BATCH_DELAY;
+
+  // Should messages be delivered as views of the received protobuf objects?
+  bool mDeliverViews = false;
+
+  // Capture the settings of a new subscription.
+  [[nodiscard]] SubscriptionSettings getSubscriptionSettings() const
+  {
+    SubscriptionSettings settings;
+    settings.mQuery = mQuery;
+    settings.mErrorHandler = mErrorHandler;
+    settings.mRetryHandler = mRetryHandler;
+    settings.mCompletionHandler = mCompletionHandler;
+    settings.mIncompleteMessageHandler = mIncompleteMessageHandler;
+    settings.mCheckpointHandler = mCheckpointHandler;
+    settings.mMaxAttempts = mMaxAttempts;
+    settings.mMaxBackoff = mMaxBackoff;
+    settings.mMaxPendingChunkBytes = mMaxPendingChunkBytes;
+    settings.mMaxPendingChunkAge = mMaxPendingChunkAge;
+    settings.mMaxQueuedMessages = mMaxQueuedMessages;
+    settings.mOverflowPolicy = mOverflowPolicy;
+    settings.mMaxBatchSize = mMaxBatchSize;
+    settings.mMaxBatchDelay = mMaxBatchDelay;
+    settings.mDeliverViews = mDeliverViews;
+    return settings;
+  }
 };
 
 //-----
@@ -299,6 +779,13 @@ TopicMessageQuery::TopicMessageQuery(const TopicMessageQuery& other)
   mImpl->mQuery = other.mImpl->mQuery;
   mImpl->mMaxAttempts = other.mImpl->mMaxAttempts;
   mImpl->mMaxBackoff = other.mImpl->mMaxBackoff;
+  mImpl->mMaxPendingChunkBytes = other.mImpl->mMaxPendingChunkBytes;
+  mImpl->mMaxPendingChunkAge = other.mImpl->mMaxPendingChunkAge;
+  mImpl->mMaxQueuedMessages = other.mImpl->mMaxQueuedMessages;
+  mImpl->mOverflowPolicy = other.mImpl->mOverflowPolicy;
+  mImpl->mMaxBatchSize = other.mImpl->mMaxBatchSize;
+  mImpl->mMaxBatchDelay = other.mImpl->mMaxBatchDelay;
+  mImpl->mDeliverViews = other.mImpl->mDeliverViews;
 }
 
 //-----
@@ -309,6 +796,13 @@ TopicMessageQuery& TopicMessageQuery::operator=(const TopicMessageQuery& other)
     mImpl->mQuery = other.mImpl->mQuery;
     mImpl->mMaxAttempts = other.mImpl->mMaxAttempts;
     mImpl->mMaxBackoff = other.mImpl->mMaxBackoff;
+    mImpl->mMaxPendingChunkBytes = other.mImpl->mMaxPendingChunkBytes;
+    mImpl->mMaxPendingChunkAge = other.mImpl->mMaxPendingChunkAge;
+    mImpl->mMaxQueuedMessages = other.mImpl->mMaxQueuedMessages;
+    mImpl->mOverflowPolicy = other.mImpl->mOverflowPolicy;
+    mImpl->mMaxBatchSize = other.mImpl->mMaxBatchSize;
+    mImpl->mMaxBatchDelay = other.mImpl->mMaxBatchDelay;
+    mImpl->mDeliverViews = other.mImpl->mDeliverViews;
   }
 
   return *this;
@@ -340,45 +834,15 @@ TopicMessageQuery& TopicMessageQuery::operator=(TopicMessageQuery&& other) noexc
 std::shared_ptr<SubscriptionHandle> TopicMessageQuery::subscribe(const Client& client,
                                                                  const std::function<void(const TopicMessage&)>& onNext)
 {
-  // Create the subscription handle and assign its unsubscribe function to cancel this TopicMessageQuery's context
-  // (which will cancel the gRPC call).
-  auto handle = std::make_shared<SubscriptionHandle>();
-
-  // Set up the subscription before passing it to the listening thread.
-  auto context = std::make_unique<grpc::ClientContext>();
-  auto queue = std::make_unique<grpc::CompletionQueue>();
-  auto callStatus = std::make_unique<CallStatus>();
-
-  std::shared_ptr<internal::MirrorNode> node;
-  try
-  {
-    node = getConnectedMirrorNode(client.getClientMirrorNetwork());
-  }
-  catch (const IllegalStateException& e)
-  {
-    mImpl->mErrorHandler(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, e.what()));
-    return handle;
-  }
-
-  // Send the query and initiate the subscription.
-  std::thread(
-    &startSubscription,
-    client.getClientMirrorNetwork(),
-    node->getConsensusServiceStub()->AsyncsubscribeTopic(context.get(), mImpl->mQuery, queue.get(), callStatus.get()),
-    std::move(context),
-    std::move(queue),
-    std::move(callStatus),
-    mImpl->mQuery,
-    mImpl->mErrorHandler,
-    mImpl->mRetryHandler,
-    mImpl->mCompletionHandler,
-    onNext,
-    mImpl->mMaxAttempts,
-    mImpl->mMaxBackoff,
-    handle)
-    .detach();
+  return startSubscription(client, mImpl->getSubscriptionSettings(), onNext, {});
+}
 
-  return handle;
+//-----
+std::shared_ptr<SubscriptionHandle> TopicMessageQuery::subscribeInBatches(
+  const Client& client,
+  const std::function<void(const std::vector<TopicMessage>&)>& onNextBatch)
+{
+  return startSubscription(client, mImpl->getSubscriptionSettings(), {}, onNextBatch);
 }
 
 //-----
@@ -444,6 +908,81 @@ TopicMessageQuery& TopicMessageQuery::setCompletionHandler(const std::function<v
   return *this;
 }
 
+//-----
+TopicMessageQuery& TopicMessageQuery::setMaxPendingChunkBytes(size_t bytes)
+{
+  mImpl->mMaxPendingChunkBytes = bytes;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setMaxPendingChunkAge(const std::chrono::system_clock::duration& age)
+{
+  mImpl->mMaxPendingChunkAge = age;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setIncompleteMessageHandler(
+  const std::function<void(const TransactionId&, uint64_t, uint64_t)>& func)
+{
+  mImpl->mIncompleteMessageHandler = func;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setCheckpointHandler(
+  const std::function<void(const std::chrono::system_clock::time_point&)>& func)
+{
+  mImpl->mCheckpointHandler = func;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setMaxQueuedMessages(size_t messages)
+{
+  mImpl->mMaxQueuedMessages = messages;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setOverflowPolicy(OverflowPolicy policy)
+{
+  mImpl->mOverflowPolicy = policy;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setMaxBatchSize(size_t messages)
+{
+  if (messages == 0ULL)
+  {
+    throw std::invalid_argument("Maximum batch size must be greater than 0");
+  }
+
+  mImpl->mMaxBatchSize = messages;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setMaxBatchDelay(const std::chrono::system_clock::duration& delay)
+{
+  if (delay < std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("Maximum batch delay cannot be negative");
+  }
+
+  mImpl->mMaxBatchDelay = delay;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setDeliverViews(bool views)
+{
+  mImpl->mDeliverViews = views;
+  return *this;
+}
+
 //-----
 TopicId TopicMessageQuery::getTopicId() const
 {
@@ -480,4 +1019,58 @@ std::chrono::system_clock::duration TopicMessageQuery::getMaxBackoff() const
   return mImpl->mMaxBackoff;
 }
 
+//-----
+std::function<bool(grpc::Status)> TopicMessageQuery::getRetryHandler() const
+{
+  return mImpl->mRetryHandler;
+}
+
+//-----
+size_t TopicMessageQuery::getMaxPendingChunkBytes() const
+{
+  return mImpl->mMaxPendingChunkBytes;
+}
+
+//-----
+std::chrono::system_clock::duration TopicMessageQuery::getMaxPendingChunkAge() const
+{
+  return mImpl->mMaxPendingChunkAge;
+}
+
+//-----
+std::function<void(const TransactionId&, uint64_t, uint64_t)> TopicMessageQuery::getIncompleteMessageHandler() const
+{
+  return mImpl->mIncompleteMessageHandler;
+}
+
+//-----
+size_t TopicMessageQuery::getMaxQueuedMessages() const
+{
+  return mImpl->mMaxQueuedMessages;
+}
+
+//-----
+TopicMessageQuery::OverflowPolicy TopicMessageQuery::getOverflowPolicy() const
+{
+  return mImpl->mOverflowPolicy;
+}
+
+//-----
+size_t TopicMessageQuery::getMaxBatchSize() const
+{
+  return mImpl->mMaxBatchSize;
+}
+
+//-----
+std::chrono::system_clock::duration TopicMessageQuery::getMaxBatchDelay() const
+{
+  return mImpl->mMaxBatchDelay;
+}
+
+//-----
+bool TopicMessageQuery::getDeliverViews() const
+{
+  return mImpl->mDeliverViews;
+}
+
 } // namespace Hiero
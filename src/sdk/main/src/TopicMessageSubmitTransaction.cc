@@ -9,6 +9,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace Hiero
 {
@@ -51,6 +52,15 @@ TopicMessageSubmitTransaction& TopicMessageSubmitTransaction::setMessage(std::st
   return *this;
 }
 
+//-----
+TopicMessageSubmitTransaction& TopicMessageSubmitTransaction::setMessage(
+  std::shared_ptr<const std::vector<std::byte>> message)
+{
+  requireNotFrozen();
+  setData(std::move(message));
+  return *this;
+}
+
 //-----
 TopicMessageSubmitTransaction& TopicMessageSubmitTransaction::setCustomFeeLimits(
   const std::vector<CustomFeeLimit>& customFeeLimits)
@@ -95,6 +105,8 @@ void TopicMessageSubmitTransaction::validateChecksums(const Client& client) cons
 //-----
 void TopicMessageSubmitTransaction::addToBody(proto::TransactionBody& body) const
 {
+  // The source body holds the whole message, for toBytes() and scheduling. Chunks are built from a copy of it without
+  // the message (see addToChunk()), so this is the only copy of the whole message made when this transaction is frozen.
   body.set_allocated_consensussubmitmessage(build());
 
   // Add custom fee limits to the transaction body
@@ -117,7 +129,7 @@ void TopicMessageSubmitTransaction::addToChunk(uint32_t chunk, uint32_t total, p
 //-----
 void TopicMessageSubmitTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_consensussubmitmessage())
   {
@@ -176,8 +188,8 @@ proto::ConsensusSubmitMessageTransactionBody* TopicMessageSubmitTransaction::bui
     body->set_allocated_topicid(mTopicId.toProtobuf().release());
   }
 
-  body->set_message(internal::Utilities::byteVectorToString(
-    (chunk >= 0) ? getDataForChunk(static_cast<unsigned int>(chunk)) : getData()));
+  body->set_message(
+    std::string(((chunk >= 0) ? getDataViewForChunk(static_cast<unsigned int>(chunk)) : getDataView()).toStringView()));
   return body.release();
 }
 
@@ -0,0 +1,445 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "TopicPublisher.h"
+#include "Client.h"
+#include "Defaults.h"
+#include "Logger.h"
+#include "exceptions/IllegalStateException.h"
+#include "impl/Utilities.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace Hiero
+{
+//-----
+struct TopicPublisher::TopicPublisherImpl
+{
+  // A message waiting to be submitted.
+  struct QueuedMessage
+  {
+    uint64_t mSequence = 0ULL;
+    std::shared_ptr<const std::vector<std::byte>> mData;
+  };
+
+  TopicPublisherImpl(const Client& client, const TopicId& topicId)
+    : mClient(client)
+    , mTopicId(topicId)
+  {
+    mTemplate.setTopicId(topicId);
+  }
+
+  // The Client to use to submit messages.
+  const Client& mClient;
+
+  // The ID of the topic to which to publish.
+  TopicId mTopicId;
+
+  // The transaction from which every submission is built.
+  TopicMessageSubmitTransaction mTemplate;
+
+  // The configuration of the publisher.
+  size_t mQueueCapacity = DEFAULT_TOPIC_PUBLISHER_QUEUE_CAPACITY;
+  OverflowPolicy mOverflowPolicy = OverflowPolicy::BLOCK;
+  unsigned int mMaxInFlight = DEFAULT_TOPIC_PUBLISHER_MAX_IN_FLIGHT;
+  unsigned int mBatchSize = DEFAULT_TOPIC_PUBLISHER_BATCH_SIZE;
+  std::function<void(const PublishResult&)> mResultHandler = [](const PublishResult&) {};
+
+  // Guards everything below.
+  mutable std::mutex mMutex;
+
+  // Signaled when a message is queued or the publisher is closing.
+  std::condition_variable mMessageQueued;
+
+  // Signaled when messages are taken off the queue.
+  std::condition_variable mMessagesTaken;
+
+  // Signaled when a worker finishes a batch.
+  std::condition_variable mBatchFinished;
+
+  // The messages waiting to be submitted.
+  std::deque<QueuedMessage> mQueue;
+
+  // The number of messages taken off the queue whose submission hasn't finished.
+  size_t mInFlight = 0ULL;
+
+  // The sequence number to give the next published message.
+  uint64_t mNextSequence = 0ULL;
+
+  // Has a message been published? The workers are started and the configuration is locked once one has.
+  bool mStarted = false;
+
+  // Is the publisher closing (or closed)?
+  bool mClosing = false;
+
+  // The workers submitting messages.
+  std::vector<std::thread> mWorkers;
+
+  // The statistics of the publisher.
+  uint64_t mPublished = 0ULL;
+  uint64_t mFailed = 0ULL;
+  uint64_t mDropped = 0ULL;
+  std::chrono::steady_clock::time_point mStartTime;
+
+  // Take batches of messages off the queue and submit them until the publisher is closed and the queue is empty.
+  void work();
+
+  // Run the result handler. A handler that throws (on a worker, where the exception would end the process) is logged,
+  // and the batch is still accounted for.
+  void runResultHandler(const PublishResult& result) const
+  {
+    try
+    {
+      mResultHandler(result);
+    }
+    catch (const std::exception& exception)
+    {
+      mClient.getLogger().error(std::string("TopicPublisher result handler threw an exception: ") + exception.what());
+    }
+    catch (...)
+    {
+      mClient.getLogger().error("TopicPublisher result handler threw an unknown exception");
+    }
+  }
+
+  // Is the calling thread one of the workers (i.e. running the result handler)?
+  [[nodiscard]] bool isWorkerThread() const { return tWorkerOf == this; }
+
+  // The publisher whose worker is the calling thread, if any.
+  static inline thread_local const TopicPublisherImpl* tWorkerOf = nullptr;
+
+  // Throw if the configuration can no longer be changed.
+  void checkNotStarted() const
+  {
+    if (mStarted)
+    {
+      throw IllegalStateException("TopicPublisher cannot be configured after a message has been published");
+    }
+  }
+};
+
+//-----
+void TopicPublisher::TopicPublisherImpl::work()
+{
+  tWorkerOf = this;
+
+  std::vector<QueuedMessage> batch;
+  batch.reserve(mBatchSize);
+
+  while (true)
+  {
+    {
+      std::unique_lock lock(mMutex);
+      mMessageQueued.wait(lock, [this]() { return !mQueue.empty() || mClosing; });
+      if (mQueue.empty())
+      {
+        return;
+      }
+
+      while (!mQueue.empty() && batch.size() < mBatchSize)
+      {
+        batch.push_back(std::move(mQueue.front()));
+        mQueue.pop_front();
+      }
+
+      mInFlight += batch.size();
+    }
+    mMessagesTaken.notify_all();
+
+    // Freeze and sign the whole batch before submitting any of it, so signing isn't interleaved with network waits. The
+    // messages are then submitted one at a time.
+    std::vector<PublishResult> results(batch.size());
+    std::vector<std::optional<TopicMessageSubmitTransaction>> transactions(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+      results[i].mSequence = batch[i].mSequence;
+
+      try
+      {
+        transactions[i] = mTemplate;
+        transactions[i]->setMessage(batch[i].mData);
+        transactions[i]->freezeWith(&mClient);
+        transactions[i]->signWithOperator(mClient);
+      }
+      catch (...)
+      {
+        results[i].mError = std::current_exception();
+        transactions[i].reset();
+      }
+    }
+
+    uint64_t published = 0ULL;
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+      if (transactions[i].has_value())
+      {
+        try
+        {
+          results[i].mResponse = transactions[i]->execute(mClient);
+          ++published;
+        }
+        catch (...)
+        {
+          results[i].mError = std::current_exception();
+        }
+      }
+
+      runResultHandler(results[i]);
+    }
+
+    {
+      std::unique_lock lock(mMutex);
+      mPublished += published;
+      mFailed += batch.size() - published;
+      mInFlight -= batch.size();
+    }
+    mBatchFinished.notify_all();
+
+    batch.clear();
+  }
+}
+
+//-----
+TopicPublisher::TopicPublisher(const Client& client, const TopicId& topicId)
+  : mImpl(std::make_unique<TopicPublisherImpl>(client, topicId))
+{
+}
+
+//-----
+TopicPublisher::~TopicPublisher()
+{
+  close();
+}
+
+//-----
+std::optional<uint64_t> TopicPublisher::publish(const std::vector<std::byte>& message)
+{
+  auto data = std::make_shared<const std::vector<std::byte>>(message);
+
+  std::unique_lock lock(mImpl->mMutex);
+  if (mImpl->mClosing)
+  {
+    throw IllegalStateException("Cannot publish to a closed TopicPublisher");
+  }
+
+  if (!mImpl->mStarted)
+  {
+    mImpl->mStarted = true;
+    mImpl->mStartTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0U; i < mImpl->mMaxInFlight; ++i)
+    {
+      mImpl->mWorkers.emplace_back(&TopicPublisherImpl::work, mImpl.get());
+    }
+  }
+
+  if (mImpl->mQueue.size() >= mImpl->mQueueCapacity)
+  {
+    if (mImpl->mOverflowPolicy == OverflowPolicy::DROP)
+    {
+      ++mImpl->mDropped;
+      return {};
+    }
+
+    // A result handler publishing from a worker can't wait for room, since the workers are what make room. Its
+    // message is queued over capacity instead.
+    if (!mImpl->isWorkerThread())
+    {
+      mImpl->mMessagesTaken.wait(
+        lock, [this]() { return mImpl->mQueue.size() < mImpl->mQueueCapacity || mImpl->mClosing; });
+      if (mImpl->mClosing)
+      {
+        throw IllegalStateException("TopicPublisher was closed while waiting to publish");
+      }
+    }
+  }
+
+  const uint64_t sequence = mImpl->mNextSequence++;
+  mImpl->mQueue.push_back({ sequence, std::move(data) });
+  lock.unlock();
+
+  mImpl->mMessageQueued.notify_one();
+  return sequence;
+}
+
+//-----
+std::optional<uint64_t> TopicPublisher::publish(std::string_view message)
+{
+  return publish(internal::Utilities::stringToByteVector(message));
+}
+
+//-----
+void TopicPublisher::flush()
+{
+  if (mImpl->isWorkerThread())
+  {
+    throw IllegalStateException("TopicPublisher cannot be flushed from its result handler");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mBatchFinished.wait(lock, [this]() { return mImpl->mQueue.empty() && mImpl->mInFlight == 0ULL; });
+}
+
+//-----
+void TopicPublisher::close()
+{
+  if (mImpl->isWorkerThread())
+  {
+    throw IllegalStateException("TopicPublisher cannot be closed from its result handler");
+  }
+
+  {
+    std::unique_lock lock(mImpl->mMutex);
+    if (mImpl->mClosing)
+    {
+      return;
+    }
+
+    mImpl->mClosing = true;
+  }
+
+  // Wake up the workers so they can drain the queue and exit, and any publishers blocked on a full queue.
+  mImpl->mMessageQueued.notify_all();
+  mImpl->mMessagesTaken.notify_all();
+
+  for (std::thread& worker : mImpl->mWorkers)
+  {
+    worker.join();
+  }
+
+  mImpl->mWorkers.clear();
+}
+
+//-----
+TopicPublisher& TopicPublisher::setTransactionTemplate(const TopicMessageSubmitTransaction& transaction)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->checkNotStarted();
+  mImpl->mTemplate = transaction;
+  mImpl->mTemplate.setTopicId(mImpl->mTopicId);
+  mImpl->mTemplate.setMessage(std::shared_ptr<const std::vector<std::byte>>());
+  return *this;
+}
+
+//-----
+TopicPublisher& TopicPublisher::setQueueCapacity(size_t capacity)
+{
+  if (capacity == 0ULL)
+  {
+    throw std::invalid_argument("TopicPublisher queue capacity must be greater than 0");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->checkNotStarted();
+  mImpl->mQueueCapacity = capacity;
+  return *this;
+}
+
+//-----
+TopicPublisher& TopicPublisher::setOverflowPolicy(OverflowPolicy policy)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->checkNotStarted();
+  mImpl->mOverflowPolicy = policy;
+  return *this;
+}
+
+//-----
+TopicPublisher& TopicPublisher::setMaxInFlight(unsigned int maxInFlight)
+{
+  if (maxInFlight == 0U)
+  {
+    throw std::invalid_argument("TopicPublisher must be able to have at least one message in flight");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->checkNotStarted();
+  mImpl->mMaxInFlight = maxInFlight;
+  return *this;
+}
+
+//-----
+TopicPublisher& TopicPublisher::setBatchSize(unsigned int batchSize)
+{
+  if (batchSize == 0U)
+  {
+    throw std::invalid_argument("TopicPublisher batch size must be greater than 0");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->checkNotStarted();
+  mImpl->mBatchSize = batchSize;
+  return *this;
+}
+
+//-----
+TopicPublisher& TopicPublisher::setResultHandler(const std::function<void(const PublishResult&)>& func)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->checkNotStarted();
+  mImpl->mResultHandler = func;
+  return *this;
+}
+
+//-----
+TopicId TopicPublisher::getTopicId() const
+{
+  return mImpl->mTopicId;
+}
+
+//-----
+size_t TopicPublisher::getQueueCapacity() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mQueueCapacity;
+}
+
+//-----
+TopicPublisher::OverflowPolicy TopicPublisher::getOverflowPolicy() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mOverflowPolicy;
+}
+
+//-----
+unsigned int TopicPublisher::getMaxInFlight() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mMaxInFlight;
+}
+
+//-----
+unsigned int TopicPublisher::getBatchSize() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mBatchSize;
+}
+
+//-----
+TopicPublisher::Statistics TopicPublisher::getStatistics() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+
+  Statistics statistics;
+  statistics.mPublished = mImpl->mPublished;
+  statistics.mFailed = mImpl->mFailed;
+  statistics.mDropped = mImpl->mDropped;
+  statistics.mQueued = mImpl->mQueue.size();
+
+  if (mImpl->mStarted)
+  {
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - mImpl->mStartTime;
+    if (elapsed.count() > 0.0)
+    {
+      statistics.mMessagesPerSecond = static_cast<double>(mImpl->mPublished) / elapsed.count();
+    }
+  }
+
+  return statistics;
+}
+
+} // namespace Hiero
@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "TopicSubscriptionManager.h"
+#include "Client.h"
+#include "Defaults.h"
+#include "SubscriptionHandle.h"
+#include "TopicCheckpointStore.h"
+#include "TopicMessage.h"
+#include "exceptions/IllegalStateException.h"
+
+#include <grpcpp/impl/codegen/status.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace Hiero
+{
+namespace
+{
+// A subscription to one topic.
+struct ManagedSubscription
+{
+  // Distinguishes this subscription from earlier and later subscriptions to the same topic.
+  uint64_t mId = 0ULL;
+
+  // The handle of the subscription. Destroying it unsubscribes.
+  std::shared_ptr<SubscriptionHandle> mHandle;
+};
+
+// The subscriptions of a TopicSubscriptionManager. Held by shared pointer, so that subscription callbacks that run
+// after the manager is destroyed can tell it's gone.
+struct SubscriptionState
+{
+  std::mutex mMutex;
+  std::unordered_map<TopicId, ManagedSubscription> mSubscriptions;
+  std::function<void(const TopicId&, grpc::Status)> mErrorHandler;
+  uint64_t mNextSubscriptionId = 0ULL;
+  bool mClosed = false;
+};
+
+// Forget a subscription that ended on its own, and report its error (if it failed).
+void onSubscriptionEnded(const std::weak_ptr<SubscriptionState>& weakState,
+                         const TopicId& topicId,
+                         uint64_t subscriptionId,
+                         const grpc::Status* status)
+{
+  const std::shared_ptr<SubscriptionState> state = weakState.lock();
+  if (!state)
+  {
+    return;
+  }
+
+  // The handle is released outside the lock, as releasing it unsubscribes.
+  std::shared_ptr<SubscriptionHandle> handle;
+  std::function<void(const TopicId&, grpc::Status)> errorHandler;
+  {
+    std::unique_lock lock(state->mMutex);
+    const auto iter = state->mSubscriptions.find(topicId);
+
+    // Subscriptions ended by unsubscribing have already been forgotten.
+    if (iter == state->mSubscriptions.end() || iter->second.mId != subscriptionId)
+    {
+      return;
+    }
+
+    handle = std::move(iter->second.mHandle);
+    state->mSubscriptions.erase(iter);
+    errorHandler = state->mErrorHandler;
+  }
+
+  if (status && errorHandler)
+  {
+    errorHandler(topicId, *status);
+  }
+}
+
+// Copy a query template. TopicMessageQuery's copy only copies its settings, so the handlers that a template passes on
+// to its subscriptions are copied explicitly.
+TopicMessageQuery copyQueryTemplate(const TopicMessageQuery& query)
+{
+  TopicMessageQuery copy = query;
+  copy.setRetryHandler(query.getRetryHandler());
+  copy.setIncompleteMessageHandler(query.getIncompleteMessageHandler());
+  return copy;
+}
+
+} // anonymous namespace
+
+//-----
+struct TopicSubscriptionManager::TopicSubscriptionManagerImpl
+{
+  TopicSubscriptionManagerImpl(const Client& client, std::shared_ptr<TopicCheckpointStore> store)
+    : mClient(client)
+    , mStore(std::move(store))
+  {
+  }
+
+  // The Client to use to subscribe. It's held by reference, so it must outlive the manager.
+  const Client& mClient;
+
+  // The store in which to keep checkpoints.
+  std::shared_ptr<TopicCheckpointStore> mStore;
+
+  // The subscriptions.
+  std::shared_ptr<SubscriptionState> mState = std::make_shared<SubscriptionState>();
+
+  // Guards the configuration and the flushing thread's state below.
+  mutable std::mutex mMutex;
+
+  // The query from which every subscription is built.
+  TopicMessageQuery mQueryTemplate;
+
+  // The amount of time between periodic flushes of the checkpoint store.
+  std::chrono::system_clock::duration mCheckpointInterval = DEFAULT_TOPIC_CHECKPOINT_INTERVAL;
+
+  // Signaled when the checkpoint interval changes or flushing should stop.
+  std::condition_variable mFlushConditionVariable;
+
+  // Should the flushing thread stop?
+  bool mStopFlushing = false;
+
+  // The thread flushing the checkpoint store periodically.
+  std::thread mFlushThread;
+
+  // Flush the checkpoint store every checkpoint interval until flushing is stopped.
+  void flushPeriodically()
+  {
+    std::unique_lock lock(mMutex);
+    while (!mStopFlushing)
+    {
+      if (mCheckpointInterval == std::chrono::system_clock::duration::zero())
+      {
+        mFlushConditionVariable.wait(lock);
+        continue;
+      }
+
+      if (mFlushConditionVariable.wait_for(lock, mCheckpointInterval) == std::cv_status::timeout)
+      {
+        lock.unlock();
+
+        // A failed flush leaves the checkpoints to be written by the next one.
+        try
+        {
+          mStore->flush();
+        }
+        catch (const std::exception&)
+        {
+        }
+
+        lock.lock();
+      }
+    }
+  }
+};
+
+//-----
+TopicSubscriptionManager::TopicSubscriptionManager(const Client& client, std::shared_ptr<TopicCheckpointStore> store)
+{
+  if (!store)
+  {
+    throw std::invalid_argument("TopicSubscriptionManager requires a checkpoint store");
+  }
+
+  mImpl = std::make_unique<TopicSubscriptionManagerImpl>(client, std::move(store));
+  mImpl->mFlushThread = std::thread(&TopicSubscriptionManagerImpl::flushPeriodically, mImpl.get());
+}
+
+//-----
+TopicSubscriptionManager::~TopicSubscriptionManager()
+{
+  // A failure to flush the checkpoint store can't be reported from a destructor.
+  try
+  {
+    close();
+  }
+  catch (const std::exception&)
+  {
+  }
+}
+
+//-----
+void TopicSubscriptionManager::subscribe(const TopicId& topicId, const std::function<void(const TopicMessage&)>& onNext)
+{
+  TopicMessageQuery query;
+  {
+    std::unique_lock lock(mImpl->mMutex);
+    query = copyQueryTemplate(mImpl->mQueryTemplate);
+  }
+
+  uint64_t subscriptionId = 0ULL;
+  {
+    std::unique_lock lock(mImpl->mState->mMutex);
+    if (mImpl->mState->mClosed)
+    {
+      throw IllegalStateException("TopicSubscriptionManager is closed");
+    }
+
+    // Reserve the topic, so it can't be subscribed twice while this subscription is started.
+    subscriptionId = ++mImpl->mState->mNextSubscriptionId;
+    if (!mImpl->mState->mSubscriptions.try_emplace(topicId, ManagedSubscription{ subscriptionId, nullptr }).second)
+    {
+      throw IllegalStateException("Already subscribed to topic " + topicId.toString());
+    }
+  }
+
+  query.setTopicId(topicId);
+  if (const std::optional<std::chrono::system_clock::time_point> checkpoint = mImpl->mStore->load(topicId);
+      checkpoint.has_value())
+  {
+    query.setStartTime(*checkpoint + std::chrono::system_clock::duration(1));
+  }
+
+  const std::weak_ptr<SubscriptionState> weakState = mImpl->mState;
+  query.setCheckpointHandler([store = mImpl->mStore, topicId](const std::chrono::system_clock::time_point& checkpoint)
+                             { store->save(topicId, checkpoint); });
+  query.setErrorHandler([weakState, topicId, subscriptionId](const grpc::Status& status)
+                        { onSubscriptionEnded(weakState, topicId, subscriptionId, &status); });
+  query.setCompletionHandler([weakState, topicId, subscriptionId]()
+                             { onSubscriptionEnded(weakState, topicId, subscriptionId, nullptr); });
+
+  std::shared_ptr<SubscriptionHandle> handle = query.subscribe(mImpl->mClient, onNext);
+
+  std::unique_lock lock(mImpl->mState->mMutex);
+  if (const auto iter = mImpl->mState->mSubscriptions.find(topicId);
+      iter != mImpl->mState->mSubscriptions.end() && iter->second.mId == subscriptionId)
+  {
+    iter->second.mHandle = std::move(handle);
+    return;
+  }
+
+  // The subscription was ended (by unsubscribing or closing, or because it failed to start) before its handle was
+  // stored. Unsubscribe outside the lock.
+  lock.unlock();
+  handle->unsubscribe();
+}
+
+//-----
+void TopicSubscriptionManager::unsubscribe(const TopicId& topicId)
+{
+  // The handle is released outside the lock, as releasing it unsubscribes.
+  std::shared_ptr<SubscriptionHandle> handle;
+  {
+    std::unique_lock lock(mImpl->mState->mMutex);
+    const auto iter = mImpl->mState->mSubscriptions.find(topicId);
+    if (iter == mImpl->mState->mSubscriptions.end())
+    {
+      return;
+    }
+
+    handle = std::move(iter->second.mHandle);
+    mImpl->mState->mSubscriptions.erase(iter);
+  }
+}
+
+//-----
+void TopicSubscriptionManager::flushCheckpoints()
+{
+  mImpl->mStore->flush();
+}
+
+//-----
+void TopicSubscriptionManager::close()
+{
+  // The handles are released outside the lock, as releasing them unsubscribes.
+  std::unordered_map<TopicId, ManagedSubscription> subscriptions;
+  {
+    std::unique_lock lock(mImpl->mState->mMutex);
+    if (mImpl->mState->mClosed)
+    {
+      return;
+    }
+
+    mImpl->mState->mClosed = true;
+    subscriptions.swap(mImpl->mState->mSubscriptions);
+  }
+
+  subscriptions.clear();
+
+  {
+    std::unique_lock lock(mImpl->mMutex);
+    mImpl->mStopFlushing = true;
+  }
+
+  mImpl->mFlushConditionVariable.notify_all();
+  mImpl->mFlushThread.join();
+  mImpl->mStore->flush();
+}
+
+//-----
+TopicSubscriptionManager& TopicSubscriptionManager::setQueryTemplate(const TopicMessageQuery& query)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mQueryTemplate = copyQueryTemplate(query);
+  return *this;
+}
+
+//-----
+TopicSubscriptionManager& TopicSubscriptionManager::setCheckpointInterval(
+  const std::chrono::system_clock::duration& interval)
+{
+  if (interval < std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("Checkpoint interval cannot be negative");
+  }
+
+  {
+    std::unique_lock lock(mImpl->mMutex);
+    mImpl->mCheckpointInterval = interval;
+  }
+
+  mImpl->mFlushConditionVariable.notify_all();
+  return *this;
+}
+
+//-----
+TopicSubscriptionManager& TopicSubscriptionManager::setErrorHandler(
+  const std::function<void(const TopicId&, grpc::Status)>& func)
+{
+  std::unique_lock lock(mImpl->mState->mMutex);
+  mImpl->mState->mErrorHandler = func;
+  return *this;
+}
+
+//-----
+TopicMessageQuery TopicSubscriptionManager::getQueryTemplate() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return copyQueryTemplate(mImpl->mQueryTemplate);
+}
+
+//-----
+std::chrono::system_clock::duration TopicSubscriptionManager::getCheckpointInterval() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mCheckpointInterval;
+}
+
+//-----
+std::vector<TopicId> TopicSubscriptionManager::getTopics() const
+{
+  std::unique_lock lock(mImpl->mState->mMutex);
+
+  std::vector<TopicId> topics;
+  topics.reserve(mImpl->mState->mSubscriptions.size());
+  for (const auto& [topicId, subscription] : mImpl->mState->mSubscriptions)
+  {
+    topics.push_back(topicId);
+  }
+
+  return topics;
+}
+
+} // namespace Hiero
@@ -6,6 +6,7 @@
 #include "AccountDeleteTransaction.h"
 #include "AccountUpdateTransaction.h"
 #include "BatchTransaction.h"
+#include "ByteView.h"
 #include "Client.h"
 #include "ContractCreateTransaction.h"
 #include "ContractDeleteTransaction.h"
@@ -63,10 +64,12 @@
 #include "TransactionResponse.h"
 #include "TransferTransaction.h"
 #include "WrappedTransaction.h"
+#include "exceptions/BadKeyException.h"
 #include "exceptions/IllegalStateException.h"
 #include "exceptions/UninitializedException.h"
 #include "impl/DurationConverter.h"
 #include "impl/Network.h"
+#include "impl/SignatureVerifier.h"
 #include "impl/Utilities.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
@@ -77,6 +80,20 @@
 
 #include <transaction_list.pb.h>
 
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/wire_format_lite.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace Hiero
@@ -101,231 +118,333 @@ std::vector<std::byte> extractSignatureBytes(const proto::SignaturePair& pair)
 
   throw IllegalStateException("Unknown signature type");
 }
-} // anonymous namespace
-
-//-----
-template<typename SdkRequestType>
-struct Transaction<SdkRequestType>::TransactionImpl
-{
-  // The source TransactionBody protobuf object from which derived transactions
-  // should use to construct themselves. The Transaction base class will use
-  // this to get the Transaction-specific fields, and then pass it to the
-  // derived class to pick up its own data. It also acts as the "source of
-  // truth" when generating SignedTransaction and Transaction protobuf objects
-  // to send to the network.
-  proto::TransactionBody mSourceTransactionBody;
-
-  // List of completed Transaction protobuf objects ready to be sent. These are
-  // functionally identical, the only difference is the node to which they are
-  // sent.
-  std::vector<proto::Transaction> mTransactions;
 
-  // List of SignedTransaction protobuf objects. The index of these
-  // SignedTransactions match up with their corresponding Transaction protobuf
-  // object in mTransactions.
-  std::vector<proto::SignedTransaction> mSignedTransactions;
+// The tag of each entry of the TransactionList protobuf object's repeated Transaction field: the field number followed
+// by the length-delimited wire type.
+constexpr uint32_t TRANSACTION_LIST_ENTRY_TAG =
+  (static_cast<uint32_t>(proto::TransactionList::kTransactionListFieldNumber) << 3U) | 2U;
 
-  // When submitting a Transaction, the index into mSignedTransactions and
-  // mTransactions must be tracked so that a proper TransactionResponse can be
-  // generated (which must grab the transaction hash and node account ID).
-  unsigned int mTransactionIndex = 0U;
-
-  // A list of PublicKeys with their signer functions that should sign the
-  // TransactionBody protobuf objects this Transaction creates. If the signer
-  // function associated with a public key is empty, that means that the private
-  // key associated with that public key has already contributed a signature,
-  // but the signer is not available (probably because this Transaction was
-  // created fromBytes(), or the signature was contributed manually via
-  // addSignature()).
-  std::unordered_map<std::shared_ptr<PublicKey>, std::function<std::vector<std::byte>(const std::vector<std::byte>&)>>
-    mSignatories;
-
-  // Keep a map of PublicKeys to their associated PrivateKeys. If the
-  // Transaction is signed with a PrivateKey, the Transaction must make sure the
-  // PrivateKey does not go out of scope, otherwise it will crash when trying to
-  // generate a signature.
-  std::unordered_map<std::shared_ptr<PublicKey>, std::shared_ptr<PrivateKey>> mPrivateKeys;
+/**
+ * Compute the serialized size of a TransactionList protobuf object containing the input Transaction protobuf objects.
+ *
+ * @param transactions     The Transaction protobuf objects in the list.
+ * @param transactionSizes Filled with the serialized size of each Transaction protobuf object, so that they don't have
+ *                         to be computed again when writing.
+ * @return The serialized size of the TransactionList protobuf object.
+ */
+size_t getTransactionListSize(const std::vector<const proto::Transaction*>& transactions,
+                              std::vector<size_t>& transactionSizes)
+{
+  transactionSizes.clear();
+  transactionSizes.reserve(transactions.size());
 
-  // Is this Transaction frozen?
-  bool mIsFrozen = false;
+  size_t size = 0ULL;
+  for (const proto::Transaction* transaction : transactions)
+  {
+    const size_t transactionSize = transaction->ByteSizeLong();
+    transactionSizes.push_back(transactionSize);
+    size += google::protobuf::io::CodedOutputStream::VarintSize32(TRANSACTION_LIST_ENTRY_TAG) +
+            google::protobuf::io::CodedOutputStream::VarintSize64(transactionSize) + transactionSize;
+  }
 
-  // The ID of this Transaction. No value if it has not yet been set.
-  std::optional<TransactionId> mTransactionId;
+  return size;
+}
 
-  // The maximum transaction fee willing to be paid to execute this Transaction.
-  // If not set, this Transaction will use the Client's set maximum transaction
-  // fee. If that's not set, mDefaultMaxTransactionFee is used.
-  std::optional<Hbar> mMaxTransactionFee;
+/**
+ * Write the input Transaction protobuf objects as a serialized TransactionList protobuf object, without first copying
+ * them into a TransactionList protobuf object.
+ *
+ * @param transactions     The Transaction protobuf objects to write.
+ * @param transactionSizes The serialized size of each Transaction protobuf object, from getTransactionListSize().
+ * @param stream           The stream to which to write.
+ */
+void writeTransactionList(const std::vector<const proto::Transaction*>& transactions,
+                          const std::vector<size_t>& transactionSizes,
+                          google::protobuf::io::CodedOutputStream& stream)
+{
+  for (size_t i = 0; i < transactions.size(); ++i)
+  {
+    stream.WriteVarint32(TRANSACTION_LIST_ENTRY_TAG);
+    stream.WriteVarint64(transactionSizes[i]);
+    transactions[i]->SerializeWithCachedSizes(&stream);
+  }
+}
 
-  // The default maximum transaction fee. This can be adjusted by derived
-  // Transaction classes if those Transactions generally cost more.
-  Hbar mDefaultMaxTransactionFee = DEFAULT_MAX_TRANSACTION_FEE;
+/**
+ * Parse the entries of a serialized TransactionList protobuf object. The entries are first located in the input bytes
+ * and then each one is parsed directly from its location, so the bytes are never copied into an intermediate
+ * TransactionList protobuf object.
+ *
+ * @param bytes   The bytes to parse.
+ * @param entries Filled with the parsed Transaction protobuf objects.
+ * @return \c TRUE if the bytes are a TransactionList protobuf object with at least one entry, otherwise \c FALSE.
+ */
+bool parseTransactionList(ByteView bytes, std::vector<proto::Transaction>& entries)
+{
+  std::vector<ByteView> entryBytes;
+  google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(bytes.data()),
+                                               static_cast<int>(bytes.size()));
+  while (const uint32_t tag = input.ReadTag())
+  {
+    // Unknown fields are skipped, the same as they would be when parsing a TransactionList protobuf object.
+    if (tag != TRANSACTION_LIST_ENTRY_TAG)
+    {
+      if (!google::protobuf::internal::WireFormatLite::SkipField(&input, tag))
+      {
+        return false;
+      }
 
-  // The length of time this Transaction will remain valid.
-  std::chrono::system_clock::duration mTransactionValidDuration = DEFAULT_TRANSACTION_VALID_DURATION;
+      continue;
+    }
 
-  // The memo to be associated with this Transaction.
-  std::string mTransactionMemo;
+    uint32_t length = 0U;
+    if (!input.ReadVarint32(&length) || length > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+    {
+      return false;
+    }
 
-  // Should this Transaction regenerate its TransactionId upon a
-  // TRANSACTION_EXPIRED response from the network? If not set, this Transaction
-  // will use the Client's set transaction ID regeneration policy. If that's not
-  // set, the default behavior is captured in DEFAULT_REGENERATE_TRANSACTION_ID.
-  std::optional<bool> mTransactionIdRegenerationPolicy;
+    const auto offset = static_cast<size_t>(input.CurrentPosition());
+    if (!input.Skip(static_cast<int>(length)))
+    {
+      return false;
+    }
 
-  /**
-   * The public key of the trusted batch assembler.
-   */
-  std::shared_ptr<Key> mBatchKey = nullptr;
+    entryBytes.push_back(bytes.subview(offset, length));
+  }
 
-  /**
-   * This flag is used to determine whether a Transaction's TransactionId
-   * should be regenerated if the Transaction expires.
-   *
-   * Rules:
-   * 1. If `mTransactionIdManualSet` is `true`, the TransactionId was set manually by the user,
-   *    and it **must not be regenerated**, regardless of client-wide or transaction-specific
-   *    regeneration policies.
-   * 2. If `mTransactionIdManualSet` is `false` (default), the TransactionId **may be regenerated**
-   *    based on the transaction's own `mTransactionIdRegenerationPolicy` or the client's policy.
-   */
+  if (!input.ConsumedEntireMessage() || entryBytes.empty())
+  {
+    return false;
+  }
 
-  bool mTransactionIdManualSet = false;
+  entries.resize(entryBytes.size());
+  for (size_t i = 0; i < entryBytes.size(); ++i)
+  {
+    if (!entries[i].ParseFromArray(entryBytes[i].data(), static_cast<int>(entryBytes[i].size())))
+    {
+      return false;
+    }
+  }
 
-  /**
-   * Whether this transaction uses high-volume entity creation throttles and pricing.
-   */
-  bool mHighVolume = false;
-};
+  return true;
+}
 
-//-----
-template<typename SdkRequestType>
-WrappedTransaction Transaction<SdkRequestType>::fromBytes(const std::vector<std::byte>& bytes)
+/**
+ * Read a varint from an input stream, keeping the bytes that were read.
+ *
+ * @param input    The stream from which to read.
+ * @param consumed The byte array to which to append the bytes that were read.
+ * @param value    The read value.
+ * @return \c TRUE if a complete varint was read, otherwise \c FALSE.
+ */
+bool readVarint(std::istream& input, std::vector<std::byte>& consumed, uint64_t& value)
 {
-  // Keep a list of all transactions that were serialized.
-  std::map<TransactionId, std::map<AccountId, proto::Transaction>> transactions;
+  value = 0ULL;
+  for (unsigned int shift = 0U; shift < 64U; shift += 7U)
+  {
+    const std::istream::int_type byte = input.get();
+    if (byte == std::istream::traits_type::eof())
+    {
+      return false;
+    }
 
-  proto::Transaction tx;
-  proto::SignedTransaction signedTx;
-  proto::TransactionBody txBody;
-  proto::TransactionBody::DataCase expectedDataCase = proto::TransactionBody::DATA_NOT_SET;
+    consumed.push_back(static_cast<std::byte>(byte));
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      return true;
+    }
+  }
 
-  bool batchified = false;
+  return false;
+}
 
-  // Check if batchified
-  tx.set_signedtransactionbytes(internal::Utilities::byteVectorToString(bytes));
-  signedTx.ParseFromArray(tx.signedtransactionbytes().data(), static_cast<int>(tx.signedtransactionbytes().size()));
-  txBody.ParseFromArray(signedTx.bodybytes().data(), static_cast<int>(signedTx.bodybytes().size()));
-  if (txBody.has_batch_key())
+/**
+ * Read the first entry of a serialized TransactionList protobuf object from an input stream.
+ *
+ * @param input    The stream from which to read.
+ * @param consumed The byte array to which to append all the bytes that were read, so that they can be parsed in some
+ *                 other way if the stream doesn't contain a TransactionList protobuf object.
+ * @param entry    The parsed entry.
+ * @return \c TRUE if the stream begins with a TransactionList protobuf object entry, otherwise \c FALSE.
+ */
+bool readFirstTransactionListEntry(std::istream& input, std::vector<std::byte>& consumed, proto::Transaction& entry)
+{
+  uint64_t tag = 0ULL;
+  uint64_t length = 0ULL;
+  if (!readVarint(input, consumed, tag) || tag != TRANSACTION_LIST_ENTRY_TAG || !readVarint(input, consumed, length) ||
+      length > static_cast<uint64_t>(std::numeric_limits<int>::max()))
   {
-    batchified = true;
-    transactions[txBody.has_transactionid() ? TransactionId::fromProtobuf(txBody.transactionid())
-                                            : DUMMY_TRANSACTION_ID]
-                [txBody.has_nodeaccountid() ? AccountId::fromProtobuf(txBody.nodeaccountid()) : DUMMY_ACCOUNT_ID] = tx;
+    return false;
   }
 
-  if (!batchified)
+  // Read in blocks instead of allocating the claimed length up front, since it hasn't been validated yet.
+  constexpr size_t BLOCK_SIZE = 64ULL * 1024ULL;
+  const size_t entryOffset = consumed.size();
+  for (size_t remaining = length; remaining > 0ULL;)
   {
-    // Serialized object is a TransactionList protobuf object.
-    if (proto::TransactionList txList;
-        txList.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())) && txList.transaction_list_size() > 0)
+    const size_t blockSize = std::min(remaining, BLOCK_SIZE);
+    const size_t blockOffset = consumed.size();
+    consumed.resize(blockOffset + blockSize);
+    input.read(reinterpret_cast<char*>(consumed.data() + blockOffset), static_cast<std::streamsize>(blockSize));
+
+    const auto read = static_cast<size_t>(input.gcount());
+    if (read < blockSize)
     {
-      std::string currentGroupRefBodyBytes;
-      std::string currentGroupTxIdBytes;
+      consumed.resize(blockOffset + read);
+      return false;
+    }
 
-      for (int i = 0; i < txList.transaction_list_size(); ++i)
-      {
-        tx = txList.transaction_list(i);
-        signedTx.ParseFromArray(tx.signedtransactionbytes().data(),
-                                static_cast<int>(tx.signedtransactionbytes().size()));
-        txBody.ParseFromArray(signedTx.bodybytes().data(), static_cast<int>(signedTx.bodybytes().size()));
-
-        // Security: Validate that all entries have the same transaction type.
-        // This is critical to prevent transaction smuggling where an attacker injects
-        // a hidden malicious transaction with a different type that gets signed but not displayed.
-        if (i == 0)
-        {
-          expectedDataCase = txBody.data_case();
-        }
-        else if (txBody.data_case() != expectedDataCase)
-        {
-          throw std::invalid_argument(
-            "Transaction list contains entries with inconsistent transaction types. "
-            "All entries must have the same transaction type to prevent transaction smuggling attacks.");
-        }
+    remaining -= read;
+  }
 
-        std::string thisTxIdBytes = txBody.transactionid().SerializeAsString();
+  // A SignedTransaction or TransactionBody protobuf object also begins with a length-delimited first field, but that
+  // field won't parse as a Transaction protobuf object with signed transaction bytes.
+  return entry.ParseFromArray(consumed.data() + entryOffset, static_cast<int>(length)) &&
+         !entry.signedtransactionbytes().empty();
+}
 
-        // Create a sanitized body (removing NodeAccountID) for comparison
-        proto::TransactionBody bodyForComparison = txBody;
-        bodyForComparison.clear_nodeaccountid();
-        const std::string currentSanitizedBodyBytes = bodyForComparison.SerializeAsString();
+/**
+ * Groups deserialized Transaction protobuf objects by TransactionId and node account ID, validating each one as it's
+ * added so that the entries of a TransactionList protobuf object can be added one at a time as they're read.
+ */
+class TransactionListBuilder
+{
+public:
+  /**
+   * Construct with the IDs to use for Transaction protobuf objects without a TransactionId or node account ID.
+   *
+   * @param dummyTransactionId The TransactionId to use for Transaction protobuf objects without a TransactionId.
+   * @param dummyAccountId     The node account ID to use for Transaction protobuf objects without a node account ID.
+   */
+  TransactionListBuilder(const TransactionId& dummyTransactionId, const AccountId& dummyAccountId)
+    : mDummyTransactionId(dummyTransactionId)
+    , mDummyAccountId(dummyAccountId)
+  {
+  }
 
-        // Transactions are grouped by transactionId. Within each group, all entries
-        // should have identical body bytes (after clearing nodeAccountId, which is
-        // expected to vary). This allows chunked transactions (different transactionIds)
-        // while still validating consistency within each chunk's node variations.
-        if (i == 0 || thisTxIdBytes != currentGroupTxIdBytes)
-        {
-          currentGroupTxIdBytes = thisTxIdBytes;
-          currentGroupRefBodyBytes = currentSanitizedBodyBytes;
-        }
-        else
-        {
-          if (currentSanitizedBodyBytes != currentGroupRefBodyBytes)
-          {
-            throw std::invalid_argument("Transaction list contains entries with inconsistent body bytes");
-          }
-        }
+  /**
+   * Add a Transaction protobuf object.
+   *
+   * @param transaction The Transaction protobuf object to add.
+   * @throws std::invalid_argument If the Transaction protobuf object is of a different type than the previously added
+   *                               ones, or if its body differs from the other bodies with the same TransactionId.
+   */
+  void add(proto::Transaction&& transaction)
+  {
+    mSignedTx.ParseFromString(transaction.signedtransactionbytes());
+    mTxBody.ParseFromString(mSignedTx.bodybytes());
 
-        transactions[txBody.has_transactionid() ? TransactionId::fromProtobuf(txBody.transactionid())
-                                                : DUMMY_TRANSACTION_ID]
-                    [txBody.has_nodeaccountid() ? AccountId::fromProtobuf(txBody.nodeaccountid()) : DUMMY_ACCOUNT_ID] =
-                      tx;
-      }
+    // Security: Validate that all entries have the same transaction type.
+    // This is critical to prevent transaction smuggling where an attacker injects
+    // a hidden malicious transaction with a different type that gets signed but not displayed.
+    if (mTransactionCount == 0ULL)
+    {
+      mDataCase = mTxBody.data_case();
     }
-
-    // Transaction protobuf object.
-    else if (txBody.data_case() == proto::TransactionBody::DataCase::DATA_NOT_SET &&
-             tx.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())) && !tx.signedtransactionbytes().empty())
+    else if (mTxBody.data_case() != mDataCase)
     {
-      signedTx.ParseFromArray(tx.signedtransactionbytes().data(), static_cast<int>(tx.signedtransactionbytes().size()));
-      txBody.ParseFromArray(signedTx.bodybytes().data(), static_cast<int>(signedTx.bodybytes().size()));
-
-      transactions[txBody.has_transactionid() ? TransactionId::fromProtobuf(txBody.transactionid())
-                                              : DUMMY_TRANSACTION_ID]
-                  [txBody.has_nodeaccountid() ? AccountId::fromProtobuf(txBody.nodeaccountid()) : DUMMY_ACCOUNT_ID] =
-                    tx;
+      throw std::invalid_argument(
+        "Transaction list contains entries with inconsistent transaction types. "
+        "All entries must have the same transaction type to prevent transaction smuggling attacks.");
     }
 
-    // TransactionBody protobuf object.
-    else if (txBody.data_case() == proto::TransactionBody::DataCase::DATA_NOT_SET &&
-             txBody.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())))
+    const TransactionId transactionId =
+      mTxBody.has_transactionid() ? TransactionId::fromProtobuf(mTxBody.transactionid()) : mDummyTransactionId;
+    const AccountId accountId =
+      mTxBody.has_nodeaccountid() ? AccountId::fromProtobuf(mTxBody.nodeaccountid()) : mDummyAccountId;
+
+    // Transactions are grouped by transactionId. Within each group, all entries
+    // should have identical body bytes (after clearing nodeAccountId, which is
+    // expected to vary). This allows chunked transactions (different transactionIds)
+    // while still validating consistency within each chunk's node variations. The body is sanitized in place, since
+    // it isn't needed once the IDs have been read.
+    mTxBody.transactionid().SerializeToString(&mTxIdBytes);
+    mTxBody.clear_nodeaccountid();
+    mTxBody.SerializeToString(&mSanitizedBodyBytes);
+
+    if (mTransactionCount == 0ULL || mTxIdBytes != mGroupTxIdBytes)
     {
-      signedTx.set_bodybytes(txBody.SerializeAsString());
-      tx.set_signedtransactionbytes(signedTx.SerializeAsString());
-
-      transactions[txBody.has_transactionid() ? TransactionId::fromProtobuf(txBody.transactionid())
-                                              : DUMMY_TRANSACTION_ID]
-                  [txBody.has_nodeaccountid() ? AccountId::fromProtobuf(txBody.nodeaccountid()) : DUMMY_ACCOUNT_ID] =
-                    tx;
+      mGroupTxIdBytes.swap(mTxIdBytes);
+      mGroupBodyBytes.swap(mSanitizedBodyBytes);
     }
-
-    // If not any Transaction, throw.
-    else
+    else if (mSanitizedBodyBytes != mGroupBodyBytes)
     {
-      throw std::invalid_argument("Unable to construct Transaction from input bytes.");
+      throw std::invalid_argument("Transaction list contains entries with inconsistent body bytes");
     }
+
+    mTransactions[transactionId][accountId] = std::move(transaction);
+    ++mTransactionCount;
   }
 
+  /**
+   * Get the type of the added Transaction protobuf objects.
+   *
+   * @return The type of the added Transaction protobuf objects.
+   */
+  [[nodiscard]] proto::TransactionBody::DataCase getDataCase() const { return mDataCase; }
+
+  /**
+   * Get the added Transaction protobuf objects, grouped by TransactionId and node account ID.
+   *
+   * @return The added Transaction protobuf objects.
+   */
+  [[nodiscard]] const std::map<TransactionId, std::map<AccountId, proto::Transaction>>& getTransactions() const
+  {
+    return mTransactions;
+  }
+
+private:
+  /**
+   * The IDs to use for Transaction protobuf objects without a TransactionId or node account ID.
+   */
+  const TransactionId& mDummyTransactionId;
+  const AccountId& mDummyAccountId;
+
+  /**
+   * The added Transaction protobuf objects, grouped by TransactionId and node account ID.
+   */
+  std::map<TransactionId, std::map<AccountId, proto::Transaction>> mTransactions;
+
+  /**
+   * The number of added Transaction protobuf objects, and their type.
+   */
+  size_t mTransactionCount = 0ULL;
+  proto::TransactionBody::DataCase mDataCase = proto::TransactionBody::DATA_NOT_SET;
+
+  /**
+   * The serialized TransactionId and sanitized body of the current TransactionId group.
+   */
+  std::string mGroupTxIdBytes;
+  std::string mGroupBodyBytes;
+
+  /**
+   * Scratch objects reused for each added Transaction protobuf object.
+   */
+  proto::SignedTransaction mSignedTx;
+  proto::TransactionBody mTxBody;
+  std::string mTxIdBytes;
+  std::string mSanitizedBodyBytes;
+};
+
+/**
+ * Construct the derived Transaction of the input type from deserialized Transaction protobuf objects.
+ *
+ * @param transactions The deserialized Transaction protobuf objects, grouped by TransactionId and node account ID.
+ * @param dataCase     The type of the deserialized Transaction protobuf objects.
+ * @return A WrappedTransaction which contains the deserialized Transaction.
+ * @throws std::invalid_argument If the type is unknown, or if a non-chunked type has multiple TransactionIds.
+ */
+WrappedTransaction wrapTransactions(
+  const std::map<TransactionId, std::map<AccountId, proto::Transaction>>& transactions,
+  proto::TransactionBody::DataCase dataCase)
+{
   // Security: For non-chunked transaction types, reject if there are multiple transactionIds.
   // Only FileAppend and TopicMessageSubmit (chunked transactions) legitimately have multiple transactionIds.
   // This prevents an attacker from smuggling hidden transactions with different transactionIds
   // that would get signed but not displayed to the user.
-  const auto transactionType =
-    (expectedDataCase != proto::TransactionBody::DATA_NOT_SET) ? expectedDataCase : txBody.data_case();
-  const bool isChunkedTransactionType = (transactionType == proto::TransactionBody::kFileAppend ||
-                                         transactionType == proto::TransactionBody::kConsensusSubmitMessage);
+  const bool isChunkedTransactionType =
+    (dataCase == proto::TransactionBody::kFileAppend || dataCase == proto::TransactionBody::kConsensusSubmitMessage);
 
   if (!isChunkedTransactionType && transactions.size() > 1)
   {
@@ -335,7 +454,7 @@ WrappedTransaction Transaction<SdkRequestType>::fromBytes(const std::vector<std:
       "Only FileAppend and TopicMessageSubmit support multiple transaction IDs for chunking.");
   }
 
-  switch (txBody.data_case())
+  switch (dataCase)
   {
     case proto::TransactionBody::kCryptoApproveAllowance:
       return WrappedTransaction(AccountAllowanceApproveTransaction(transactions));
@@ -450,47 +569,261 @@ WrappedTransaction Transaction<SdkRequestType>::fromBytes(const std::vector<std:
   }
 }
 
+} // anonymous namespace
+
 //-----
 template<typename SdkRequestType>
-std::vector<std::byte> Transaction<SdkRequestType>::toBytes() const
+struct Transaction<SdkRequestType>::TransactionImpl
 {
-  // If no nodes have been selected yet, the mSourceTransactionBody can be used
-  // to build a Transaction protobuf object.
-  proto::TransactionList txList;
-  if (Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::
-        getNodeAccountIds()
-          .empty())
-  {
-    // Make sure the Transaction has, if any, all recent changes.
-    updateSourceTransactionBody(nullptr);
+  // The source TransactionBody protobuf object from which derived transactions
+  // should use to construct themselves. The Transaction base class will use
+  // this to get the Transaction-specific fields, and then pass it to the
+  // derived class to pick up its own data. It also acts as the "source of
+  // truth" when generating SignedTransaction and Transaction protobuf objects
+  // to send to the network.
+  proto::TransactionBody mSourceTransactionBody;
 
-    proto::SignedTransaction signedTx;
-    signedTx.set_bodybytes(mImpl->mSourceTransactionBody.SerializeAsString());
+  // List of completed Transaction protobuf objects ready to be sent. These are
+  // functionally identical, the only difference is the node to which they are
+  // sent.
+  std::vector<proto::Transaction> mTransactions;
+
+  // List of SignedTransaction protobuf objects. The index of these
+  // SignedTransactions match up with their corresponding Transaction protobuf
+  // object in mTransactions.
+  std::vector<proto::SignedTransaction> mSignedTransactions;
 
+  // When submitting a Transaction, the index into mSignedTransactions and
+  // mTransactions must be tracked so that a proper TransactionResponse can be
+  // generated (which must grab the transaction hash and node account ID).
+  unsigned int mTransactionIndex = 0U;
+
+  // A list of PublicKeys with their signer functions that should sign the
+  // TransactionBody protobuf objects this Transaction creates. If the signer
+  // function associated with a public key is empty, that means that the private
+  // key associated with that public key has already contributed a signature,
+  // but the signer is not available (probably because this Transaction was
+  // created fromBytes(), or the signature was contributed manually via
+  // addSignature()).
+  std::unordered_map<std::shared_ptr<PublicKey>, std::function<std::vector<std::byte>(const std::vector<std::byte>&)>>
+    mSignatories;
+
+  // Keep a map of PublicKeys to their associated PrivateKeys. If the
+  // Transaction is signed with a PrivateKey, the Transaction must make sure the
+  // PrivateKey does not go out of scope, otherwise it will crash when trying to
+  // generate a signature.
+  std::unordered_map<std::shared_ptr<PublicKey>, std::shared_ptr<PrivateKey>> mPrivateKeys;
+
+  // Is this Transaction frozen?
+  bool mIsFrozen = false;
+
+  // The ID of this Transaction. No value if it has not yet been set.
+  std::optional<TransactionId> mTransactionId;
+
+  // The maximum transaction fee willing to be paid to execute this Transaction.
+  // If not set, this Transaction will use the Client's set maximum transaction
+  // fee. If that's not set, mDefaultMaxTransactionFee is used.
+  std::optional<Hbar> mMaxTransactionFee;
+
+  // The default maximum transaction fee. This can be adjusted by derived
+  // Transaction classes if those Transactions generally cost more.
+  Hbar mDefaultMaxTransactionFee = DEFAULT_MAX_TRANSACTION_FEE;
+
+  // The length of time this Transaction will remain valid.
+  std::chrono::system_clock::duration mTransactionValidDuration = DEFAULT_TRANSACTION_VALID_DURATION;
+
+  // The memo to be associated with this Transaction.
+  std::string mTransactionMemo;
+
+  // Should this Transaction regenerate its TransactionId upon a
+  // TRANSACTION_EXPIRED response from the network? If not set, this Transaction
+  // will use the Client's set transaction ID regeneration policy. If that's not
+  // set, the default behavior is captured in DEFAULT_REGENERATE_TRANSACTION_ID.
+  std::optional<bool> mTransactionIdRegenerationPolicy;
+
+  /**
+   * The public key of the trusted batch assembler.
+   */
+  std::shared_ptr<Key> mBatchKey = nullptr;
+
+  /**
+   * This flag is used to determine whether a Transaction's TransactionId
+   * should be regenerated if the Transaction expires.
+   *
+   * Rules:
+   * 1. If `mTransactionIdManualSet` is `true`, the TransactionId was set manually by the user,
+   *    and it **must not be regenerated**, regardless of client-wide or transaction-specific
+   *    regeneration policies.
+   * 2. If `mTransactionIdManualSet` is `false` (default), the TransactionId **may be regenerated**
+   *    based on the transaction's own `mTransactionIdRegenerationPolicy` or the client's policy.
+   */
+
+  bool mTransactionIdManualSet = false;
+
+  /**
+   * Whether this transaction uses high-volume entity creation throttles and pricing.
+   */
+  bool mHighVolume = false;
+};
+
+//-----
+template<typename SdkRequestType>
+WrappedTransaction Transaction<SdkRequestType>::fromBytes(const std::vector<std::byte>& bytes)
+{
+  // Keep a list of all transactions that were serialized.
+  TransactionListBuilder transactions(DUMMY_TRANSACTION_ID, DUMMY_ACCOUNT_ID);
+
+  // Check if batchified. The bytes are parsed in place, so they're only copied if they are.
+  proto::SignedTransaction signedTx;
+  proto::TransactionBody txBody;
+  signedTx.ParseFromArray(bytes.data(), static_cast<int>(bytes.size()));
+  txBody.ParseFromString(signedTx.bodybytes());
+
+  if (txBody.has_batch_key())
+  {
     proto::Transaction tx;
-    tx.set_signedtransactionbytes(signedTx.SerializeAsString());
+    tx.set_signedtransactionbytes(internal::Utilities::byteVectorToString(bytes));
+    transactions.add(std::move(tx));
+  }
+
+  // Serialized object is a TransactionList protobuf object.
+  else if (std::vector<proto::Transaction> entries; parseTransactionList(bytes, entries))
+  {
+    for (proto::Transaction& entry : entries)
+    {
+      transactions.add(std::move(entry));
+    }
+  }
+
+  // Transaction protobuf object.
+  else if (proto::Transaction tx; txBody.data_case() == proto::TransactionBody::DataCase::DATA_NOT_SET &&
+                                  tx.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())) &&
+                                  !tx.signedtransactionbytes().empty())
+  {
+    transactions.add(std::move(tx));
+  }
+
+  // TransactionBody protobuf object.
+  else if (txBody.data_case() == proto::TransactionBody::DataCase::DATA_NOT_SET &&
+           txBody.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())))
+  {
+    signedTx.set_bodybytes(txBody.SerializeAsString());
 
-    *txList.add_transaction_list() = tx;
+    proto::Transaction bodyTx;
+    bodyTx.set_signedtransactionbytes(signedTx.SerializeAsString());
+    transactions.add(std::move(bodyTx));
   }
+
+  // If not any Transaction, throw.
   else
   {
-    // Generate the SignedTransaction protobuf objects if the Transaction's not
-    // frozen.
-    if (!isFrozen())
+    throw std::invalid_argument("Unable to construct Transaction from input bytes.");
+  }
+
+  return wrapTransactions(transactions.getTransactions(), transactions.getDataCase());
+}
+
+//-----
+template<typename SdkRequestType>
+WrappedTransaction Transaction<SdkRequestType>::fromBytes(std::istream& input)
+{
+  // Only a TransactionList protobuf object can hold more than one transaction, so if the stream holds anything else,
+  // it's small enough to just read completely and deserialize from memory.
+  std::vector<std::byte> consumed;
+  proto::Transaction entry;
+  if (!readFirstTransactionListEntry(input, consumed, entry))
+  {
+    consumed.insert(consumed.end(), std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    return fromBytes(consumed);
+  }
+
+  consumed.clear();
+  consumed.shrink_to_fit();
+
+  TransactionListBuilder transactions(DUMMY_TRANSACTION_ID, DUMMY_ACCOUNT_ID);
+  transactions.add(std::move(entry));
+
+  // Read the rest of the entries one at a time, so that only one serialized entry is held in memory at once.
+  google::protobuf::io::IstreamInputStream streamInput(&input);
+  google::protobuf::io::CodedInputStream codedInput(&streamInput);
+  std::string entryBytes;
+  while (const uint32_t tag = codedInput.ReadTag())
+  {
+    if (tag != TRANSACTION_LIST_ENTRY_TAG)
     {
-      regenerateSignedTransactions(nullptr);
+      if (!google::protobuf::internal::WireFormatLite::SkipField(&codedInput, tag))
+      {
+        throw std::invalid_argument("Unable to construct Transaction from input bytes.");
+      }
+
+      continue;
     }
 
-    // Build all the Transaction protobuf objects and add them to the
-    // TransactionList protobuf object.
-    buildAllTransactions();
-    for (const auto& tx : mImpl->mTransactions)
+    if (uint32_t length = 0U;
+        !codedInput.ReadVarint32(&length) || length > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+        !codedInput.ReadString(&entryBytes, static_cast<int>(length)) || !entry.ParseFromString(entryBytes))
     {
-      *txList.add_transaction_list() = tx;
+      throw std::invalid_argument("Unable to construct Transaction from input bytes.");
     }
+
+    transactions.add(std::move(entry));
+  }
+
+  if (!codedInput.ConsumedEntireMessage())
+  {
+    throw std::invalid_argument("Unable to construct Transaction from input bytes.");
   }
 
-  return internal::Utilities::stringToByteVector(txList.SerializeAsString());
+  return wrapTransactions(transactions.getTransactions(), transactions.getDataCase());
+}
+
+//-----
+template<typename SdkRequestType>
+std::vector<std::byte> Transaction<SdkRequestType>::toBytes() const
+{
+  std::vector<std::byte> bytes;
+  toBytes(bytes);
+  return bytes;
+}
+
+//-----
+template<typename SdkRequestType>
+void Transaction<SdkRequestType>::toBytes(std::vector<std::byte>& out) const
+{
+  proto::Transaction unbuiltTransaction;
+  const std::vector<const proto::Transaction*> transactions = getTransactionsToSerialize(unbuiltTransaction);
+
+  std::vector<size_t> transactionSizes;
+  out.resize(getTransactionListSize(transactions, transactionSizes));
+
+  google::protobuf::io::ArrayOutputStream arrayStream(internal::Utilities::toTypePtr<unsigned char>(out.data()),
+                                                      static_cast<int>(out.size()));
+  google::protobuf::io::CodedOutputStream codedStream(&arrayStream);
+  writeTransactionList(transactions, transactionSizes, codedStream);
+}
+
+//-----
+template<typename SdkRequestType>
+std::ostream& Transaction<SdkRequestType>::writeTo(std::ostream& os) const
+{
+  proto::Transaction unbuiltTransaction;
+  const std::vector<const proto::Transaction*> transactions = getTransactionsToSerialize(unbuiltTransaction);
+
+  std::vector<size_t> transactionSizes;
+  static_cast<void>(getTransactionListSize(transactions, transactionSizes));
+
+  // The coded stream must be destroyed (and therefore flushed) before the output stream's state is checked.
+  {
+    google::protobuf::io::OstreamOutputStream ostreamStream(&os);
+    google::protobuf::io::CodedOutputStream codedStream(&ostreamStream);
+    writeTransactionList(transactions, transactionSizes, codedStream);
+    if (codedStream.HadError())
+    {
+      os.setstate(std::ios_base::badbit);
+    }
+  }
+
+  return os;
 }
 
 //-----
@@ -776,6 +1109,23 @@ Transaction<SdkRequestType>::removeAllSignatures()
   return removedByKey;
 }
 
+//-----
+template<typename SdkRequestType>
+std::vector<SignatureVerificationResult> Transaction<SdkRequestType>::verifyAllSignatures() const
+{
+  std::vector<internal::SignatureVerifier::SignatureCheck> checks = getSignatureChecks();
+  internal::SignatureVerifier::verifySignatures(checks);
+
+  std::vector<SignatureVerificationResult> results;
+  results.reserve(checks.size());
+  for (internal::SignatureVerifier::SignatureCheck& check : checks)
+  {
+    results.push_back(std::move(check.mResult));
+  }
+
+  return results;
+}
+
 //-----
 template<typename SdkRequestType>
 SdkRequestType& Transaction<SdkRequestType>::freeze()
@@ -878,8 +1228,7 @@ std::vector<std::byte> Transaction<SdkRequestType>::getTransactionHash() const
 
   // Use the first transaction's hash.
   buildTransaction(0U);
-  return internal::OpenSSLUtils::computeSHA384(
-    internal::Utilities::stringToByteVector(getTransactionProtobufObject(0U).signedtransactionbytes()));
+  return internal::OpenSSLUtils::computeSHA384(ByteView(getTransactionProtobufObject(0U).signedtransactionbytes()));
 }
 
 //-----
@@ -899,8 +1248,8 @@ std::map<AccountId, std::vector<std::byte>> Transaction<SdkRequestType>::getTran
   std::map<AccountId, std::vector<std::byte>> hashes;
   for (unsigned int i = 0; i < mImpl->mTransactions.size(); ++i)
   {
-    hashes[nodeAccountIds.at(i)] = internal::OpenSSLUtils::computeSHA384(
-      internal::Utilities::stringToByteVector(getTransactionProtobufObject(i).signedtransactionbytes()));
+    hashes[nodeAccountIds.at(i)] =
+      internal::OpenSSLUtils::computeSHA384(ByteView(getTransactionProtobufObject(i).signedtransactionbytes()));
   }
 
   return hashes;
@@ -1457,14 +1806,14 @@ Transaction<SdkRequestType>::getSignaturesInternal(size_t offset) const
 
 //-----
 template<typename SdkRequestType>
-proto::Transaction Transaction<SdkRequestType>::getTransactionProtobufObject(unsigned int index) const
+const proto::Transaction& Transaction<SdkRequestType>::getTransactionProtobufObject(unsigned int index) const
 {
   return mImpl->mTransactions.at(index);
 }
 
 //-----
 template<typename SdkRequestType>
-proto::TransactionBody Transaction<SdkRequestType>::getSourceTransactionBody() const
+const proto::TransactionBody& Transaction<SdkRequestType>::getSourceTransactionBody() const
 {
   // mSourceTransactionBody should not be updated in this call because
   // updateSourceTransactionBody() makes a virtual call to addBody(), which will
@@ -1477,6 +1826,26 @@ proto::TransactionBody Transaction<SdkRequestType>::getSourceTransactionBody() c
   return mImpl->mSourceTransactionBody;
 }
 
+//-----
+template<typename SdkRequestType>
+proto::TransactionBody Transaction<SdkRequestType>::getSourceTransactionBodyWithoutData() const
+{
+  proto::TransactionBody& source = mImpl->mSourceTransactionBody;
+  const google::protobuf::Reflection* reflection = source.GetReflection();
+  const google::protobuf::FieldDescriptor* dataField =
+    reflection->GetOneofFieldDescriptor(source, proto::TransactionBody::descriptor()->FindOneofByName("data"));
+  if (dataField == nullptr)
+  {
+    return source;
+  }
+
+  // Take the data out of the source body while copying it, then put it back. This only moves pointers.
+  std::unique_ptr<google::protobuf::Message> data(reflection->ReleaseMessage(&source, dataField));
+  proto::TransactionBody body = source;
+  reflection->SetAllocatedMessage(&source, data.release(), dataField);
+  return body;
+}
+
 //-----
 template<typename SdkRequestType>
 TransactionId Transaction<SdkRequestType>::getCurrentTransactionId() const
@@ -1494,7 +1863,7 @@ TransactionResponse Transaction<SdkRequestType>::mapResponse(const proto::Transa
 
   return TransactionResponse(nodeAccountIds.at(mImpl->mTransactionIndex % nodeAccountIds.size()),
                              getCurrentTransactionId(),
-                             internal::OpenSSLUtils::computeSHA384(internal::Utilities::stringToByteVector(
+                             internal::OpenSSLUtils::computeSHA384(ByteView(
                                getTransactionProtobufObject(mImpl->mTransactionIndex).signedtransactionbytes())),
                              nodeAccountIds);
 }
@@ -1599,6 +1968,10 @@ void Transaction<SdkRequestType>::buildTransaction(unsigned int index) const
   // TransactionBody protobuf object bytes held in the SignedTransaction
   // protobuf object at the provided index.
   proto::SignedTransaction& signedTransaction = mImpl->mSignedTransactions[index];
+
+  // The signers take the body bytes as a byte vector, so convert them once and share the result between all signers
+  // instead of converting them for each signer.
+  std::vector<std::byte> bodyBytes;
   for (const auto& [publicKey, signer] : mImpl->mSignatories)
   {
     // If there is no signer function, the signature has already been generated
@@ -1606,14 +1979,60 @@ void Transaction<SdkRequestType>::buildTransaction(unsigned int index) const
     // this Transaction came from fromBytes()).
     if (signer)
     {
-      *signedTransaction.mutable_sigmap()->add_sigpair() = *publicKey->toSignaturePairProtobuf(
-        signer(internal::Utilities::stringToByteVector(signedTransaction.bodybytes())));
+      if (bodyBytes.empty())
+      {
+        bodyBytes = internal::Utilities::stringToByteVector(signedTransaction.bodybytes());
+      }
+
+      *signedTransaction.mutable_sigmap()->add_sigpair() = *publicKey->toSignaturePairProtobuf(signer(bodyBytes));
     }
   }
 
   mImpl->mTransactions[index].set_signedtransactionbytes(signedTransaction.SerializeAsString());
 }
 
+//-----
+template<typename SdkRequestType>
+std::vector<const proto::Transaction*> Transaction<SdkRequestType>::getTransactionsToSerialize(
+  proto::Transaction& unbuiltTransaction) const
+{
+  // If no nodes have been selected yet, the mSourceTransactionBody can be used
+  // to build a Transaction protobuf object.
+  if (Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::
+        getNodeAccountIds()
+          .empty())
+  {
+    // Make sure the Transaction has, if any, all recent changes.
+    updateSourceTransactionBody(nullptr);
+
+    proto::SignedTransaction signedTx;
+    signedTx.set_bodybytes(mImpl->mSourceTransactionBody.SerializeAsString());
+    unbuiltTransaction.set_signedtransactionbytes(signedTx.SerializeAsString());
+
+    return { &unbuiltTransaction };
+  }
+
+  // Generate the SignedTransaction protobuf objects if the Transaction's not
+  // frozen.
+  if (!isFrozen())
+  {
+    regenerateSignedTransactions(nullptr);
+  }
+
+  // Build all the Transaction protobuf objects. They are serialized in place
+  // rather than being copied into a TransactionList protobuf object.
+  buildAllTransactions();
+
+  std::vector<const proto::Transaction*> transactions;
+  transactions.reserve(mImpl->mTransactions.size());
+  for (const auto& tx : mImpl->mTransactions)
+  {
+    transactions.push_back(&tx);
+  }
+
+  return transactions;
+}
+
 //-----
 template<typename SdkRequestType>
 std::optional<TransactionId> Transaction<SdkRequestType>::getTransactionIdInternal() const
@@ -1621,6 +2040,91 @@ std::optional<TransactionId> Transaction<SdkRequestType>::getTransactionIdIntern
   return mImpl->mTransactionId;
 }
 
+//-----
+template<typename SdkRequestType>
+std::vector<internal::SignatureVerifier::SignatureCheck> Transaction<SdkRequestType>::getSignatureChecks() const
+{
+  if (!isFrozen())
+  {
+    throw IllegalStateException("Transaction must be frozen in order to verify its signatures.");
+  }
+
+  // Make sure the signatures from all signer functions are in the signature maps.
+  buildAllTransactions();
+
+  const std::vector<AccountId> nodeAccountIds =
+    Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::
+      getNodeAccountIds();
+
+  // Realize each distinct public key prefix only once. Keys that already signed this Transaction can be reused as-is.
+  std::unordered_map<std::string, std::shared_ptr<PublicKey>> keysByPrefix;
+  for (const auto& [key, signer] : mImpl->mSignatories)
+  {
+    keysByPrefix.emplace(internal::Utilities::byteVectorToString(key->toBytesRaw()), key);
+  }
+
+  std::vector<internal::SignatureVerifier::SignatureCheck> checks;
+  for (size_t i = 0; i < mImpl->mSignedTransactions.size(); ++i)
+  {
+    const proto::SignedTransaction& signedTransaction = mImpl->mSignedTransactions.at(i);
+    if (signedTransaction.sigmap().sigpair_size() == 0)
+    {
+      continue;
+    }
+
+    // All signatures of this SignedTransaction sign the same body bytes.
+    const auto signedBytes = std::make_shared<const std::vector<std::byte>>(
+      internal::Utilities::stringToByteVector(signedTransaction.bodybytes()));
+
+    for (const proto::SignaturePair& signaturePair : signedTransaction.sigmap().sigpair())
+    {
+      internal::SignatureVerifier::SignatureCheck check;
+      check.mSignedBytes = signedBytes;
+
+      if (!nodeAccountIds.empty())
+      {
+        check.mResult.mNodeAccountId = nodeAccountIds.at(i % nodeAccountIds.size());
+        check.mResult.mChunk = static_cast<unsigned int>(i / nodeAccountIds.size());
+      }
+
+      if (signaturePair.has_ed25519())
+      {
+        check.mResult.mSignature = internal::Utilities::stringToByteVector(signaturePair.ed25519());
+      }
+      else if (signaturePair.has_ecdsa_secp256k1())
+      {
+        check.mResult.mSignature = internal::Utilities::stringToByteVector(signaturePair.ecdsa_secp256k1());
+      }
+
+      // Unsupported signature types are left without a PublicKey, which marks them as invalid.
+      if (!check.mResult.mSignature.empty())
+      {
+        auto keyIter = keysByPrefix.find(signaturePair.pubkeyprefix());
+        if (keyIter == keysByPrefix.end())
+        {
+          std::shared_ptr<PublicKey> publicKey;
+          try
+          {
+            publicKey = PublicKey::fromBytes(internal::Utilities::stringToByteVector(signaturePair.pubkeyprefix()));
+          }
+          catch (const BadKeyException&)
+          {
+            // The prefix doesn't hold a full public key, so the signature can't be verified.
+          }
+
+          keyIter = keysByPrefix.emplace(signaturePair.pubkeyprefix(), publicKey).first;
+        }
+
+        check.mResult.mPublicKey = keyIter->second;
+      }
+
+      checks.push_back(std::move(check));
+    }
+  }
+
+  return checks;
+}
+
 //-----
 template<typename SdkRequestType>
 bool Transaction<SdkRequestType>::keyAlreadySigned(const std::shared_ptr<PublicKey>& publicKey) const
@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "WrappedTransaction.h"
 #include "exceptions/UninitializedException.h"
+#include "impl/SignatureVerifier.h"
 
 #include <services/transaction.pb.h>
 
+#include <iterator>
 #include <memory>
 namespace Hiero
 {
@@ -1373,4 +1375,50 @@ WrappedTransaction& WrappedTransaction::setTransaction(const AnyPossibleTransact
   return *this;
 }
 
+//-----
+std::vector<SignatureVerificationResult> WrappedTransaction::verifyAllSignatures() const
+{
+  return std::visit([](const auto& transaction) { return transaction.verifyAllSignatures(); }, mTransaction);
+}
+
+//-----
+std::vector<internal::SignatureVerifier::SignatureCheck> WrappedTransaction::getSignatureChecks() const
+{
+  return std::visit([](const auto& transaction) { return transaction.getSignatureChecks(); }, mTransaction);
+}
+
+//-----
+std::vector<std::vector<SignatureVerificationResult>> verifyAllSignatures(
+  const std::vector<WrappedTransaction>& transactions)
+{
+  // Pool the signatures of all transactions, remembering where each transaction's signatures start.
+  std::vector<internal::SignatureVerifier::SignatureCheck> checks;
+  std::vector<size_t> offsets;
+  offsets.reserve(transactions.size() + 1ULL);
+  for (const WrappedTransaction& transaction : transactions)
+  {
+    offsets.push_back(checks.size());
+    std::vector<internal::SignatureVerifier::SignatureCheck> transactionChecks = transaction.getSignatureChecks();
+    checks.insert(checks.end(),
+                  std::make_move_iterator(transactionChecks.begin()),
+                  std::make_move_iterator(transactionChecks.end()));
+  }
+  offsets.push_back(checks.size());
+
+  internal::SignatureVerifier::verifySignatures(checks);
+
+  // Split the results back up per transaction.
+  std::vector<std::vector<SignatureVerificationResult>> results(transactions.size());
+  for (size_t i = 0; i < transactions.size(); ++i)
+  {
+    results[i].reserve(offsets[i + 1ULL] - offsets[i]);
+    for (size_t j = offsets[i]; j < offsets[i + 1ULL]; ++j)
+    {
+      results[i].push_back(std::move(checks[j].mResult));
+    }
+  }
+
+  return results;
+}
+
 } // namespace Hiero
@@ -3,9 +3,19 @@
 #include "impl/HttpClient.h"
 
 #include <httplib.h>
+#include <zlib.h>
+#include <chrono>
+#include <condition_variable>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace Hiero::internal
 {
@@ -14,56 +24,272 @@ namespace
 // The index in a URL to begin searching for the path after the end of the URL scheme ("http://" or "https://").
 const int SCHEME_END_INDEX = 8;
 
-//
-// Perform an HTTP request.
-//
-// @param url         The URL to which to send the request.
-// @param method      The HTTP method type of this request.
-// @param body        The body of the request.
-// @param contentType The content type of the request.
-// @return The response of the request.
-//
-[[nodiscard]] std::string performRequest(std::string_view url,
-                                         std::string_view method,
-                                         std::string_view body,
-                                         std::string_view contentType = "application/json")
+// The zlib window bits that select the gzip format (the maximum window, plus 16).
+constexpr int GZIP_WINDOW_BITS = 31;
+
+// The zlib memory level to use to compress request bodies (its default).
+constexpr int GZIP_MEMORY_LEVEL = 8;
+
+// The HTTP status code with which a host rejects a request body encoding it doesn't support.
+constexpr int HTTP_STATUS_UNSUPPORTED_MEDIA_TYPE = 415;
+
+// The pool of keep-alive connections shared by every request, keyed by scheme, host and port.
+class ConnectionPool
 {
-  // Create an HTTP client to communicate with the given URL.
-  httplib::Client client(std::string(url.substr(0, url.find('/', SCHEME_END_INDEX))));
-  const std::string path = url.substr(url.find('/', SCHEME_END_INDEX)).data();
+public:
+  // A connection taken from the pool, along with the generation of the pool it was opened in.
+  struct Connection
+  {
+    std::unique_ptr<httplib::Client> mClient;
+    uint64_t mGeneration = 0ULL;
+  };
 
-  httplib::Result res;
+  // Take an idle connection to an origin, or open a new one if there's none, waiting while the origin has the maximum
+  // number of connections in use. The connection is configured with the current timeouts.
+  Connection acquire(const std::string& origin)
+  {
+    std::vector<std::unique_ptr<httplib::Client>> expired;
+    std::unique_lock lock(mMutex);
 
-  // Perform the request based on the HTTP method
-  if (method == "GET")
+    Connection connection;
+    while (!connection.mClient)
+    {
+      // Look the host up again after waiting, as it's erased if its last connection is closed in the meantime.
+      Host& host = mHosts[origin];
+      evictIdle(host, expired);
+
+      if (!host.mIdle.empty())
+      {
+        connection.mClient = std::move(host.mIdle.back().mClient);
+        host.mIdle.pop_back();
+      }
+      else if (host.mOpen < mSettings.mMaxConnectionsPerHost)
+      {
+        connection.mClient = std::make_unique<httplib::Client>(origin);
+        connection.mClient->set_keep_alive(true);
+        ++host.mOpen;
+      }
+      else
+      {
+        mConnectionReleased.wait(lock);
+      }
+    }
+
+    connection.mGeneration = mGeneration;
+    connection.mClient->set_connection_timeout(mSettings.mConnectionTimeout);
+    connection.mClient->set_read_timeout(mSettings.mReadTimeout);
+    connection.mClient->set_write_timeout(mSettings.mWriteTimeout);
+    return connection;
+  }
+
+  // Give a connection back to the pool. Connections that failed, or that were opened before the idle connections were
+  // last closed, or that would put the origin over the maximum number of connections, are closed instead of reused.
+  void release(const std::string& origin, Connection connection, bool reusable)
   {
-    res = client.Get(path);
+    std::vector<std::unique_ptr<httplib::Client>> expired;
+    {
+      std::unique_lock lock(mMutex);
+      Host& host = mHosts[origin];
+      if (reusable && connection.mGeneration == mGeneration && host.mOpen <= mSettings.mMaxConnectionsPerHost)
+      {
+        host.mIdle.push_back({ std::move(connection.mClient), std::chrono::steady_clock::now() });
+      }
+      else
+      {
+        expired.push_back(std::move(connection.mClient));
+        --host.mOpen;
+      }
+
+      evictIdle(host, expired);
+      if (host.mOpen == 0U)
+      {
+        mHosts.erase(origin);
+      }
+    }
+
+    mConnectionReleased.notify_all();
   }
-  else if (method == "POST")
+
+  // Close every idle connection, and have the connections in use closed when they're released.
+  void closeIdle()
   {
-    res = client.Post(path, body.data(), body.size(), contentType.data());
+    std::vector<std::unique_ptr<httplib::Client>> expired;
+    {
+      std::unique_lock lock(mMutex);
+      ++mGeneration;
+      for (auto iter = mHosts.begin(); iter != mHosts.end();)
+      {
+        Host& host = iter->second;
+        for (IdleConnection& idle : host.mIdle)
+        {
+          expired.push_back(std::move(idle.mClient));
+        }
+
+        host.mOpen -= static_cast<unsigned int>(host.mIdle.size());
+        host.mIdle.clear();
+        iter = (host.mOpen == 0U) ? mHosts.erase(iter) : std::next(iter);
+      }
+    }
+
+    mConnectionReleased.notify_all();
   }
-  else
+
+  void setSettings(const HttpClient::ConnectionPoolSettings& settings)
   {
-    throw std::invalid_argument(std::string("Unsupported HTTP method: ") + method.data());
+    {
+      std::unique_lock lock(mMutex);
+      mSettings = settings;
+    }
+
+    mConnectionReleased.notify_all();
   }
 
-  if (!res)
+  [[nodiscard]] HttpClient::ConnectionPoolSettings getSettings() const
   {
-    throw std::runtime_error("HTTP error: " + httplib::to_string(res.error()));
+    std::unique_lock lock(mMutex);
+    return mSettings;
   }
 
-  return res->body;
+  // Get the number of origins with open connections.
+  [[nodiscard]] size_t getHostCount() const
+  {
+    std::unique_lock lock(mMutex);
+    return mHosts.size();
+  }
+
+  // Get the number of connections open to an origin, idle or in use.
+  [[nodiscard]] unsigned int getOpenConnections(const std::string& origin) const
+  {
+    std::unique_lock lock(mMutex);
+    const auto iter = mHosts.find(origin);
+    return (iter == mHosts.cend()) ? 0U : iter->second.mOpen;
+  }
+
+  // Remember that an origin rejects encoded request bodies.
+  void setRequestCompressionUnsupported(const std::string& origin)
+  {
+    std::unique_lock lock(mMutex);
+    mRequestCompressionUnsupported.insert(origin);
+  }
+
+  // Does an origin accept encoded request bodies, as far as is known?
+  [[nodiscard]] bool isRequestCompressionSupported(const std::string& origin) const
+  {
+    std::unique_lock lock(mMutex);
+    return mRequestCompressionUnsupported.find(origin) == mRequestCompressionUnsupported.cend();
+  }
+
+private:
+  // A connection waiting in the pool to be reused.
+  struct IdleConnection
+  {
+    std::unique_ptr<httplib::Client> mClient;
+    std::chrono::steady_clock::time_point mLastUsed;
+  };
+
+  // The connections to one origin.
+  struct Host
+  {
+    // The idle connections, least recently used first.
+    std::vector<IdleConnection> mIdle;
+
+    // The number of open connections, idle or in use.
+    unsigned int mOpen = 0U;
+  };
+
+  // Move the connections of a host that have been idle for too long (least recently used first) out of the pool, so
+  // they can be closed once the pool's mutex is released. mMutex must be held.
+  void evictIdle(Host& host, std::vector<std::unique_ptr<httplib::Client>>& expired)
+  {
+    const std::chrono::steady_clock::time_point oldest =
+      std::chrono::steady_clock::now() -
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(mSettings.mIdleConnectionTimeout);
+
+    auto iter = host.mIdle.begin();
+    while (iter != host.mIdle.end() && iter->mLastUsed < oldest)
+    {
+      expired.push_back(std::move(iter->mClient));
+      --host.mOpen;
+      ++iter;
+    }
+
+    host.mIdle.erase(host.mIdle.begin(), iter);
+  }
+
+  // Guards the members below.
+  mutable std::mutex mMutex;
+
+  // Signaled when a connection is released or closed, or the settings change.
+  std::condition_variable mConnectionReleased;
+
+  // The connections, keyed by origin. Origins are erased once they have no open connections.
+  std::unordered_map<std::string, Host> mHosts;
+
+  // The origins that have rejected an encoded request body. Kept apart from mHosts, so it isn't forgotten when their
+  // connections are closed.
+  std::unordered_set<std::string> mRequestCompressionUnsupported;
+
+  // The settings of the pool.
+  HttpClient::ConnectionPoolSettings mSettings;
+
+  // Incremented when the idle connections are closed, to tell connections opened earlier apart.
+  uint64_t mGeneration = 0ULL;
+};
+
+// Get the connection pool shared by every request.
+ConnectionPool& getConnectionPool()
+{
+  static ConnectionPool pool;
+  return pool;
+}
+
+// Compress data in the gzip format. Returns an empty string if the data can't be compressed.
+[[nodiscard]] std::string gzip(std::string_view data)
+{
+  z_stream stream{};
+  if (deflateInit2(
+        &stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GZIP_WINDOW_BITS, GZIP_MEMORY_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+  {
+    return {};
+  }
+
+  std::string compressed(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+  stream.avail_out = static_cast<uInt>(compressed.size());
+
+  const int result = deflate(&stream, Z_FINISH);
+  compressed.resize(stream.total_out);
+  deflateEnd(&stream);
+
+  return (result == Z_STREAM_END) ? compressed : std::string();
+}
+
+// Send a request on a connection.
+[[nodiscard]] httplib::Result send(httplib::Client& client,
+                                   std::string_view method,
+                                   const std::string& path,
+                                   const httplib::Headers& headers,
+                                   std::string_view body,
+                                   std::string_view contentType)
+{
+  return (method == "GET") ? client.Get(path, headers)
+                           : client.Post(path, headers, body.data(), body.size(), contentType.data());
 }
 
 //
-// Perform an HTTP request and return the status code.
+// Perform an HTTP request on a pooled connection and return the status code.
 //
 // @param url         The URL to which to send the request.
 // @param method      The HTTP method type of this request.
 // @param body        The body of the request.
 // @param contentType The content type of the request.
 // @param statusCode  Output parameter for the HTTP status code.
+// @param isTimeout   Output parameter set to true when the failure was a request timeout.
+// @param requestHeaders  Extra headers to send with the request.
+// @param responseHeaders Output parameter for the headers of the response, if not null.
+// @param compression     Should the request and response be compressed?
 // @return The response of the request.
 //
 [[nodiscard]] std::string performRequestWithStatus(std::string_view url,
@@ -71,30 +297,71 @@ const int SCHEME_END_INDEX = 8;
                                                    std::string_view body,
                                                    std::string_view contentType,
                                                    int& statusCode,
-                                                   bool& isTimeout)
+                                                   bool& isTimeout,
+                                                   const httplib::Headers& requestHeaders = {},
+                                                   httplib::Headers* responseHeaders = nullptr,
+                                                   bool compression = false)
 {
   isTimeout = false;
 
-  // Create an HTTP client to communicate with the given URL.
-  httplib::Client client(std::string(url.substr(0, url.find('/', SCHEME_END_INDEX))));
+  if (method != "GET" && method != "POST")
+  {
+    throw std::invalid_argument(std::string("Unsupported HTTP method: ") + method.data());
+  }
+
+  // Take a connection to the given URL's origin from the pool.
+  const std::string origin(url.substr(0, url.find('/', SCHEME_END_INDEX)));
   const std::string path = url.substr(url.find('/', SCHEME_END_INDEX)).data();
+  ConnectionPool::Connection connection = getConnectionPool().acquire(origin);
 
-  httplib::Result res;
+  // Negotiate the encoding of the response. Without compression, ask for it unencoded explicitly, as the connection
+  // otherwise asks for any encoding it can decode.
+  httplib::Headers headers = requestHeaders;
+  headers.emplace("Accept-Encoding", compression ? "gzip, deflate" : "identity");
 
-  // Perform the request based on the HTTP method
-  if (method == "GET")
+  // Encode a large request body, unless the origin is known to reject encoded bodies.
+  std::string compressedBody;
+  if (compression && method == "POST" && body.size() >= DEFAULT_HTTP_REQUEST_COMPRESSION_THRESHOLD &&
+      getConnectionPool().isRequestCompressionSupported(origin))
   {
-    res = client.Get(path);
+    compressedBody = gzip(body);
+    if (compressedBody.empty() || compressedBody.size() >= body.size())
+    {
+      compressedBody.clear();
+    }
   }
-  else if (method == "POST")
+
+  // Perform the request based on the HTTP method
+  httplib::Result res;
+  try
   {
-    res = client.Post(path, body.data(), body.size(), contentType.data());
+    if (compressedBody.empty())
+    {
+      res = send(*connection.mClient, method, path, headers, body, contentType);
+    }
+    else
+    {
+      httplib::Headers encodedHeaders = headers;
+      encodedHeaders.emplace("Content-Encoding", "gzip");
+      res = send(*connection.mClient, method, path, encodedHeaders, compressedBody, contentType);
+
+      // Send the body again unencoded to an origin that rejects encoded bodies.
+      if (res && res->status == HTTP_STATUS_UNSUPPORTED_MEDIA_TYPE)
+      {
+        getConnectionPool().setRequestCompressionUnsupported(origin);
+        res = send(*connection.mClient, method, path, headers, body, contentType);
+      }
+    }
   }
-  else
+  catch (...)
   {
-    throw std::invalid_argument(std::string("Unsupported HTTP method: ") + method.data());
+    getConnectionPool().release(origin, std::move(connection), false);
+    throw;
   }
 
+  // A connection on which the request failed is in an unknown state, so it isn't reused.
+  getConnectionPool().release(origin, std::move(connection), static_cast<bool>(res));
+
   if (!res)
   {
     statusCode = -1;
@@ -105,9 +372,33 @@ const int SCHEME_END_INDEX = 8;
   }
 
   statusCode = res->status;
+  if (responseHeaders)
+  {
+    *responseHeaders = res->headers;
+  }
+
   return res->body;
 }
 
+//
+// Perform an HTTP request on a pooled connection.
+//
+// @param url         The URL to which to send the request.
+// @param method      The HTTP method type of this request.
+// @param body        The body of the request.
+// @param contentType The content type of the request.
+// @return The response of the request.
+//
+[[nodiscard]] std::string performRequest(std::string_view url,
+                                         std::string_view method,
+                                         std::string_view body,
+                                         std::string_view contentType = "application/json")
+{
+  int statusCode = -1;
+  bool isTimeout = false;
+  return performRequestWithStatus(url, method, body, contentType, statusCode, isTimeout);
+}
+
 } // namespace
 
 // example mirrorNode query:
@@ -129,11 +420,69 @@ std::string HttpClient::invokeRESTWithStatus(std::string_view url,
                                              std::string_view requestBody,
                                              std::string_view contentType,
                                              int& statusCode,
-                                             bool& isTimeout)
+                                             bool& isTimeout,
+                                             bool compression)
+{
+  return performRequestWithStatus(
+    url, httpMethod, requestBody, contentType, statusCode, isTimeout, {}, nullptr, compression);
+}
+
+//-----
+std::string HttpClient::invokeRESTWithHeaders(std::string_view url,
+                                              std::string_view httpMethod,
+                                              std::string_view requestBody,
+                                              std::string_view contentType,
+                                              const httplib::Headers& requestHeaders,
+                                              httplib::Headers& responseHeaders,
+                                              int& statusCode,
+                                              bool& isTimeout,
+                                              bool compression)
 {
-  return performRequestWithStatus(url, httpMethod, requestBody, contentType, statusCode, isTimeout);
+  return performRequestWithStatus(
+    url, httpMethod, requestBody, contentType, statusCode, isTimeout, requestHeaders, &responseHeaders, compression);
 }
 
 //-----
+void HttpClient::setConnectionPoolSettings(const ConnectionPoolSettings& settings)
+{
+  if (settings.mMaxConnectionsPerHost == 0U)
+  {
+    throw std::invalid_argument("Maximum number of connections per host must be positive");
+  }
+
+  if (settings.mIdleConnectionTimeout < std::chrono::system_clock::duration::zero() ||
+      settings.mConnectionTimeout < std::chrono::system_clock::duration::zero() ||
+      settings.mReadTimeout < std::chrono::system_clock::duration::zero() ||
+      settings.mWriteTimeout < std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("HTTP connection pool timeouts cannot be negative");
+  }
+
+  getConnectionPool().setSettings(settings);
+}
+
+//-----
+HttpClient::ConnectionPoolSettings HttpClient::getConnectionPoolSettings()
+{
+  return getConnectionPool().getSettings();
+}
+
+//-----
+void HttpClient::closeIdleConnections()
+{
+  getConnectionPool().closeIdle();
+}
+
+//-----
+unsigned int HttpClient::getOpenConnections(std::string_view url)
+{
+  return getConnectionPool().getOpenConnections(std::string(url.substr(0, url.find('/', SCHEME_END_INDEX))));
+}
+
+//-----
+size_t HttpClient::getConnectionPoolHostCount()
+{
+  return getConnectionPool().getHostCount();
+}
 
 } // namespace Hiero::internal
\ No newline at end of file
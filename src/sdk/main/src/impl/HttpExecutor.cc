@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/HttpExecutor.h"
+#include "exceptions/IllegalStateException.h"
+#include "impl/HttpClient.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <string_view>
+
+namespace Hiero::internal
+{
+namespace
+{
+// The separator between a URL's scheme and its host.
+constexpr std::string_view SCHEME_SEPARATOR = "://";
+
+} // anonymous namespace
+
+//-----
+HttpExecutor::HttpExecutor(unsigned int threads, unsigned int maxTasksPerHost)
+  : mMaxTasksPerHost(maxTasksPerHost)
+{
+  if (threads == 0U || maxTasksPerHost == 0U)
+  {
+    throw std::invalid_argument("HttpExecutor requires at least one thread and one task per host");
+  }
+
+  for (unsigned int i = 0U; i < threads; ++i)
+  {
+    mThreads.emplace_back(&HttpExecutor::run, this);
+  }
+}
+
+//-----
+HttpExecutor::~HttpExecutor()
+{
+  shutdown();
+}
+
+//-----
+void HttpExecutor::post(std::string host, std::function<void()> task)
+{
+  {
+    std::unique_lock lock(mMutex);
+    if (mShuttingDown)
+    {
+      throw IllegalStateException("HTTP executor is shut down");
+    }
+
+    mTasks.push_back({ std::move(host), std::move(task), std::chrono::steady_clock::time_point() });
+  }
+
+  mTasksChanged.notify_one();
+}
+
+//-----
+void HttpExecutor::postAfter(std::string host,
+                             const std::chrono::system_clock::time_point& deadline,
+                             std::function<void()> task)
+{
+  // Wait on the steady clock, so that changes to the system clock don't stretch or cut short the delay.
+  const std::chrono::steady_clock::time_point notBefore =
+    std::chrono::steady_clock::now() +
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(deadline - std::chrono::system_clock::now());
+  {
+    std::unique_lock lock(mMutex);
+    if (mShuttingDown)
+    {
+      throw IllegalStateException("HTTP executor is shut down");
+    }
+
+    mTasks.push_back({ std::move(host), std::move(task), notBefore });
+  }
+
+  // Wake every thread, so that one whose wait is timed for a later task waits for this one instead.
+  mTasksChanged.notify_all();
+}
+
+//-----
+std::future<std::pair<int, std::string>> HttpExecutor::invokeREST(std::string url,
+                                                                  std::string httpMethod,
+                                                                  std::string requestBody,
+                                                                  std::string contentType)
+{
+  std::string host = getHost(url);
+  return submit(std::move(host),
+                [url = std::move(url),
+                 httpMethod = std::move(httpMethod),
+                 requestBody = std::move(requestBody),
+                 contentType = std::move(contentType)]()
+                {
+                  int statusCode = -1;
+                  bool isTimeout = false;
+                  std::string body =
+                    HttpClient::invokeRESTWithStatus(url, httpMethod, requestBody, contentType, statusCode, isTimeout);
+                  return std::make_pair(statusCode, std::move(body));
+                });
+}
+
+//-----
+void HttpExecutor::shutdown()
+{
+  {
+    std::unique_lock lock(mMutex);
+    if (mShuttingDown)
+    {
+      return;
+    }
+
+    mShuttingDown = true;
+  }
+
+  mTasksChanged.notify_all();
+  for (std::thread& thread : mThreads)
+  {
+    thread.join();
+  }
+}
+
+//-----
+std::string HttpExecutor::getHost(std::string_view urlOrAddress)
+{
+  if (const size_t schemeEnd = urlOrAddress.find(SCHEME_SEPARATOR); schemeEnd != std::string_view::npos)
+  {
+    urlOrAddress.remove_prefix(schemeEnd + SCHEME_SEPARATOR.size());
+  }
+
+  urlOrAddress = urlOrAddress.substr(0, urlOrAddress.find_first_of("/?#"));
+
+  // Bracketed IPv6 addresses contain colons of their own.
+  if (!urlOrAddress.empty() && urlOrAddress.front() == '[')
+  {
+    urlOrAddress = urlOrAddress.substr(0, urlOrAddress.find(']') + 1);
+  }
+  else
+  {
+    urlOrAddress = urlOrAddress.substr(0, urlOrAddress.find(':'));
+  }
+
+  std::string host(urlOrAddress);
+  std::transform(
+    host.begin(), host.end(), host.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  return host;
+}
+
+//-----
+void HttpExecutor::run()
+{
+  std::unique_lock lock(mMutex);
+  while (true)
+  {
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const auto taskIter = findRunnableTask(now);
+    if (taskIter == mTasks.end())
+    {
+      if (mShuttingDown && mTasks.empty())
+      {
+        return;
+      }
+
+      // Wait for a change, or until the next delayed task is due.
+      std::chrono::steady_clock::time_point nextDue = std::chrono::steady_clock::time_point::max();
+      for (const Task& task : mTasks)
+      {
+        if (task.mNotBefore > now && task.mNotBefore < nextDue)
+        {
+          nextDue = task.mNotBefore;
+        }
+      }
+
+      if (nextDue == std::chrono::steady_clock::time_point::max())
+      {
+        mTasksChanged.wait(lock);
+      }
+      else
+      {
+        mTasksChanged.wait_until(lock, nextDue);
+      }
+
+      continue;
+    }
+
+    Task task = std::move(*taskIter);
+    mTasks.erase(taskIter);
+    if (!task.mHost.empty())
+    {
+      ++mRunning[task.mHost];
+    }
+
+    lock.unlock();
+
+    try
+    {
+      task.mFunction();
+    }
+    catch (...)
+    {
+      // Posted tasks report their own failures.
+    }
+
+    // Release the task before taking the lock, as it may hold the last reference to state that locks on destruction.
+    task.mFunction = nullptr;
+    lock.lock();
+
+    if (!task.mHost.empty())
+    {
+      if (const auto iter = mRunning.find(task.mHost); --iter->second == 0U)
+      {
+        mRunning.erase(iter);
+      }
+
+      // A task for this host may have been waiting on the limit.
+      mTasksChanged.notify_all();
+    }
+  }
+}
+
+//-----
+std::deque<HttpExecutor::Task>::iterator HttpExecutor::findRunnableTask(
+  const std::chrono::steady_clock::time_point& now)
+{
+  for (auto iter = mTasks.begin(); iter != mTasks.end(); ++iter)
+  {
+    if (!mShuttingDown && iter->mNotBefore > now)
+    {
+      continue;
+    }
+
+    if (iter->mHost.empty())
+    {
+      return iter;
+    }
+
+    if (const auto running = mRunning.find(iter->mHost);
+        running == mRunning.end() || running->second < mMaxTasksPerHost)
+    {
+      return iter;
+    }
+  }
+
+  return mTasks.end();
+}
+
+} // namespace Hiero::internal
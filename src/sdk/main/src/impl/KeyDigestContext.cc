@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/openssl_utils/KeyDigestContext.h"
+#include "exceptions/OpenSSLException.h"
+#include "impl/openssl_utils/OpenSSLUtils.h"
+
+namespace Hiero::internal::OpenSSLUtils
+{
+//-----
+KeyDigestContext::KeyDigestContext(Operation operation, const ::EVP_MD* messageDigest)
+  : mOperation(operation)
+  , mMessageDigest(messageDigest)
+{
+}
+
+//-----
+EVP_MD_CTX KeyDigestContext::getContext(const std::function<EVP_PKEY()>& getKey)
+{
+  // If initialization throws, the flag is left unset and the next call will try again.
+  std::call_once(mInitialized, [this, &getKey]() { initialize(getKey()); });
+
+  EVP_MD_CTX context(EVP_MD_CTX_new());
+  if (!context)
+  {
+    throw OpenSSLException(getErrorMessage("EVP_MD_CTX_new"));
+  }
+
+  if (EVP_MD_CTX_copy_ex(context.get(), mContext.get()) <= 0)
+  {
+    throw OpenSSLException(getErrorMessage("EVP_MD_CTX_copy_ex"));
+  }
+
+  return context;
+}
+
+//-----
+void KeyDigestContext::initialize(EVP_PKEY key)
+{
+  EVP_MD_CTX context(EVP_MD_CTX_new());
+  if (!context)
+  {
+    throw OpenSSLException(getErrorMessage("EVP_MD_CTX_new"));
+  }
+
+  // The context takes its own reference to the key, so the input key doesn't need to outlive it.
+  if (mOperation == Operation::SIGN)
+  {
+    if (EVP_DigestSignInit(context.get(), nullptr, mMessageDigest, nullptr, key.get()) <= 0)
+    {
+      throw OpenSSLException(getErrorMessage("EVP_DigestSignInit"));
+    }
+  }
+  else
+  {
+    if (EVP_DigestVerifyInit(context.get(), nullptr, mMessageDigest, nullptr, key.get()) <= 0)
+    {
+      throw OpenSSLException(getErrorMessage("EVP_DigestVerifyInit"));
+    }
+  }
+
+  mContext = std::move(context);
+}
+
+} // namespace Hiero::internal::OpenSSLUtils
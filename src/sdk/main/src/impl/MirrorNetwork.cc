@@ -3,8 +3,25 @@
 #include "impl/MirrorNode.h"
 #include "impl/Utilities.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace Hiero::internal
 {
+namespace
+{
+// Shuffle a vector in place.
+template<typename T>
+void shuffle(std::vector<T>& values)
+{
+  for (size_t i = values.size(); i > 1; --i)
+  {
+    std::swap(values[i - 1], values[Utilities::getRandomNumber(0U, static_cast<unsigned int>(i) - 1U)]);
+  }
+}
+
+} // anonymous namespace
+
 //-----
 MirrorNetwork MirrorNetwork::forMainnet()
 {
@@ -67,16 +84,101 @@ std::vector<std::string> MirrorNetwork::getNetwork() const
 //-----
 std::shared_ptr<MirrorNode> MirrorNetwork::getNextMirrorNode() const
 {
-  std::unique_lock lock(*getLock());
+  const std::vector<std::shared_ptr<MirrorNode>> nodes = getMirrorNodesByHealth();
+  return nodes.empty() ? nullptr : nodes.front();
+}
+
+//-----
+std::vector<std::shared_ptr<MirrorNode>> MirrorNetwork::getMirrorNodesByLoad() const
+{
+  // Snapshot each node's health and load, as they can change while sorting.
+  std::vector<std::pair<std::pair<bool, unsigned int>, std::shared_ptr<MirrorNode>>> loads;
+  {
+    std::unique_lock lock(*getLock());
+    for (const std::shared_ptr<MirrorNode>& node : getNodes())
+    {
+      loads.push_back({ { !node->isHealthy(), node->getActiveStreams() }, node });
+    }
+  }
+
+  // Shuffle first so that equally loaded nodes are picked evenly, then sort stably by health and load.
+  shuffle(loads);
+  std::stable_sort(loads.begin(), loads.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  std::vector<std::shared_ptr<MirrorNode>> nodes;
+  nodes.reserve(loads.size());
+  for (auto& [load, node] : loads)
+  {
+    nodes.push_back(std::move(node));
+  }
+
+  return nodes;
+}
 
-  if (getNodes().empty())
+//-----
+std::vector<std::shared_ptr<MirrorNode>> MirrorNetwork::getMirrorNodesByHealth() const
+{
+  // Snapshot each node's readmit time and latency, as they can change while sorting. Healthy nodes are keyed by their
+  // latency alone, unhealthy nodes by when they're readmitted.
+  const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+  std::vector<std::pair<std::pair<std::chrono::system_clock::time_point, std::chrono::system_clock::duration>,
+                        std::shared_ptr<MirrorNode>>>
+    scores;
   {
-    return nullptr;
+    std::unique_lock lock(*getLock());
+    for (const std::shared_ptr<MirrorNode>& node : getNodes())
+    {
+      const std::chrono::system_clock::time_point readmitTime = node->getReadmitTime();
+      scores.push_back({ { (readmitTime < now) ? std::chrono::system_clock::time_point() : readmitTime,
+                           (readmitTime < now) ? node->getLatency() : std::chrono::system_clock::duration::zero() },
+                         node });
+    }
   }
 
-  auto nodeIter = getNodes().cbegin();
-  std::advance(nodeIter, Utilities::getRandomNumber(0U, static_cast<unsigned int>(getNodes().size()) - 1U));
-  return *nodeIter;
+  // Shuffle first so that nodes with the same score are picked evenly, then sort stably by score.
+  shuffle(scores);
+  std::stable_sort(
+    scores.begin(), scores.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  std::vector<std::shared_ptr<MirrorNode>> nodes;
+  nodes.reserve(scores.size());
+  for (auto& [score, node] : scores)
+  {
+    nodes.push_back(std::move(node));
+  }
+
+  return nodes;
+}
+
+//-----
+void MirrorNetwork::recordSuccess(const std::shared_ptr<MirrorNode>& node,
+                                  const std::chrono::system_clock::duration& latency)
+{
+  decreaseBackoff(node);
+  if (latency > std::chrono::system_clock::duration::zero())
+  {
+    node->recordLatency(latency);
+  }
+}
+
+//-----
+void MirrorNetwork::recordFailure(const std::shared_ptr<MirrorNode>& node)
+{
+  increaseBackoff(node);
+}
+
+//-----
+void MirrorNetwork::setHttpCompression(bool compression)
+{
+  std::unique_lock lock(*getLock());
+  mHttpCompression = compression;
+}
+
+//-----
+bool MirrorNetwork::isHttpCompression() const
+{
+  std::unique_lock lock(*getLock());
+  return mHttpCompression;
 }
 
 //-----
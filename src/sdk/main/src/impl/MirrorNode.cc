@@ -2,6 +2,8 @@
 #include "impl/MirrorNode.h"
 #include "impl/BaseNodeAddress.h"
 
+#include <algorithm>
+
 namespace Hiero::internal
 {
 //-----
@@ -16,6 +18,17 @@ MirrorNode::MirrorNode(std::string_view address)
 {
 }
 
+//-----
+void MirrorNode::recordLatency(const std::chrono::system_clock::duration& latency)
+{
+  // An exponentially weighted moving average, giving each new sample a weight of 1/4. The first sample is taken as is.
+  // Samples are at least one tick, as zero means no latency has been recorded.
+  using Rep = std::chrono::system_clock::duration::rep;
+  const Rep previous = mLatency.load();
+  const Rep sample = std::max<Rep>(latency.count(), 1);
+  mLatency = (previous == 0) ? sample : previous + (sample - previous) / 4;
+}
+
 //-----
 void MirrorNode::initializeStubs()
 {
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/MirrorNodeContractCallEngine.h"
+#include "Client.h"
+#include "exceptions/IllegalStateException.h"
+#include "impl/HttpExecutor.h"
+#include "impl/MirrorNetwork.h"
+#include "impl/MirrorNode.h"
+#include "impl/MirrorNodeContractQuery.h"
+#include "impl/MirrorNodeGateway.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace Hiero::internal
+{
+namespace
+{
+// Get the result of a contract call from the body of its response, in the format MirrorNodeContractQuery::execute()
+// returns it.
+std::string parseCallResult(const std::string& response)
+{
+  const nlohmann::json json = nlohmann::json::parse(response, nullptr, false);
+  if (json.is_discarded() || !json.contains("result") || !json["result"].is_string())
+  {
+    throw IllegalStateException("No result was found for the contract call.");
+  }
+
+  // trim 0x
+  const std::string result = json["result"].get<std::string>();
+  return (result.rfind("0x", 0) == 0) ? result.substr(2) : result;
+}
+
+} // anonymous namespace
+
+//-----
+MirrorNodeContractCallEngine::MirrorNodeContractCallEngine(const Client& client, size_t maxCachedResults)
+  : mClient(client)
+  , mState(std::make_shared<CallState>(maxCachedResults))
+{
+}
+
+//-----
+std::shared_future<std::string> MirrorNodeContractCallEngine::submit(MirrorNodeContractQuery& query)
+{
+  // Resolve each contract's EVM address only once.
+  const std::optional<ContractId> contractId = query.getContractId();
+  if (contractId.has_value() && !query.getContractEvmAddress().has_value())
+  {
+    std::unique_lock lock(mContractEvmAddressesMutex);
+    if (const auto iter = mContractEvmAddresses.find(contractId->toString()); iter != mContractEvmAddresses.end())
+    {
+      query.setContractEvmAddress(iter->second);
+    }
+  }
+
+  query.prepare(mClient);
+
+  if (contractId.has_value() && query.getContractEvmAddress().has_value())
+  {
+    std::unique_lock lock(mContractEvmAddressesMutex);
+    mContractEvmAddresses.try_emplace(contractId->toString(), query.getContractEvmAddress().value());
+  }
+
+  // Identical calls share a key, whichever mirror node they're sent to.
+  const bool isPinned = query.getBlockNumber() != 0ULL;
+  const std::string body = query.toJson().dump();
+  const std::string route =
+    MirrorNodeGateway::MirrorNodeRouter().getRoute(MirrorNodeGateway::CONTRACT_CALL_QUERY);
+  const std::string key = MirrorResponseCache::makeKey("POST", route, body);
+
+  std::unique_lock lock(mState->mMutex);
+  if (isPinned)
+  {
+    if (MirrorResponseCache::Lookup lookup = mState->mResults.lookup(key); lookup.mFreshBody.has_value())
+    {
+      ++mState->mStatistics.mCachedCalls;
+      std::promise<std::string> promise;
+      promise.set_value(std::move(*lookup.mFreshBody));
+      return promise.get_future().share();
+    }
+  }
+
+  if (const auto iter = mState->mCallsInFlight.find(key); iter != mState->mCallsInFlight.end())
+  {
+    ++mState->mStatistics.mCollapsedCalls;
+    return iter->second;
+  }
+
+  // Rotate through the healthy mirror nodes, so concurrent calls are spread across them.
+  const std::shared_ptr<MirrorNetwork> network = mClient.getClientMirrorNetwork();
+  std::vector<std::shared_ptr<MirrorNode>> nodes =
+    network ? network->getMirrorNodesByHealth() : std::vector<std::shared_ptr<MirrorNode>>();
+  if (nodes.empty())
+  {
+    throw IllegalStateException("Mirror network has no mirror nodes");
+  }
+
+  rotateHealthyNodes(nodes, mNextNode++);
+
+  const std::string host = HttpExecutor::getHost(nodes.front()->getAddress().toString());
+  const std::chrono::system_clock::duration cacheTtl = MirrorNodeGateway::MirrorNodeRouter().getCacheTtl(
+    MirrorNodeGateway::PINNED_CONTRACT_CALL_QUERY);
+  std::shared_future<std::string> result =
+    mClient.getHttpExecutor()
+      ->submit(host,
+               [state = mState, network, nodes = std::move(nodes), key, body, isPinned, cacheTtl]()
+               {
+                 try
+                 {
+                   std::string callResult = parseCallResult(MirrorNodeGateway::invokeWithFailover(
+                     *network,
+                     nodes,
+                     [](std::string_view mirrorNodeUrl)
+                     {
+                       return MirrorNodeGateway::buildUrlForNetwork(
+                         mirrorNodeUrl, MirrorNodeGateway::CONTRACT_CALL_QUERY, {}, "POST");
+                     },
+                     "POST",
+                     body,
+                     nullptr,
+                     std::chrono::system_clock::duration::zero()));
+
+                   std::unique_lock lock(state->mMutex);
+                   state->mCallsInFlight.erase(key);
+                   if (isPinned)
+                   {
+                     state->mResults.put(key, callResult, std::string(), cacheTtl);
+                   }
+
+                   return callResult;
+                 }
+                 catch (const std::exception&)
+                 {
+                   std::unique_lock lock(state->mMutex);
+                   state->mCallsInFlight.erase(key);
+                   throw;
+                 }
+               })
+      .share();
+
+  mState->mCallsInFlight.emplace(key, result);
+  ++mState->mStatistics.mSentCalls;
+  return result;
+}
+
+//-----
+std::vector<std::shared_future<std::string>> MirrorNodeContractCallEngine::submitAll(
+  const std::vector<std::shared_ptr<MirrorNodeContractQuery>>& queries)
+{
+  std::vector<std::shared_future<std::string>> results;
+  results.reserve(queries.size());
+  for (const std::shared_ptr<MirrorNodeContractQuery>& query : queries)
+  {
+    results.push_back(submit(*query));
+  }
+
+  return results;
+}
+
+//-----
+MirrorNodeContractCallEngine::Statistics MirrorNodeContractCallEngine::getStatistics() const
+{
+  std::unique_lock lock(mState->mMutex);
+  return mState->mStatistics;
+}
+
+//-----
+void MirrorNodeContractCallEngine::rotateHealthyNodes(std::vector<std::shared_ptr<MirrorNode>>& nodes, size_t nextNode)
+{
+  // Unhealthy mirror nodes are only tried once every healthy one has failed.
+  const auto healthyEnd = std::find_if(
+    nodes.begin(), nodes.end(), [](const std::shared_ptr<MirrorNode>& node) { return !node->isHealthy(); });
+  if (const auto healthy = static_cast<size_t>(std::distance(nodes.begin(), healthyEnd)); healthy > 1ULL)
+  {
+    std::rotate(nodes.begin(), nodes.begin() + static_cast<std::ptrdiff_t>(nextNode % healthy), healthyEnd);
+  }
+}
+
+} // namespace Hiero::internal
@@ -10,17 +10,17 @@ namespace Hiero
 
 std::string MirrorNodeContractCallQuery::execute(const Client& client)
 {
-  if (!getContractEvmAddress().has_value())
-  {
-    populateContractEvmAddress(client);
-  }
+  prepare(client);
 
-  const json contractCallResult =
-    internal::MirrorNodeGateway::MirrorNodeQuery(client.getClientMirrorNetwork()->getNetwork()[0],
-                                                 { "call" },
-                                                 internal::MirrorNodeGateway::CONTRACT_INFO_QUERY,
-                                                 toJson().dump(),
-                                                 "POST");
+  // Calls against a fixed block always give the same result, so only those are cached.
+  const json contractCallResult = internal::MirrorNodeGateway::MirrorNodeQuery(
+    client.getClientMirrorNetwork(),
+    {},
+    (getBlockNumber() != 0) ? internal::MirrorNodeGateway::PINNED_CONTRACT_CALL_QUERY
+                            : internal::MirrorNodeGateway::CONTRACT_CALL_QUERY,
+    toJson().dump(),
+    "POST",
+    client.getMirrorResponseCache());
 
   if (!contractCallResult.contains("result"))
   {
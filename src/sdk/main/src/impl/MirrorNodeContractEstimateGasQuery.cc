@@ -10,19 +10,17 @@ namespace Hiero
 
 std::string MirrorNodeContractEstimateGasQuery::execute(const Client& client)
 {
-  setEstimate(true);
-
-  if (!getContractEvmAddress().has_value())
-  {
-    populateContractEvmAddress(client);
-  }
-
-  const json contractCallResult =
-    internal::MirrorNodeGateway::MirrorNodeQuery(client.getClientMirrorNetwork()->getNetwork()[0],
-                                                 { "call" },
-                                                 internal::MirrorNodeGateway::CONTRACT_INFO_QUERY,
-                                                 toJson().dump(),
-                                                 "POST");
+  prepare(client);
+
+  // Calls against a fixed block always give the same result, so only those are cached.
+  const json contractCallResult = internal::MirrorNodeGateway::MirrorNodeQuery(
+    client.getClientMirrorNetwork(),
+    {},
+    (getBlockNumber() != 0) ? internal::MirrorNodeGateway::PINNED_CONTRACT_CALL_QUERY
+                            : internal::MirrorNodeGateway::CONTRACT_CALL_QUERY,
+    toJson().dump(),
+    "POST",
+    client.getMirrorResponseCache());
 
   if (!contractCallResult.contains("result"))
   {
@@ -37,4 +35,11 @@ std::string MirrorNodeContractEstimateGasQuery::execute(const Client& client)
   return estimatedGas;
 }
 
+//-----
+void MirrorNodeContractEstimateGasQuery::prepare(const Client& client)
+{
+  setEstimate(true);
+  MirrorNodeContractQuery::prepare(client);
+}
+
 } // namespace Hiero
\ No newline at end of file
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "impl/MirrorNodeContractQuery.h"
+#include "impl/HttpExecutor.h"
 #include "impl/MirrorNetwork.h"
 #include "impl/MirrorNodeGateway.h"
 
@@ -79,13 +80,32 @@ MirrorNodeContractQuery& MirrorNodeContractQuery::setEstimate(bool estimate)
   return *this;
 }
 
+//-----
+std::future<std::string> MirrorNodeContractQuery::executeAsync(const Client& client)
+{
+  return client.getHttpExecutor()->submit(internal::MirrorNodeGateway::getQueryHost(*client.getClientMirrorNetwork()),
+                                          [this, &client]() { return execute(client); });
+}
+
+//-----
+void MirrorNodeContractQuery::prepare(const Client& client)
+{
+  if (!getContractEvmAddress().has_value())
+  {
+    populateContractEvmAddress(client);
+  }
+}
+
 //-----
 void MirrorNodeContractQuery::populateContractEvmAddress(const Client& client)
 {
   const json contractInfo =
-    internal::MirrorNodeGateway::MirrorNodeQuery(client.getClientMirrorNetwork()->getNetwork()[0],
+    internal::MirrorNodeGateway::MirrorNodeQuery(client.getClientMirrorNetwork(),
                                                  { getContractId().value().toString() },
-                                                 internal::MirrorNodeGateway::CONTRACT_INFO_QUERY);
+                                                 internal::MirrorNodeGateway::CONTRACT_INFO_QUERY,
+                                                 "",
+                                                 "GET",
+                                                 client.getMirrorResponseCache());
 
   if (contractInfo.contains("evm_address"))
   {
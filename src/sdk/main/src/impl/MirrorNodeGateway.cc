@@ -2,8 +2,14 @@
 #include "impl/MirrorNodeGateway.h"
 #include "exceptions/IllegalStateException.h"
 #include "impl/HttpClient.h"
+#include "impl/HttpExecutor.h"
+#include "impl/MirrorNetwork.h"
+#include "impl/MirrorNode.h"
+#include "impl/MirrorResponseCache.h"
 
 #include <chrono>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <thread>
 
@@ -11,6 +17,18 @@ using json = nlohmann::json;
 
 namespace Hiero::internal::MirrorNodeGateway
 {
+namespace
+{
+// HTTP status codes of successful and unchanged responses.
+constexpr int HTTP_STATUS_OK = 200;
+constexpr int HTTP_STATUS_NOT_MODIFIED = 304;
+
+// HTTP status codes that mean a mirror node failed a request that another mirror node could answer.
+constexpr int HTTP_STATUS_TOO_MANY_REQUESTS = 429;
+constexpr int HTTP_STATUS_SERVER_ERROR = 500;
+
+} // anonymous namespace
+
 //-----
 json MirrorNodeQuery(std::string_view mirrorNodeUrl,
                      const std::vector<std::string>& params,
@@ -31,6 +49,162 @@ json MirrorNodeQuery(std::string_view mirrorNodeUrl,
   return json::parse(response);
 }
 
+//-----
+json MirrorNodeQuery(const std::shared_ptr<MirrorNetwork>& network,
+                     const std::vector<std::string>& params,
+                     std::string_view queryType,
+                     std::string_view requestBody,
+                     std::string_view requestType,
+                     const std::shared_ptr<MirrorResponseCache>& cache)
+{
+  const std::string response = invokeWithFailover(
+    *network,
+    [&params, &queryType, &requestType](std::string_view mirrorNodeUrl)
+    { return buildUrlForNetwork(mirrorNodeUrl, queryType, params, requestType); },
+    requestType,
+    requestBody,
+    cache.get(),
+    MirrorNodeRouter().getCacheTtl(queryType));
+
+  try
+  {
+    return json::parse(response);
+  }
+  catch (const json::exception& e)
+  {
+    throw IllegalStateException(std::string(e.what() + std::string("Illegal json state!")));
+  }
+}
+
+//-----
+std::string invokeWithFailover(MirrorNetwork& network,
+                               const std::function<std::string(std::string_view mirrorNodeUrl)>& buildUrl,
+                               std::string_view requestType,
+                               std::string_view requestBody,
+                               MirrorResponseCache* cache,
+                               const std::chrono::system_clock::duration& cacheTtl)
+{
+  return invokeWithFailover(
+    network, network.getMirrorNodesByHealth(), buildUrl, requestType, requestBody, cache, cacheTtl);
+}
+
+//-----
+std::string invokeWithFailover(MirrorNetwork& network,
+                               const std::vector<std::shared_ptr<MirrorNode>>& nodes,
+                               const std::function<std::string(std::string_view mirrorNodeUrl)>& buildUrl,
+                               std::string_view requestType,
+                               std::string_view requestBody,
+                               MirrorResponseCache* cache,
+                               const std::chrono::system_clock::duration& cacheTtl)
+{
+  if (nodes.empty())
+  {
+    throw IllegalStateException("Mirror network has no mirror nodes");
+  }
+
+  // Serve a fresh cached response without a request, and revalidate a stale one with its ETag.
+  if (cacheTtl <= std::chrono::system_clock::duration::zero())
+  {
+    cache = nullptr;
+  }
+
+  std::string cacheKey;
+  std::string eTag;
+  if (cache)
+  {
+    cacheKey = MirrorResponseCache::makeKey(requestType, buildUrl(nodes.front()->getAddress().toString()), requestBody);
+    MirrorResponseCache::Lookup lookup = cache->lookup(cacheKey);
+    if (lookup.mFreshBody.has_value())
+    {
+      return std::move(*lookup.mFreshBody);
+    }
+
+    eTag = std::move(lookup.mETag);
+  }
+
+  const bool compression = network.isHttpCompression();
+  std::string lastError;
+  for (const std::shared_ptr<MirrorNode>& node : nodes)
+  {
+    const std::string url = buildUrl(node->getAddress().toString());
+    const std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
+    int statusCode = -1;
+    bool isTimeout = false;
+
+    try
+    {
+      httplib::Headers requestHeaders;
+      if (!eTag.empty())
+      {
+        requestHeaders.emplace("If-None-Match", eTag);
+      }
+
+      httplib::Headers responseHeaders;
+      std::string response = HttpClient::invokeRESTWithHeaders(url,
+                                                               requestType,
+                                                               requestBody,
+                                                               "application/json",
+                                                               requestHeaders,
+                                                               responseHeaders,
+                                                               statusCode,
+                                                               isTimeout,
+                                                               compression);
+
+      // The cached response is unchanged. If it was evicted in the meantime, ask again without the ETag.
+      if (statusCode == HTTP_STATUS_NOT_MODIFIED && !eTag.empty())
+      {
+        if (std::optional<std::string> cached = cache->revalidate(cacheKey, cacheTtl); cached.has_value())
+        {
+          network.recordSuccess(node, std::chrono::system_clock::now() - start);
+          return std::move(*cached);
+        }
+
+        eTag.clear();
+        requestHeaders.clear();
+        response = HttpClient::invokeRESTWithHeaders(url,
+                                                     requestType,
+                                                     requestBody,
+                                                     "application/json",
+                                                     requestHeaders,
+                                                     responseHeaders,
+                                                     statusCode,
+                                                     isTimeout,
+                                                     compression);
+      }
+
+      if (statusCode != HTTP_STATUS_TOO_MANY_REQUESTS && statusCode < HTTP_STATUS_SERVER_ERROR)
+      {
+        network.recordSuccess(node, std::chrono::system_clock::now() - start);
+        if (cache && statusCode == HTTP_STATUS_OK)
+        {
+          const auto eTagHeader = responseHeaders.find("ETag");
+          cache->put(
+            cacheKey, response, (eTagHeader != responseHeaders.end()) ? eTagHeader->second : std::string(), cacheTtl);
+        }
+
+        return response;
+      }
+
+      lastError = "HTTP status " + std::to_string(statusCode) + " from " + url;
+    }
+    catch (const std::runtime_error& e)
+    {
+      lastError = e.what();
+    }
+
+    network.recordFailure(node);
+  }
+
+  throw IllegalStateException("Every mirror node failed the request. Last error: " + lastError);
+}
+
+//-----
+std::string getQueryHost(const MirrorNetwork& network)
+{
+  const std::shared_ptr<MirrorNode> node = network.getNextMirrorNode();
+  return node ? HttpExecutor::getHost(node->getAddress().toString()) : std::string();
+}
+
 //-----
 void replaceParameters(std::string& original, std::string_view search, std::string_view replace)
 {
@@ -44,10 +218,7 @@ void replaceParameters(std::string& original, std::string_view search, std::stri
 }
 
 //-----
-std::string buildUrlForNetwork(std::string_view mirrorNodeUrl,
-                               std::string_view queryType,
-                               const std::vector<std::string>& params,
-                               std::string_view requestType)
+std::string buildBaseUrl(std::string_view mirrorNodeUrl, std::string_view requestType)
 {
   std::string httpPrefix = "http://";
   std::string localPrefix = "127.0.0.1:5600";
@@ -69,6 +240,16 @@ std::string buildUrlForNetwork(std::string_view mirrorNodeUrl,
       url.replace(url.length() - 4, 4, "8545");
     }
   }
+  return url;
+}
+
+//-----
+std::string buildUrlForNetwork(std::string_view mirrorNodeUrl,
+                               std::string_view queryType,
+                               const std::vector<std::string>& params,
+                               std::string_view requestType)
+{
+  std::string url = buildBaseUrl(mirrorNodeUrl, requestType);
   MirrorNodeRouter router;
   std::string route = router.getRoute(queryType.data()).data();
   for_each(
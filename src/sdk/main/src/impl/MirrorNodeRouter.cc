@@ -22,4 +22,11 @@ std::string MirrorNodeRouter::getRoute(std::string_view queryType) const
   }
   return queryRoute;
 }
+
+//-----
+std::chrono::system_clock::duration MirrorNodeRouter::getCacheTtl(std::string_view queryType) const
+{
+  const auto ttl = cacheTtls.find(std::string(queryType));
+  return (ttl != cacheTtls.end()) ? ttl->second : std::chrono::system_clock::duration::zero();
+}
 } // namespace Hiero::internal::MirrorNodeGateway
\ No newline at end of file
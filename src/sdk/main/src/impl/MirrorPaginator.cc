@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/MirrorPaginator.h"
+#include "Client.h"
+#include "exceptions/IllegalStateException.h"
+#include "impl/HttpExecutor.h"
+#include "impl/MirrorNetwork.h"
+#include "impl/MirrorNodeGateway.h"
+
+#include <future>
+#include <string>
+#include <utility>
+
+using json = nlohmann::json;
+
+namespace Hiero::internal
+{
+namespace
+{
+// A SAX handler that keeps the elements of a collection's array and the link to the next page, and skips the rest.
+// Elements are built one at a time, so only the elements themselves (not the whole response) are held in memory.
+class MirrorPageHandler : public json::json_sax_t
+{
+public:
+  MirrorPageHandler(std::string_view collection, MirrorPage& page)
+    : mCollection(collection)
+    , mPage(page)
+  {
+  }
+
+  bool null() override { return value(nullptr); }
+  bool boolean(bool val) override { return value(val); }
+  bool number_integer(json::number_integer_t val) override { return value(val); }
+  bool number_unsigned(json::number_unsigned_t val) override { return value(val); }
+  bool number_float(json::number_float_t val, const json::string_t& /*s*/) override { return value(val); }
+  bool binary(json::binary_t& val) override { return value(std::move(val)); }
+
+  bool string(json::string_t& val) override
+  {
+    // The link to the next page is the only value kept outside the collection.
+    if (mItemStack.empty() && mDepth == 2 && mTopKey == "links" && mLinksKey == "next")
+    {
+      mPage.mNextPath = val;
+      return true;
+    }
+
+    return value(std::move(val));
+  }
+
+  bool start_object(std::size_t /*elements*/) override { return startContainer(json::object()); }
+  bool start_array(std::size_t /*elements*/) override
+  {
+    if (mItemStack.empty() && mDepth == 1 && mTopKey == mCollection)
+    {
+      ++mDepth;
+      mInCollection = true;
+      return true;
+    }
+
+    return startContainer(json::array());
+  }
+
+  bool key(json::string_t& val) override
+  {
+    if (!mItemStack.empty())
+    {
+      mItemKey = std::move(val);
+    }
+    else if (mDepth == 1)
+    {
+      mTopKey = std::move(val);
+    }
+    else if (mDepth == 2 && mTopKey == "links")
+    {
+      mLinksKey = std::move(val);
+    }
+
+    return true;
+  }
+
+  bool end_object() override { return endContainer(); }
+  bool end_array() override
+  {
+    if (mItemStack.empty() && mInCollection && mDepth == 2)
+    {
+      --mDepth;
+      mInCollection = false;
+      return true;
+    }
+
+    return endContainer();
+  }
+
+  bool parse_error(std::size_t position, const std::string& /*lastToken*/, const json::exception& ex) override
+  {
+    throw IllegalStateException("Failed to parse mirror node page at byte " + std::to_string(position) + ": " +
+                                ex.what());
+  }
+
+private:
+  // Is an element of the collection being built, or is the next value one?
+  [[nodiscard]] bool inItem() const { return !mItemStack.empty() || (mInCollection && mDepth == 2); }
+
+  // Add a value to the element being built, or make it an element if it's a scalar directly in the collection.
+  bool value(json&& val)
+  {
+    if (!mItemStack.empty())
+    {
+      insert(std::move(val));
+    }
+    else if (mInCollection && mDepth == 2)
+    {
+      mPage.mItems.push_back(std::move(val));
+    }
+
+    return true;
+  }
+
+  bool startContainer(json&& container)
+  {
+    if (!inItem())
+    {
+      ++mDepth;
+      return true;
+    }
+
+    if (mItemStack.empty())
+    {
+      mItem = std::move(container);
+      mItemStack.push_back(&mItem);
+    }
+    else
+    {
+      mItemStack.push_back(&insert(std::move(container)));
+    }
+
+    return true;
+  }
+
+  bool endContainer()
+  {
+    if (mItemStack.empty())
+    {
+      --mDepth;
+      return true;
+    }
+
+    mItemStack.pop_back();
+    if (mItemStack.empty())
+    {
+      mPage.mItems.push_back(std::move(mItem));
+      mItem = json();
+    }
+
+    return true;
+  }
+
+  // Insert a value into the innermost container of the element being built, and get a reference to it.
+  json& insert(json&& val)
+  {
+    json& parent = *mItemStack.back();
+    if (parent.is_array())
+    {
+      parent.push_back(std::move(val));
+      return parent.back();
+    }
+
+    json& child = parent[mItemKey];
+    child = std::move(val);
+    return child;
+  }
+
+  // The name of the collection's array.
+  std::string_view mCollection;
+
+  // The page being parsed into.
+  MirrorPage& mPage;
+
+  // The nesting depth outside of the elements, the current keys at the top level and in "links", and whether the
+  // collection's array is open.
+  int mDepth = 0;
+  std::string mTopKey;
+  std::string mLinksKey;
+  bool mInCollection = false;
+
+  // The element being built, the open containers within it, and the current key in the innermost one.
+  json mItem;
+  std::vector<json*> mItemStack;
+  std::string mItemKey;
+};
+
+// Get the path (and query) of a page from a link to it. An absolute link is reduced to its path, so that failing over
+// sends the request to the next mirror node rather than to the host in the link again.
+std::string getPagePath(const std::string& link)
+{
+  const size_t schemeEnd = link.find("://");
+  if (schemeEnd == std::string::npos)
+  {
+    return link;
+  }
+
+  const size_t pathStart = link.find_first_of("/?", schemeEnd + 3);
+  if (pathStart == std::string::npos)
+  {
+    return "/";
+  }
+
+  return (link[pathStart] == '/') ? link.substr(pathStart) : '/' + link.substr(pathStart);
+}
+
+} // anonymous namespace
+
+//-----
+MirrorPage parseMirrorPage(std::string_view body, std::string_view collection)
+{
+  MirrorPage page;
+  MirrorPageHandler handler(collection, page);
+  json::sax_parse(body.begin(), body.end(), &handler);
+  return page;
+}
+
+//-----
+MirrorPaginator::MirrorPaginator(const Client& client,
+                                 std::string path,
+                                 std::string collection,
+                                 std::function<std::string(std::string_view mirrorNodeUrl)> getBaseUrl,
+                                 const std::chrono::system_clock::duration& cacheTtl)
+  : mClient(client)
+  , mCollection(std::move(collection))
+  , mGetBaseUrl(std::move(getBaseUrl))
+  , mCacheTtl(cacheTtl)
+{
+  if (!mGetBaseUrl)
+  {
+    mGetBaseUrl = [](std::string_view mirrorNodeUrl) { return MirrorNodeGateway::buildBaseUrl(mirrorNodeUrl, "GET"); };
+  }
+
+  prefetch(path);
+}
+
+//-----
+std::optional<json> MirrorPaginator::next()
+{
+  while (mIndex >= mItems.size())
+  {
+    if (!mNextPage.has_value())
+    {
+      return {};
+    }
+
+    // Take the fetched page, and start fetching the one after it while this one is consumed. The future is taken out
+    // first, so that a page that failed to be fetched ends the collection after its error is thrown.
+    std::future<MirrorPage> nextPage = std::move(*mNextPage);
+    mNextPage.reset();
+    MirrorPage page = nextPage.get();
+    mItems = std::move(page.mItems);
+    mIndex = 0ULL;
+
+    if (!page.mNextPath.empty())
+    {
+      prefetch(page.mNextPath);
+    }
+  }
+
+  return std::move(mItems[mIndex++]);
+}
+
+//-----
+void MirrorPaginator::prefetch(const std::string& path)
+{
+  const std::shared_ptr<MirrorNetwork> network = mClient.getClientMirrorNetwork();
+  if (!network)
+  {
+    throw IllegalStateException("Mirror network is not configured");
+  }
+
+  mNextPage = mClient.getHttpExecutor()->submit(
+    MirrorNodeGateway::getQueryHost(*network),
+    [network,
+     cache = mClient.getMirrorResponseCache(),
+     getBaseUrl = mGetBaseUrl,
+     cacheTtl = mCacheTtl,
+     collection = mCollection,
+     path = getPagePath(path)]()
+    {
+      const std::string body = MirrorNodeGateway::invokeWithFailover(
+        *network,
+        [&getBaseUrl, &path](std::string_view mirrorNodeUrl) { return getBaseUrl(mirrorNodeUrl) + path; },
+        "GET",
+        "",
+        cache.get(),
+        cacheTtl);
+      return parseMirrorPage(body, collection);
+    });
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/MirrorResponseCache.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace Hiero::internal
+{
+namespace
+{
+// The index in a URL to begin searching for the path after the end of the URL scheme ("http://" or "https://").
+const int SCHEME_END_INDEX = 8;
+
+} // anonymous namespace
+
+//-----
+MirrorResponseCache::MirrorResponseCache(size_t maxEntries)
+  : mMaxEntries(maxEntries)
+{
+  if (maxEntries == 0ULL)
+  {
+    throw std::invalid_argument("Mirror response cache must hold at least one response");
+  }
+}
+
+//-----
+std::string MirrorResponseCache::makeKey(std::string_view method, std::string_view url, std::string_view body)
+{
+  const size_t pathStart = url.find('/', SCHEME_END_INDEX);
+  std::string key(method);
+  key += ' ';
+  key += (pathStart == std::string_view::npos) ? std::string_view("/") : url.substr(pathStart);
+  key += '\n';
+  key += body;
+  return key;
+}
+
+//-----
+std::string MirrorResponseCache::makeQueryCostKey(int queryCase, size_t requestSize)
+{
+  size_t sizeClass = 1ULL;
+  while (sizeClass < requestSize)
+  {
+    sizeClass <<= 1U;
+  }
+
+  return std::to_string(queryCase) + ':' + std::to_string(sizeClass);
+}
+
+//-----
+MirrorResponseCache::Lookup MirrorResponseCache::lookup(const std::string& key)
+{
+  std::unique_lock lock(mMutex);
+
+  Lookup result;
+  const auto iter = mIndex.find(key);
+  if (iter == mIndex.end())
+  {
+    ++mStatistics.mMisses;
+    return result;
+  }
+
+  if (iter->second->mExpiry > std::chrono::steady_clock::now())
+  {
+    ++mStatistics.mHits;
+    mEntries.splice(mEntries.begin(), mEntries, iter->second);
+    result.mFreshBody = iter->second->mBody;
+    return result;
+  }
+
+  ++mStatistics.mMisses;
+  result.mETag = iter->second->mETag;
+  return result;
+}
+
+//-----
+void MirrorResponseCache::put(const std::string& key,
+                              std::string body,
+                              std::string eTag,
+                              const std::chrono::system_clock::duration& ttl)
+{
+  const std::chrono::steady_clock::time_point expiry =
+    std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(ttl);
+
+  std::unique_lock lock(mMutex);
+  if (const auto iter = mIndex.find(key); iter != mIndex.end())
+  {
+    iter->second->mBody = std::move(body);
+    iter->second->mETag = std::move(eTag);
+    iter->second->mExpiry = expiry;
+    mEntries.splice(mEntries.begin(), mEntries, iter->second);
+    return;
+  }
+
+  if (mEntries.size() >= mMaxEntries)
+  {
+    mIndex.erase(mEntries.back().mKey);
+    mEntries.pop_back();
+    ++mStatistics.mEvictions;
+  }
+
+  mEntries.push_front({ key, std::move(body), std::move(eTag), expiry });
+  mIndex.emplace(key, mEntries.begin());
+}
+
+//-----
+std::optional<std::string> MirrorResponseCache::revalidate(const std::string& key,
+                                                           const std::chrono::system_clock::duration& ttl)
+{
+  std::unique_lock lock(mMutex);
+  const auto iter = mIndex.find(key);
+  if (iter == mIndex.end())
+  {
+    return {};
+  }
+
+  ++mStatistics.mRevalidations;
+  iter->second->mExpiry =
+    std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(ttl);
+  mEntries.splice(mEntries.begin(), mEntries, iter->second);
+  return iter->second->mBody;
+}
+
+//-----
+void MirrorResponseCache::erase(const std::string& key)
+{
+  std::unique_lock lock(mMutex);
+  if (const auto iter = mIndex.find(key); iter != mIndex.end())
+  {
+    mEntries.erase(iter->second);
+    mIndex.erase(iter);
+  }
+}
+
+//-----
+void MirrorResponseCache::clear()
+{
+  std::unique_lock lock(mMutex);
+  mEntries.clear();
+  mIndex.clear();
+}
+
+//-----
+MirrorResponseCache::Statistics MirrorResponseCache::getStatistics() const
+{
+  std::unique_lock lock(mMutex);
+  Statistics statistics = mStatistics;
+  statistics.mEntries = mEntries.size();
+  return statistics;
+}
+
+} // namespace Hiero::internal
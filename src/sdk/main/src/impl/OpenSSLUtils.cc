@@ -4,101 +4,119 @@
 #include "impl/Utilities.h"
 #include "impl/openssl_utils/EVP_MD.h"
 #include "impl/openssl_utils/EVP_MD_CTX.h"
-#include "impl/openssl_utils/OSSL_LIB_CTX.h"
 
 #include <openssl/err.h>
 #include <openssl/hmac.h>
 #include <openssl/rand.h>
-#include <openssl/sha.h>
 #include <stdexcept>
 
 namespace Hiero::internal::OpenSSLUtils
 {
-//-----
-std::vector<std::byte> computeSHA256(const std::vector<std::byte>& data)
+namespace
+{
+/**
+ * Fetch a message digest from the default library context.
+ *
+ * @param name The name of the message digest to fetch.
+ * @return The fetched message digest.
+ * @throws OpenSSLException If OpenSSL is unable to fetch the message digest.
+ */
+[[nodiscard]] EVP_MD fetchMessageDigest(const char* name)
 {
-  auto outputBytes = std::vector<std::byte>(SHA256_HASH_SIZE);
-  SHA256(Utilities::toTypePtr<unsigned char>(data.data()),
-         data.size(),
-         Utilities::toTypePtr<unsigned char>(outputBytes.data()));
-  return outputBytes;
+  EVP_MD messageDigest(EVP_MD_fetch(nullptr, name, nullptr));
+  if (!messageDigest)
+  {
+    throw OpenSSLException(getErrorMessage("EVP_MD_fetch"));
+  }
+
+  return messageDigest;
 }
 
-//-----
-std::vector<std::byte> computeSHA384(const std::vector<std::byte>& data)
+// Fetching an algorithm is far more expensive than hashing the small inputs the SDK hashes, so each message digest is
+// fetched once and shared by all threads (fetched EVP_MD objects are immutable). If a fetch fails, the exception
+// propagates out of the static initializer and the fetch is retried on the next call.
+
+[[nodiscard]] const ::EVP_MD* getSHA256MessageDigest()
 {
-  auto outputBytes = std::vector<std::byte>(SHA384_HASH_SIZE);
-  SHA384(Utilities::toTypePtr<unsigned char>(data.data()),
-         data.size(),
-         Utilities::toTypePtr<unsigned char>(outputBytes.data()));
-  return outputBytes;
+  static const EVP_MD messageDigest = fetchMessageDigest("SHA256");
+  return messageDigest.get();
 }
 
-//-----
-std::vector<std::byte> computeKECCAK256(const std::vector<std::byte>& data)
+[[nodiscard]] const ::EVP_MD* getSHA384MessageDigest()
 {
-  internal::OpenSSLUtils::OSSL_LIB_CTX libraryContext(OSSL_LIB_CTX_new());
-  if (!libraryContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("OSSL_LIB_CTX_new"));
-  }
+  static const EVP_MD messageDigest = fetchMessageDigest("SHA384");
+  return messageDigest.get();
+}
 
-  const internal::OpenSSLUtils::EVP_MD messageDigest(EVP_MD_fetch(libraryContext.get(), "KECCAK-256", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_fetch"));
-  }
+[[nodiscard]] const ::EVP_MD* getSHA512MessageDigest()
+{
+  static const EVP_MD messageDigest = fetchMessageDigest("SHA512");
+  return messageDigest.get();
+}
 
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
+/**
+ * Compute the hash of a byte array. Each thread reuses its own message digest context, so hashing doesn't allocate
+ * a new context per call.
+ *
+ * @param messageDigest The message digest with which to hash.
+ * @param data          The bytes of which to compute the hash.
+ * @param hashSize      The size of the hash produced by the message digest.
+ * @return The hash of the data.
+ * @throws OpenSSLException If OpenSSL is unable to compute the hash.
+ */
+[[nodiscard]] std::vector<std::byte> computeHash(const ::EVP_MD* messageDigest, ByteView data, size_t hashSize)
+{
+  thread_local EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
   if (!messageDigestContext)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
+    throw OpenSSLException(getErrorMessage("EVP_MD_CTX_new"));
   }
 
-  if (EVP_DigestInit(messageDigestContext.get(), messageDigest.get()) <= 0)
+  // EVP_DigestInit_ex resets any state left over from this thread's previous hash.
+  if (EVP_DigestInit_ex(messageDigestContext.get(), messageDigest, nullptr) <= 0)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestInit_ex"));
+    throw OpenSSLException(getErrorMessage("EVP_DigestInit_ex"));
   }
 
-  if (EVP_DigestUpdate(
-        messageDigestContext.get(), internal::Utilities::toTypePtr<unsigned char>(data.data()), data.size()) <= 0)
+  if (EVP_DigestUpdate(messageDigestContext.get(), Utilities::toTypePtr<unsigned char>(data.data()), data.size()) <= 0)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestUpdate"));
+    throw OpenSSLException(getErrorMessage("EVP_DigestUpdate"));
   }
 
-  std::vector<std::byte> hash;
-  hash.resize(KECCAK256_HASH_SIZE);
-  if (EVP_DigestFinal(
-        messageDigestContext.get(), internal::Utilities::toTypePtr<unsigned char>(hash.data()), nullptr) <= 0)
+  std::vector<std::byte> hash(hashSize);
+  if (EVP_DigestFinal_ex(messageDigestContext.get(), Utilities::toTypePtr<unsigned char>(hash.data()), nullptr) <= 0)
   {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestFinal_ex"));
+    throw OpenSSLException(getErrorMessage("EVP_DigestFinal_ex"));
   }
 
   return hash;
 }
 
+} // namespace
+
 //-----
-std::vector<std::byte> computeSHA512HMAC(const std::vector<std::byte>& key, const std::vector<std::byte>& data)
+std::vector<std::byte> computeSHA256(ByteView data)
 {
-  EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(getErrorMessage("EVP_MD_CTX_new"));
-  }
+  return computeHash(getSHA256MessageDigest(), data, SHA256_HASH_SIZE);
+}
 
-  const EVP_MD messageDigest(EVP_MD_fetch(nullptr, "SHA512", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(getErrorMessage("EVP_MD_fetch"));
-  }
+//-----
+std::vector<std::byte> computeSHA384(ByteView data)
+{
+  return computeHash(getSHA384MessageDigest(), data, SHA384_HASH_SIZE);
+}
 
-  if (EVP_DigestInit(messageDigestContext.get(), messageDigest.get()) <= 0)
-  {
-    throw OpenSSLException(getErrorMessage("EVP_DigestInit"));
-  }
+//-----
+std::vector<std::byte> computeKECCAK256(ByteView data)
+{
+  return computeHash(getKECCAK256MessageDigest(), data, KECCAK256_HASH_SIZE);
+}
 
+//-----
+std::vector<std::byte> computeSHA512HMAC(const std::vector<std::byte>& key, const std::vector<std::byte>& data)
+{
   std::vector<std::byte> digest(SHA512_HMAC_HASH_SIZE);
-  if (!HMAC(messageDigest.get(),
+  if (!HMAC(getSHA512MessageDigest(),
             key.data(),
             static_cast<int>(key.size()),
             Utilities::toTypePtr<unsigned char>(data.data()),
@@ -112,6 +130,13 @@ std::vector<std::byte> computeSHA512HMAC(const std::vector<std::byte>& key, cons
   return digest;
 }
 
+//-----
+const ::EVP_MD* getKECCAK256MessageDigest()
+{
+  static const EVP_MD messageDigest = fetchMessageDigest("KECCAK-256");
+  return messageDigest.get();
+}
+
 //-----
 std::string getErrorMessage(std::string_view functionName)
 {
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/SignatureVerifier.h"
+#include "ED25519PublicKey.h"
+#include "PublicKey.h"
+#include "exceptions/OpenSSLException.h"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+namespace Hiero::internal::SignatureVerifier
+{
+namespace
+{
+// The minimum number of signatures each worker thread should verify. Below this, the cost of spinning up a thread
+// outweighs the cost of just verifying the signatures inline.
+constexpr size_t MIN_CHECKS_PER_THREAD = 32ULL;
+
+/**
+ * Verify a contiguous range of signature checks.
+ *
+ * @param checks The signature checks.
+ * @param begin  The index of the first check to verify.
+ * @param end    The index one past the last check to verify.
+ */
+void verifyRange(const std::vector<SignatureCheck*>& checks, size_t begin, size_t end)
+{
+  for (size_t i = begin; i < end; ++i)
+  {
+    SignatureCheck& check = *checks[i];
+    if (!check.mResult.mPublicKey || !check.mSignedBytes)
+    {
+      check.mResult.mIsValid = false;
+      continue;
+    }
+
+    try
+    {
+      check.mResult.mIsValid = check.mResult.mPublicKey->verifySignature(check.mResult.mSignature, *check.mSignedBytes);
+    }
+    catch (const OpenSSLException&)
+    {
+      // A malformed signature that OpenSSL can't even process is simply an invalid signature.
+      check.mResult.mIsValid = false;
+    }
+  }
+}
+
+} // namespace
+
+//-----
+void verifySignatures(std::vector<SignatureCheck>& checks)
+{
+  if (checks.empty())
+  {
+    return;
+  }
+
+  // Group the checks by key type (ED25519 first, then ECDSAsecp256k1 and anything else) so that each worker runs
+  // through a mostly homogeneous set of verifications. The relative order within each group is preserved.
+  std::vector<SignatureCheck*> grouped;
+  grouped.reserve(checks.size());
+  for (SignatureCheck& check : checks)
+  {
+    grouped.push_back(&check);
+  }
+
+  std::stable_partition(grouped.begin(),
+                        grouped.end(),
+                        [](const SignatureCheck* check)
+                        { return dynamic_cast<const ED25519PublicKey*>(check->mResult.mPublicKey.get()) != nullptr; });
+
+  // Determine how many threads to use. OpenSSL has no batched ED25519 verification, so the throughput gain comes from
+  // spreading the groups across cores.
+  const size_t hardwareThreads = std::max(1U, std::thread::hardware_concurrency());
+  const size_t numThreads = std::min(hardwareThreads, std::max<size_t>(1ULL, grouped.size() / MIN_CHECKS_PER_THREAD));
+
+  if (numThreads == 1ULL)
+  {
+    verifyRange(grouped, 0ULL, grouped.size());
+    return;
+  }
+
+  const size_t checksPerThread = (grouped.size() + numThreads - 1ULL) / numThreads;
+  std::vector<std::future<void>> workers;
+  workers.reserve(numThreads);
+  for (size_t begin = 0ULL; begin < grouped.size(); begin += checksPerThread)
+  {
+    const size_t end = std::min(grouped.size(), begin + checksPerThread);
+    workers.push_back(std::async(std::launch::async, [&grouped, begin, end]() { verifyRange(grouped, begin, end); }));
+  }
+
+  for (std::future<void>& worker : workers)
+  {
+    worker.get();
+  }
+}
+
+} // namespace Hiero::internal::SignatureVerifier
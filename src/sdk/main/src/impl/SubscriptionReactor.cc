@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/SubscriptionReactor.h"
+#include "exceptions/IllegalStateException.h"
+
+#include <grpcpp/alarm.h>
+
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Hiero::internal
+{
+namespace
+{
+// The reactor whose callback thread this is, if it is one.
+thread_local const SubscriptionReactor* tCallbackThreadReactor = nullptr;
+
+// A Handler that posts a task when its alarm fires or is cancelled.
+class TimerHandler : public SubscriptionReactor::Handler
+{
+public:
+  TimerHandler(SubscriptionReactor& reactor, std::function<void()> task)
+    : mReactor(reactor)
+    , mTask(std::move(task))
+  {
+  }
+
+  void start(const std::chrono::system_clock::time_point& deadline)
+  {
+    // A timer cancelled before it starts (i.e. by a shutdown between add() and start()) still has to fire for the
+    // reactor to be done with it, so it fires at once.
+    std::unique_lock lock(mMutex);
+    mAlarm.Set(mReactor.getCompletionQueue(), mCancelled ? std::chrono::system_clock::now() : deadline, this);
+    mStarted = true;
+  }
+
+  bool onEvent(bool /*ok*/) override
+  {
+    mReactor.post(std::move(mTask));
+    return false;
+  }
+
+  void cancel() override
+  {
+    std::unique_lock lock(mMutex);
+    mCancelled = true;
+    if (mStarted)
+    {
+      mAlarm.Cancel();
+    }
+  }
+
+private:
+  SubscriptionReactor& mReactor;
+  std::function<void()> mTask;
+  grpc::Alarm mAlarm;
+
+  // Guards the alarm and the flags, so that a cancel() can't slip in between setting the alarm and recording it.
+  std::mutex mMutex;
+  bool mStarted = false;
+  bool mCancelled = false;
+};
+
+} // anonymous namespace
+
+//-----
+SubscriptionReactor::SubscriptionReactor(unsigned int pollerThreads,
+                                         unsigned int callbackThreads,
+                                         size_t maxPendingTasks,
+                                         Logger logger)
+  : mMaxPendingTasks(maxPendingTasks)
+  , mLogger(std::move(logger))
+{
+  if (maxPendingTasks == 0ULL)
+  {
+    throw std::invalid_argument("Subscription reactor must allow at least one pending task");
+  }
+
+  for (unsigned int i = 0U; i < pollerThreads; ++i)
+  {
+    mPollerThreads.emplace_back(&SubscriptionReactor::poll, this);
+  }
+
+  for (unsigned int i = 0U; i < callbackThreads; ++i)
+  {
+    mCallbackThreads.emplace_back(&SubscriptionReactor::runCallbacks, this);
+  }
+}
+
+//-----
+SubscriptionReactor::~SubscriptionReactor()
+{
+  shutdown();
+}
+
+//-----
+void SubscriptionReactor::add(const std::shared_ptr<Handler>& handler)
+{
+  std::unique_lock lock(mMutex);
+  if (mShuttingDown)
+  {
+    throw IllegalStateException("Subscription reactor is shut down");
+  }
+
+  mHandlers.emplace(handler.get(), handler);
+}
+
+//-----
+void SubscriptionReactor::post(std::function<void()> task)
+{
+  {
+    std::unique_lock lock(mMutex);
+
+    // Waiting on a callback thread could deadlock, as it may be the thread that would make room.
+    if (tCallbackThreadReactor != this)
+    {
+      mTaskTaken.wait(lock, [this]() { return mTasks.size() < mMaxPendingTasks || mStopCallbacks; });
+    }
+
+    mTasks.push_back(std::move(task));
+  }
+
+  mTaskPosted.notify_one();
+}
+
+//-----
+void SubscriptionReactor::postAfter(const std::chrono::system_clock::time_point& deadline, std::function<void()> task)
+{
+  auto timer = std::make_shared<TimerHandler>(*this, std::move(task));
+  add(timer);
+  timer->start(deadline);
+}
+
+//-----
+void SubscriptionReactor::shutdown()
+{
+  std::unique_lock lock(mMutex);
+  if (mShuttingDown)
+  {
+    return;
+  }
+
+  mShuttingDown = true;
+
+  // Cancel every Handler and wait for them to finish. No new operations can be started on the completion queue after
+  // it is shut down, so the queue can't be shut down until every Handler is done with it. Handlers are cancelled
+  // without holding the lock, as they may be posting callbacks while holding their own locks.
+  std::vector<std::shared_ptr<Handler>> handlers;
+  handlers.reserve(mHandlers.size());
+  for (const auto& entry : mHandlers)
+  {
+    handlers.push_back(entry.second);
+  }
+
+  lock.unlock();
+  for (const std::shared_ptr<Handler>& handler : handlers)
+  {
+    handler->cancel();
+  }
+
+  handlers.clear();
+  lock.lock();
+  mHandlerFinished.wait(lock, [this]() { return mHandlers.empty(); });
+  lock.unlock();
+
+  mCompletionQueue.Shutdown();
+  for (std::thread& thread : mPollerThreads)
+  {
+    thread.join();
+  }
+
+  lock.lock();
+  mStopCallbacks = true;
+  lock.unlock();
+  mTaskPosted.notify_all();
+  mTaskTaken.notify_all();
+
+  for (std::thread& thread : mCallbackThreads)
+  {
+    thread.join();
+  }
+}
+
+//-----
+void SubscriptionReactor::poll()
+{
+  void* tag = nullptr;
+  bool ok = false;
+
+  while (mCompletionQueue.Next(&tag, &ok))
+  {
+    auto* handler = static_cast<Handler*>(tag);
+    if (handler->onEvent(ok))
+    {
+      continue;
+    }
+
+    // Release the reactor's reference outside the lock, as it may be the last one.
+    std::shared_ptr<Handler> finished;
+    {
+      std::unique_lock lock(mMutex);
+      if (auto iter = mHandlers.find(handler); iter != mHandlers.end())
+      {
+        finished = std::move(iter->second);
+        mHandlers.erase(iter);
+      }
+    }
+
+    mHandlerFinished.notify_all();
+  }
+}
+
+//-----
+void SubscriptionReactor::runCallbacks()
+{
+  tCallbackThreadReactor = this;
+
+  while (true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(mMutex);
+      mTaskPosted.wait(lock, [this]() { return !mTasks.empty() || mStopCallbacks; });
+      if (mTasks.empty())
+      {
+        return;
+      }
+
+      task = std::move(mTasks.front());
+      mTasks.pop_front();
+    }
+
+    mTaskTaken.notify_one();
+
+    // A throwing callback mustn't take its thread (and with it, the process) down.
+    try
+    {
+      task();
+    }
+    catch (const std::exception& exception)
+    {
+      mLogger.error(std::string("Subscription callback threw an exception: ") + exception.what());
+    }
+    catch (...)
+    {
+      mLogger.error("Subscription callback threw an unknown exception");
+    }
+  }
+}
+
+} // namespace Hiero::internal
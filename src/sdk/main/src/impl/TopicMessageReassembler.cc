@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/TopicMessageReassembler.h"
+#include "Defaults.h"
+#include "impl/TimestampConverter.h"
+
+#include <memory>
+#include <vector>
+#include <utility>
+
+namespace Hiero::internal
+{
+//-----
+TopicMessageReassembler::TopicMessageReassembler(
+  size_t maxPendingBytes,
+  std::chrono::system_clock::duration maxPendingAge,
+  std::function<void(const TransactionId&, uint64_t, uint64_t)> onEvicted,
+  bool views)
+  : mMaxPendingBytes(maxPendingBytes)
+  , mMaxPendingAge(maxPendingAge)
+  , mOnEvicted(std::move(onEvicted))
+  , mViews(views)
+{
+}
+
+//-----
+std::optional<TopicMessage> TopicMessageReassembler::add(
+  com::hedera::mirror::api::proto::ConsensusTopicResponse&& chunk)
+{
+  const std::chrono::system_clock::time_point consensusTimestamp =
+    TimestampConverter::fromProtobuf(chunk.consensustimestamp());
+  const int32_t total = chunk.chunkinfo().total();
+  const int32_t number = chunk.chunkinfo().number();
+
+  if (total < 1 || number < 1 || number > total)
+  {
+    ++mStatistics.mIgnoredChunks;
+    return {};
+  }
+
+  const TransactionId transactionId = TransactionId::fromProtobuf(chunk.chunkinfo().initialtransactionid());
+
+  // A late chunk of an evicted message would only start a new partial message that can't be completed.
+  if (mEvictedIndex.find(transactionId) != mEvictedIndex.end())
+  {
+    ++mStatistics.mEvictedChunks;
+    return {};
+  }
+
+  auto indexIter = mIndex.find(transactionId);
+  if (indexIter == mIndex.end())
+  {
+    PendingMessage pending;
+    pending.mTransactionId = transactionId;
+    pending.mFirstConsensusTimestamp = consensusTimestamp;
+    pending.mTotalChunks = static_cast<uint64_t>(total);
+    indexIter = mIndex.emplace(transactionId, mPending.insert(mPending.end(), std::move(pending))).first;
+  }
+
+  const auto pendingIter = indexIter->second;
+  PendingMessage& pending = *pendingIter;
+
+  if (pending.mTotalChunks != static_cast<uint64_t>(total) || pending.mChunks.count(number) > 0ULL)
+  {
+    ++mStatistics.mIgnoredChunks;
+    return {};
+  }
+
+  const size_t bytes = chunk.message().size();
+  pending.mChunks.emplace(number, std::move(chunk));
+  pending.mBytes += bytes;
+  mStatistics.mPendingBytes += bytes;
+
+  if (pending.mChunks.size() == pending.mTotalChunks)
+  {
+    // The chunks are moved out in chunk order, and a view takes them over instead of copying out of them.
+    std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse> chunks;
+    chunks.reserve(pending.mChunks.size());
+    for (auto& received : pending.mChunks)
+    {
+      chunks.push_back(std::move(received.second));
+    }
+
+    TopicMessage message =
+      mViews ? TopicMessage::viewOf(
+                 std::make_shared<const std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>>(
+                   std::move(chunks)))
+             : TopicMessage::ofMany(chunks);
+    remove(pendingIter);
+    ++mStatistics.mCompletedMessages;
+    evict(consensusTimestamp);
+    return message;
+  }
+
+  evict(consensusTimestamp);
+  return {};
+}
+
+//-----
+TopicMessageReassembler::Statistics TopicMessageReassembler::getStatistics() const
+{
+  Statistics statistics = mStatistics;
+  statistics.mPendingMessages = mPending.size();
+  return statistics;
+}
+
+//-----
+std::optional<std::chrono::system_clock::time_point> TopicMessageReassembler::getOldestPendingTimestamp() const
+{
+  if (mPending.empty())
+  {
+    return {};
+  }
+
+  return mPending.front().mFirstConsensusTimestamp;
+}
+
+//-----
+void TopicMessageReassembler::evict(const std::chrono::system_clock::time_point& latestConsensusTimestamp)
+{
+  // Messages are held in the order their first chunk was received, which is also their consensus order, so the oldest
+  // messages are always at the front.
+  while (!mPending.empty() && (mStatistics.mPendingBytes > mMaxPendingBytes ||
+                               latestConsensusTimestamp - mPending.front().mFirstConsensusTimestamp > mMaxPendingAge))
+  {
+    const PendingMessage& oldest = mPending.front();
+    ++mStatistics.mEvictedMessages;
+    mStatistics.mEvictedChunks += oldest.mChunks.size();
+
+    if (mOnEvicted)
+    {
+      mOnEvicted(oldest.mTransactionId, oldest.mChunks.size(), oldest.mTotalChunks);
+    }
+
+    mEvicted.push_back(oldest.mTransactionId);
+    mEvictedIndex.insert(oldest.mTransactionId);
+    if (mEvicted.size() > DEFAULT_MAX_EVICTED_TOPIC_MESSAGES)
+    {
+      mEvictedIndex.erase(mEvicted.front());
+      mEvicted.pop_front();
+    }
+
+    remove(mPending.begin());
+  }
+}
+
+//-----
+void TopicMessageReassembler::remove(std::list<PendingMessage>::iterator iter)
+{
+  mStatistics.mPendingBytes -= iter->mBytes;
+  mIndex.erase(iter->mTransactionId);
+  mPending.erase(iter);
+}
+
+} // namespace Hiero::internal
@@ -78,6 +78,24 @@ std::string byteVectorToString(const std::vector<std::byte>& bytes)
   return str;
 }
 
+//-----
+std::vector<std::byte> readBytes(std::istream& stream, size_t maxBytes)
+{
+  constexpr size_t BLOCK_SIZE = 64ULL * 1024ULL;
+
+  std::vector<std::byte> bytes;
+  while (bytes.size() < maxBytes && stream.good())
+  {
+    const size_t offset = bytes.size();
+    const size_t blockSize = std::min(maxBytes - offset, BLOCK_SIZE);
+    bytes.resize(offset + blockSize);
+    stream.read(reinterpret_cast<char*>(bytes.data() + offset), static_cast<std::streamsize>(blockSize));
+    bytes.resize(offset + static_cast<size_t>(stream.gcount()));
+  }
+
+  return bytes;
+}
+
 //-----
 unsigned int getRandomNumber(unsigned int lowerBound, unsigned int upperBound)
 {
@@ -1,8 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "AccountId.h"
+#include "Client.h"
 #include "ECDSAsecp256k1PrivateKey.h"
 #include "ED25519PrivateKey.h"
 #include "PublicKey.h"
+#include "exceptions/UninitializedException.h"
 #include "impl/Utilities.h"
 
 #include <gtest/gtest.h>
@@ -614,4 +616,35 @@ TEST_F(AccountIdUnitTests, ToStringWithEvmAddressAlias)
   EXPECT_EQ(accountId.toString(),
             std::to_string(getTestShardNum()) + '.' + std::to_string(getTestRealmNum()) + '.' +
               getTestEvmAddressAlias().toString());
-}
\ No newline at end of file
+}
+
+//-----
+TEST_F(AccountIdUnitTests, PopulateAccountEvmAddressesWithoutMirrorNetwork)
+{
+  // Given
+  const Client client = Client::forNetwork({});
+  std::vector<AccountId> accountIds = { AccountId(getTestAccountNum()) };
+
+  // When / Then
+  EXPECT_THROW(AccountId::populateAccountEvmAddresses(client, accountIds), UninitializedException);
+}
+
+//-----
+TEST_F(AccountIdUnitTests, PopulateAccountEvmAddressesWithoutAccountNums)
+{
+  // Given
+  Client client = Client::forNetwork({});
+  client.setMirrorNetwork({ "127.0.0.1:5600" });
+  std::vector<AccountId> accountIds = { AccountId(getTestEd25519Alias()), AccountId(getTestEvmAddressAlias()) };
+
+  // When
+  const std::vector<std::optional<EvmAddress>> evmAddresses =
+    AccountId::populateAccountEvmAddresses(client, accountIds);
+
+  // Then
+  ASSERT_EQ(evmAddresses.size(), accountIds.size());
+  EXPECT_FALSE(evmAddresses.at(0).has_value());
+  EXPECT_FALSE(evmAddresses.at(1).has_value());
+  EXPECT_EQ(accountIds.at(0).mPublicKeyAlias, getTestEd25519Alias());
+  EXPECT_EQ(accountIds.at(1).mEvmAddressAlias->toString(), getTestEvmAddressAlias().toString());
+}
@@ -3,23 +3,141 @@
 #include "Client.h"
 #include "ED25519PrivateKey.h"
 #include "FileAppendTransaction.h"
+#include "Status.h"
+#include "TopicId.h"
+#include "TopicMessageSubmitTransaction.h"
+#include "TransactionResponse.h"
 #include "exceptions/IllegalStateException.h"
+#include "exceptions/PrecheckStatusException.h"
 
 #include <cstddef>
+#include <grpcpp/grpcpp.h>
 #include <gtest/gtest.h>
+#include <services/consensus_service.grpc.pb.h>
+#include <services/consensus_submit_message.pb.h>
+#include <services/response_code.pb.h>
+#include <services/transaction.pb.h>
+#include <services/transaction_contents.pb.h>
+#include <services/transaction_response.pb.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 using namespace Hiero;
 
+namespace
+{
+// The number of the chunk the current thread is submitting, for the response listener to answer.
+thread_local int32_t tSubmittingChunk = 0;
+} // anonymous namespace
+
 class ChunkedTransactionUnitTests : public ::testing::Test
 {
 protected:
+  void SetUp() override
+  {
+    // The node's ConsensusService answers every call with UNIMPLEMENTED, and the response listener of each transaction
+    // stands in for it. This only needs a reachable node.
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &mPort);
+    builder.RegisterService(&mService);
+    mServer = builder.BuildAndStart();
+
+    mClient = Client::forNetwork({
+      {"127.0.0.1:" + std::to_string(mPort), getNodeAccountId()}
+    });
+    mClient.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey());
+  }
+
+  void TearDown() override
+  {
+    mClient.close();
+    mServer->Shutdown();
+  }
+
+  // Make a TopicMessageSubmitTransaction of a number of chunks against the test node. Each chunk takes a while to
+  // submit, so that chunks in flight overlap, except the chunk with the failing number, which fails pre-check at once.
+  [[nodiscard]] TopicMessageSubmitTransaction makeTopicMessage(unsigned int chunks,
+                                                               unsigned int maxChunksInFlight,
+                                                               int32_t failingChunk = 0)
+  {
+    TopicMessageSubmitTransaction transaction;
+    transaction.setTopicId(TopicId(5ULL))
+      .setMessage(std::string(chunks * getTestChunkSize(), 'a'))
+      .setChunkSize(getTestChunkSize())
+      .setMaxChunks(chunks)
+      .setMaxChunksInFlight(maxChunksInFlight)
+      .setNodeAccountIds({ getNodeAccountId() });
+    transaction.setRequestListener(
+      [this, failingChunk](proto::Transaction& request)
+      {
+        proto::SignedTransaction signedTx;
+        proto::TransactionBody body;
+        signedTx.ParseFromString(request.signedtransactionbytes());
+        body.ParseFromString(signedTx.bodybytes());
+        tSubmittingChunk = body.consensussubmitmessage().chunkinfo().number();
+
+        {
+          std::unique_lock lock(mMutex);
+          mSubmittedChunks.push_back(tSubmittingChunk);
+        }
+
+        const int inFlight = ++mInFlight;
+        int maxInFlight = mMaxInFlight;
+        while (inFlight > maxInFlight && !mMaxInFlight.compare_exchange_weak(maxInFlight, inFlight))
+        {
+        }
+
+        if (tSubmittingChunk != failingChunk)
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+
+        --mInFlight;
+        return request;
+      });
+    transaction.setResponseListener(
+      [failingChunk](proto::TransactionResponse&)
+      {
+        proto::TransactionResponse response;
+        response.set_nodetransactionprecheckcode(tSubmittingChunk == failingChunk
+                                                   ? proto::ResponseCodeEnum::INVALID_TOPIC_ID
+                                                   : proto::ResponseCodeEnum::OK);
+        return response;
+      });
+    return transaction;
+  }
+
+  [[nodiscard]] std::vector<int32_t> getSubmittedChunks()
+  {
+    std::unique_lock lock(mMutex);
+    return mSubmittedChunks;
+  }
+
   [[nodiscard]] inline unsigned int getTestMaxChunks() const { return mTestMaxChunks; }
   [[nodiscard]] inline unsigned int getTestChunkSize() const { return mTestChunkSize; }
+  [[nodiscard]] inline const AccountId& getNodeAccountId() const { return mNodeAccountId; }
+  [[nodiscard]] inline const Client& getClient() const { return mClient; }
+  [[nodiscard]] inline int getMaxInFlight() const { return mMaxInFlight; }
 
 private:
   const unsigned int mTestMaxChunks = 1U;
   const unsigned int mTestChunkSize = 2U;
+  const AccountId mNodeAccountId = AccountId(3ULL);
+  proto::ConsensusService::Service mService;
+  std::unique_ptr<grpc::Server> mServer;
+  int mPort = 0;
+  Client mClient;
+  std::mutex mMutex;
+  std::vector<int32_t> mSubmittedChunks;
+  std::atomic_int mInFlight{ 0 };
+  std::atomic_int mMaxInFlight{ 0 };
 };
 
 //-----
@@ -73,3 +191,70 @@ TEST_F(ChunkedTransactionUnitTests, GetSetChunkSizeFrozen)
   // When / Then
   EXPECT_THROW(transaction.setChunkSize(getTestChunkSize()), IllegalStateException);
 }
+
+//-----
+TEST_F(ChunkedTransactionUnitTests, PipelinedChunksReturnResponsesInChunkOrder)
+{
+  // Given
+  TopicMessageSubmitTransaction transaction = makeTopicMessage(6U, 3U);
+
+  // When
+  const std::vector<TransactionResponse> responses = transaction.executeAll(getClient());
+
+  // Then
+  ASSERT_EQ(responses.size(), 6ULL);
+  for (size_t i = 1; i < responses.size(); ++i)
+  {
+    EXPECT_EQ(responses.at(i).mTransactionId.mValidTransactionTime,
+              responses.at(0).mTransactionId.mValidTransactionTime + std::chrono::system_clock::duration(i));
+  }
+
+  std::vector<int32_t> submitted = getSubmittedChunks();
+  std::sort(submitted.begin(), submitted.end());
+  EXPECT_EQ(submitted, (std::vector<int32_t>{ 1, 2, 3, 4, 5, 6 }));
+}
+
+//-----
+TEST_F(ChunkedTransactionUnitTests, PipelinedChunksStayWithinMaxChunksInFlight)
+{
+  // Given
+  TopicMessageSubmitTransaction transaction = makeTopicMessage(7U, 2U);
+
+  // When
+  const std::vector<TransactionResponse> responses = transaction.executeAll(getClient());
+
+  // Then
+  EXPECT_EQ(responses.size(), 7ULL);
+  EXPECT_EQ(getMaxInFlight(), 2);
+}
+
+//-----
+TEST_F(ChunkedTransactionUnitTests, PipelinedChunksStopAfterFirstFailure)
+{
+  // Given
+  TopicMessageSubmitTransaction transaction = makeTopicMessage(10U, 2U, 2);
+
+  // When
+  EXPECT_THROW(transaction.executeAll(getClient()), PrecheckStatusException);
+
+  // Then
+  const std::vector<int32_t> submitted = getSubmittedChunks();
+  EXPECT_EQ(submitted.front(), 1);
+  EXPECT_NE(std::find(submitted.cbegin(), submitted.cend(), 2), submitted.cend());
+  EXPECT_LE(submitted.size(), 3ULL);
+}
+
+//-----
+TEST_F(ChunkedTransactionUnitTests, ChunksAreSubmittedOneAtATimeWithoutPipelining)
+{
+  // Given
+  TopicMessageSubmitTransaction transaction = makeTopicMessage(4U, 1U);
+
+  // When
+  const std::vector<TransactionResponse> responses = transaction.executeAll(getClient());
+
+  // Then
+  EXPECT_EQ(responses.size(), 4ULL);
+  EXPECT_EQ(getMaxInFlight(), 1);
+  EXPECT_EQ(getSubmittedChunks(), (std::vector<int32_t>{ 1, 2, 3, 4 }));
+}
@@ -4,6 +4,10 @@
 #include "Defaults.h"
 #include "ED25519PrivateKey.h"
 #include "Hbar.h"
+#include "exceptions/IllegalStateException.h"
+#include "impl/HttpExecutor.h"
+#include "impl/MirrorNetwork.h"
+#include "impl/SubscriptionReactor.h"
 
 #include <gtest/gtest.h>
 
@@ -360,6 +364,22 @@ TEST_F(ClientUnitTests, NetworkUpdateThreadDoesNotDeadlockOnClose)
   SUCCEED();
 }
 
+//-----
+TEST_F(ClientUnitTests, ClosedClientDoesNotRecreateExecutors)
+{
+  // Given
+  Client client = Client::forNetwork({});
+  ASSERT_NE(client.getSubscriptionReactor(), nullptr);
+  ASSERT_NE(client.getHttpExecutor(), nullptr);
+
+  // When
+  client.close();
+
+  // Then
+  EXPECT_THROW(static_cast<void>(client.getSubscriptionReactor()), IllegalStateException);
+  EXPECT_THROW(static_cast<void>(client.getHttpExecutor()), IllegalStateException);
+}
+
 //-----
 TEST_F(ClientUnitTests, NetworkUpdateThreadSkipsUpdateWhenNoNetworkConfigured)
 {
@@ -377,3 +397,96 @@ TEST_F(ClientUnitTests, NetworkUpdateThreadSkipsUpdateWhenNoNetworkConfigured)
   // thread were holding the lock.
   EXPECT_EQ(client.getNetworkUpdatePeriod(), std::chrono::milliseconds(50));
 }
+
+//-----
+TEST_F(ClientUnitTests, SetMirrorResponseCacheSize)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getMirrorResponseCache(), nullptr);
+
+  // When
+  client.setMirrorResponseCacheSize(16ULL);
+
+  // Then
+  EXPECT_EQ(client.getMirrorResponseCacheSize(), 16ULL);
+  ASSERT_NE(client.getMirrorResponseCache(), nullptr);
+
+  client.setMirrorResponseCacheSize(0ULL);
+  EXPECT_EQ(client.getMirrorResponseCacheSize(), 0ULL);
+  EXPECT_EQ(client.getMirrorResponseCache(), nullptr);
+}
+
+//-----
+TEST_F(ClientUnitTests, SetFeeEstimateCacheTtl)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getFeeEstimateCache(), nullptr);
+
+  // When
+  client.setFeeEstimateCacheTtl(std::chrono::minutes(5));
+
+  // Then
+  EXPECT_EQ(client.getFeeEstimateCacheTtl(), std::chrono::minutes(5));
+  ASSERT_NE(client.getFeeEstimateCache(), nullptr);
+  EXPECT_THROW(client.setFeeEstimateCacheTtl(std::chrono::seconds(-1)), std::invalid_argument);
+
+  client.setFeeEstimateCacheTtl(std::chrono::system_clock::duration::zero());
+  EXPECT_EQ(client.getFeeEstimateCacheTtl(), std::chrono::system_clock::duration::zero());
+  EXPECT_EQ(client.getFeeEstimateCache(), nullptr);
+}
+
+//-----
+TEST_F(ClientUnitTests, SetHttpCompression)
+{
+  // Given
+  Client client = Client::forNetwork({});
+  client.setMirrorNetwork({ "127.0.0.1:5600" });
+  EXPECT_TRUE(client.isHttpCompression());
+  EXPECT_TRUE(client.getClientMirrorNetwork()->isHttpCompression());
+
+  // When
+  client.setHttpCompression(false);
+
+  // Then
+  EXPECT_FALSE(client.isHttpCompression());
+  EXPECT_FALSE(client.getClientMirrorNetwork()->isHttpCompression());
+
+  client.setMirrorNetwork({ "127.0.0.1:5601" });
+  EXPECT_FALSE(client.getClientMirrorNetwork()->isHttpCompression());
+}
+
+//-----
+TEST_F(ClientUnitTests, SetQueryCostCacheTtl)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getQueryCostCache(), nullptr);
+
+  // When
+  client.setQueryCostCacheTtl(std::chrono::minutes(5));
+
+  // Then
+  EXPECT_EQ(client.getQueryCostCacheTtl(), std::chrono::minutes(5));
+  ASSERT_NE(client.getQueryCostCache(), nullptr);
+  EXPECT_THROW(client.setQueryCostCacheTtl(std::chrono::seconds(-1)), std::invalid_argument);
+
+  client.setQueryCostCacheTtl(std::chrono::system_clock::duration::zero());
+  EXPECT_EQ(client.getQueryCostCacheTtl(), std::chrono::system_clock::duration::zero());
+  EXPECT_EQ(client.getQueryCostCache(), nullptr);
+}
+
+//-----
+TEST_F(ClientUnitTests, SetPrepayQueries)
+{
+  // Given
+  Client client;
+  EXPECT_FALSE(client.isPrepayQueries());
+
+  // When
+  client.setPrepayQueries(true);
+
+  // Then
+  EXPECT_TRUE(client.isPrepayQueries());
+}
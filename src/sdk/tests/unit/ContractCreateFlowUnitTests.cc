@@ -5,10 +5,14 @@
 #include "ED25519PrivateKey.h"
 #include "FileId.h"
 #include "PublicKey.h"
+#include "exceptions/IllegalStateException.h"
 #include "impl/Utilities.h"
 
 #include <cstddef>
 #include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 using namespace Hiero;
@@ -279,3 +283,107 @@ TEST_F(ContractCreateFlowUnitTests, ResetStakedNodeIdWhenSettingStakedAccountId)
   // Then
   EXPECT_FALSE(flow.getStakedNodeId().has_value());
 }
+
+//-----
+TEST_F(ContractCreateFlowUnitTests, ExecuteDoesNotChangeBytecode)
+{
+  // Given
+  const std::vector<std::byte> bytecode(3000ULL, std::byte(0x01));
+  ContractCreateFlow flow;
+  flow.setBytecode(bytecode);
+
+  // When
+  // The Client has no operator or network, so the flow fails once it has split the bytecode and tries to create the
+  // file.
+  EXPECT_ANY_THROW(flow.execute(Client()));
+
+  // Then
+  EXPECT_EQ(flow.getBytecode(), bytecode);
+}
+
+//-----
+TEST_F(ContractCreateFlowUnitTests, BytecodeStreamCanOnlyBeExecutedOnce)
+{
+  // Given
+  std::istringstream stream(std::string(3000ULL, 'a'));
+  ContractCreateFlow flow;
+  flow.setBytecode(stream);
+  EXPECT_ANY_THROW(flow.execute(Client()));
+
+  // When / Then
+  EXPECT_THROW(flow.execute(Client()), IllegalStateException);
+}
+
+//-----
+TEST_F(ContractCreateFlowUnitTests, SettingBytecodeAgainAllowsExecutingAgain)
+{
+  // Given
+  std::istringstream stream(std::string(3000ULL, 'a'));
+  ContractCreateFlow flow;
+  flow.setBytecode(stream);
+  EXPECT_ANY_THROW(flow.execute(Client()));
+
+  // When
+  std::istringstream newStream(std::string(3000ULL, 'b'));
+  flow.setBytecode(newStream);
+
+  // Then
+  try
+  {
+    flow.execute(Client());
+  }
+  catch (const IllegalStateException&)
+  {
+    FAIL() << "A newly-set bytecode stream was taken to be read already";
+  }
+  catch (const std::exception&)
+  {
+    // The Client has no operator or network.
+  }
+
+  EXPECT_EQ(newStream.tellg(), std::streampos(2048));
+}
+
+//-----
+TEST_F(ContractCreateFlowUnitTests, SetBytecodeReplacesStreamAndFile)
+{
+  // Given
+  std::istringstream stream("bytecode");
+  ContractCreateFlow flow;
+  flow.setBytecodeFile("does/not/exist.bin");
+
+  // When
+  flow.setBytecode(stream);
+  EXPECT_ANY_THROW(flow.execute(Client()));
+  flow.setBytecode(getTestBytecode());
+
+  // Then
+  // Neither the consumed stream nor the missing file are read.
+  try
+  {
+    flow.execute(Client());
+  }
+  catch (const IllegalStateException&)
+  {
+    FAIL() << "The replaced bytecode stream was read";
+  }
+  catch (const std::invalid_argument&)
+  {
+    FAIL() << "The replaced bytecode file was read";
+  }
+  catch (const std::exception&)
+  {
+    // The Client has no operator or network.
+  }
+}
+
+//-----
+TEST_F(ContractCreateFlowUnitTests, MissingBytecodeFileThrows)
+{
+  // Given
+  ContractCreateFlow flow;
+  flow.setBytecodeFile("does/not/exist.bin");
+
+  // When / Then
+  EXPECT_THROW(flow.execute(Client()), std::invalid_argument);
+}
@@ -236,6 +236,32 @@ TEST_F(ECDSAsecp256k1PrivateKeyUnitTests, SignEmptyBytes)
   EXPECT_LE(signature.size(), ECDSAsecp256k1PrivateKey::MAX_SIGNATURE_SIZE);
 }
 
+//-----
+TEST_F(ECDSAsecp256k1PrivateKeyUnitTests, SignProducesVerifiableLowSSignature)
+{
+  // Given
+  const std::unique_ptr<ECDSAsecp256k1PrivateKey> privateKey =
+    ECDSAsecp256k1PrivateKey::fromString(getTestPrivateKeyHexString());
+  const std::vector<std::byte> bytesToSign = { std::byte(0x1), std::byte(0x2), std::byte(0x3) };
+
+  // Half the order of the secp256k1 curve. A lower-S signature's S value is never greater than this.
+  const std::vector<std::byte> halfCurveOrder =
+    internal::HexConverter::hexToBytes("7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF5D576E7357A4501DDFE92F46681B20A0");
+
+  // When
+  const std::vector<std::byte> signature = privateKey->sign(bytesToSign);
+
+  // Then
+  ASSERT_EQ(signature.size(), ECDSAsecp256k1PrivateKey::RAW_SIGNATURE_SIZE);
+  EXPECT_TRUE(privateKey->getPublicKey()->verifySignature(signature, bytesToSign));
+  EXPECT_LE(std::vector<std::byte>(signature.cbegin() + ECDSAsecp256k1PrivateKey::R_SIZE, signature.cend()),
+            halfCurveOrder);
+  EXPECT_GE(privateKey->getRecoveryId({ signature.cbegin(), signature.cbegin() + ECDSAsecp256k1PrivateKey::R_SIZE },
+                                      { signature.cbegin() + ECDSAsecp256k1PrivateKey::R_SIZE, signature.cend() },
+                                      bytesToSign),
+            0);
+}
+
 //-----
 TEST_F(ECDSAsecp256k1PrivateKeyUnitTests, ToString)
 {
@@ -7,6 +7,7 @@
 #include "impl/Utilities.h"
 
 #include <algorithm>
+#include <future>
 #include <gtest/gtest.h>
 #include <memory>
 #include <string>
@@ -195,6 +196,34 @@ TEST_F(ED25519PrivateKeyUnitTests, SignEmptyBytes)
   // Signature functionality is further tested in RFC8032 test vectors
 }
 
+//-----
+TEST_F(ED25519PrivateKeyUnitTests, SignIsDeterministicAcrossCallsCopiesAndThreads)
+{
+  // Given
+  const std::unique_ptr<ED25519PrivateKey> privateKey = ED25519PrivateKey::fromString(getTestPrivateKeyHexString());
+  const std::unique_ptr<Key> clonedPrivateKey = privateKey->clone();
+  const std::vector<std::byte> bytesToSign = { std::byte(0x1), std::byte(0x2), std::byte(0x3) };
+  const std::vector<std::byte> expectedSignature = privateKey->sign(bytesToSign);
+
+  // When
+  std::vector<std::future<std::vector<std::byte>>> signatures;
+  for (int i = 0; i < 8; ++i)
+  {
+    signatures.push_back(
+      std::async(std::launch::async, [&privateKey, &bytesToSign]() { return privateKey->sign(bytesToSign); }));
+  }
+
+  // Then
+  EXPECT_EQ(privateKey->sign(bytesToSign), expectedSignature);
+  EXPECT_EQ(dynamic_cast<const ED25519PrivateKey&>(*clonedPrivateKey).sign(bytesToSign), expectedSignature);
+  for (std::future<std::vector<std::byte>>& signature : signatures)
+  {
+    EXPECT_EQ(signature.get(), expectedSignature);
+  }
+
+  EXPECT_TRUE(privateKey->getPublicKey()->verifySignature(expectedSignature, bytesToSign));
+}
+
 //-----
 TEST_F(ED25519PrivateKeyUnitTests, ToString)
 {
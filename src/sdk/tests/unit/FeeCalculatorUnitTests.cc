@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "ExchangeRate.h"
+#include "ExchangeRates.h"
+#include "FeeCalculator.h"
+#include "FeeComponents.h"
+#include "FeeData.h"
+#include "FeeSchedule.h"
+#include "FeeSchedules.h"
+#include "TransactionFeeSchedule.h"
+#include "TransactionId.h"
+#include "TransferTransaction.h"
+#include "WrappedTransaction.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace Hiero;
+
+class FeeCalculatorUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] FeeSchedule makeSchedule(int64_t constant,
+                                         const std::chrono::system_clock::time_point& expirationTime,
+                                         int64_t serviceMin = 0LL,
+                                         int64_t nodeMax = 0LL) const
+  {
+    // Prices are in thousandths of a tinycent.
+    return FeeSchedule()
+      .addTransactionFeeSchedule(
+        TransactionFeeSchedule()
+          .setRequestType(RequestType::CRYPTO_TRANSFER)
+          .addFee(FeeData()
+                    .setNodeData(FeeComponents()
+                                   .setConstant(constant)
+                                   .setTransactionBandwidthBytes(1000LL)
+                                   .setTransactionVerification(10000LL)
+                                   .setMax(nodeMax))
+                    .setServiceData(FeeComponents().setMin(serviceMin))))
+      .setExpirationTime(expirationTime);
+  }
+
+  [[nodiscard]] inline const std::chrono::system_clock::time_point& getTestTime() const { return mTestTime; }
+  [[nodiscard]] inline const ExchangeRates& getTestExchangeRates() const { return mTestExchangeRates; }
+
+private:
+  const std::chrono::system_clock::time_point mTestTime = std::chrono::system_clock::now();
+  const ExchangeRates mTestExchangeRates = ExchangeRates(ExchangeRate(1, 2, mTestTime + std::chrono::hours(1)),
+                                                         ExchangeRate(1, 1, mTestTime + std::chrono::hours(3)));
+};
+
+//-----
+TEST_F(FeeCalculatorUnitTests, CalculateFee)
+{
+  // Given
+  const FeeCalculator calculator(
+    FeeSchedules()
+      .setCurrent(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(1)))
+      .setNext(makeSchedule(2000000LL, getTestTime() + std::chrono::hours(2))),
+    getTestExchangeRates());
+
+  // When
+  const Hbar fee =
+    calculator.calculateFee(RequestType::CRYPTO_TRANSFER, 100ULL, 1ULL, FeeDataType::DEFAULT, getTestTime());
+
+  // Then
+  // (1000 + 100 + 10) tinycents at 1 hbar to 2 cents.
+  EXPECT_EQ(fee.toTinybars(), 555LL);
+}
+
+//-----
+TEST_F(FeeCalculatorUnitTests, CalculateFeeClampsComponents)
+{
+  // Given
+  const FeeCalculator calculator(
+    FeeSchedules()
+      .setCurrent(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(1), 5000000LL, 500000LL))
+      .setNext(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(2))),
+    getTestExchangeRates());
+
+  // When
+  const Hbar fee =
+    calculator.calculateFee(RequestType::CRYPTO_TRANSFER, 100ULL, 1ULL, FeeDataType::DEFAULT, getTestTime());
+
+  // Then
+  // (500 node + 5000 service) tinycents at 1 hbar to 2 cents.
+  EXPECT_EQ(fee.toTinybars(), 2750LL);
+}
+
+//-----
+TEST_F(FeeCalculatorUnitTests, CalculateFeeAfterExpiration)
+{
+  // Given
+  const FeeCalculator calculator(
+    FeeSchedules()
+      .setCurrent(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(1)))
+      .setNext(makeSchedule(2000000LL, getTestTime() + std::chrono::hours(2))),
+    getTestExchangeRates());
+
+  // When
+  const Hbar fee = calculator.calculateFee(
+    RequestType::CRYPTO_TRANSFER, 100ULL, 1ULL, FeeDataType::DEFAULT, getTestTime() + std::chrono::minutes(90));
+
+  // Then
+  // (2000 + 100 + 10) tinycents at 1 hbar to 1 cent.
+  EXPECT_EQ(fee.toTinybars(), 2110LL);
+  EXPECT_FALSE(calculator.isExpired(getTestTime() + std::chrono::minutes(90)));
+  EXPECT_TRUE(calculator.isExpired(getTestTime() + std::chrono::hours(2)));
+}
+
+//-----
+TEST_F(FeeCalculatorUnitTests, CalculateFeeFallsBackToDefaultSubType)
+{
+  // Given
+  const FeeCalculator calculator(
+    FeeSchedules()
+      .setCurrent(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(1)))
+      .setNext(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(2))),
+    getTestExchangeRates());
+
+  // When / Then
+  EXPECT_EQ(calculator
+              .calculateFee(
+                RequestType::CRYPTO_TRANSFER, 100ULL, 1ULL, FeeDataType::TOKEN_FUNGIBLE_COMMON, getTestTime())
+              .toTinybars(),
+            555LL);
+  EXPECT_THROW(calculator.calculateFee(RequestType::TOKEN_MINT, 100ULL, 1ULL, FeeDataType::DEFAULT, getTestTime()),
+               std::invalid_argument);
+}
+
+//-----
+TEST_F(FeeCalculatorUnitTests, CalculateFeeOfTransaction)
+{
+  // Given
+  const FeeCalculator calculator(
+    FeeSchedules()
+      .setCurrent(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(1)))
+      .setNext(makeSchedule(1000000LL, getTestTime() + std::chrono::hours(2))),
+    getTestExchangeRates());
+
+  TransferTransaction transaction;
+  transaction.setNodeAccountIds({ AccountId(3ULL) })
+    .setTransactionId(TransactionId::generate(AccountId(2ULL)))
+    .addHbarTransfer(AccountId(2ULL), Hbar(-1LL))
+    .addHbarTransfer(AccountId(4ULL), Hbar(1LL))
+    .freeze();
+
+  // When
+  const Hbar fee = calculator.calculateFee(WrappedTransaction(transaction), getTestTime());
+
+  // Then
+  // More than the constant and one signature alone, as the transaction's bytes are priced too.
+  EXPECT_GT(fee.toTinybars(), 505LL);
+}
@@ -4,12 +4,25 @@
 #include "FeeEstimateMode.h"
 #include "FeeEstimateQuery.h"
 #include "FeeEstimateResponse.h"
+#include "TransactionId.h"
 #include "TransferTransaction.h"
 #include "WrappedTransaction.h"
 
 #include <gtest/gtest.h>
+#include <httplib.h>
 #include <nlohmann/json.hpp>
+#include <services/consensus_submit_message.pb.h>
+#include <services/transaction.pb.h>
+#include <services/transaction_contents.pb.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 using namespace Hiero;
 
@@ -29,6 +42,81 @@ WrappedTransaction makeTransferTransaction()
   tx.addHbarTransfer(AccountId(0, 0, 2ULL), Hbar(1));
   return WrappedTransaction(WrappedTransaction::AnyPossibleTransaction(tx));
 }
+
+WrappedTransaction makeFrozenTransferTransaction(const TransactionId& transactionId,
+                                                 const AccountId& nodeAccountId,
+                                                 std::string_view memo,
+                                                 int64_t amount = 1LL)
+{
+  TransferTransaction tx;
+  tx.addHbarTransfer(AccountId(0, 0, 1ULL), Hbar(-amount));
+  tx.addHbarTransfer(AccountId(0, 0, 2ULL), Hbar(amount));
+  tx.setTransactionId(transactionId).setNodeAccountIds({ nodeAccountId }).setTransactionMemo(std::string(memo));
+  tx.freeze();
+  return WrappedTransaction(WrappedTransaction::AnyPossibleTransaction(tx));
+}
+
+proto::Transaction makeTopicMessageChunk(const TransactionId& initialTransactionId, int32_t number)
+{
+  proto::TransactionBody body;
+  body.set_allocated_transactionid(TransactionId::generate(AccountId(2ULL)).toProtobuf().release());
+  proto::ConsensusSubmitMessageTransactionBody* submit = body.mutable_consensussubmitmessage();
+  submit->set_message("chunk");
+  submit->mutable_chunkinfo()->set_allocated_initialtransactionid(initialTransactionId.toProtobuf().release());
+  submit->mutable_chunkinfo()->set_total(2);
+  submit->mutable_chunkinfo()->set_number(number);
+
+  proto::SignedTransaction signedTx;
+  signedTx.set_bodybytes(body.SerializeAsString());
+  proto::Transaction transaction;
+  transaction.set_signedtransactionbytes(signedTx.SerializeAsString());
+  return transaction;
+}
+
+// A mirror node on the port the SDK uses for local networks, answering fee estimates and counting them.
+class LocalFeeEstimateServer
+{
+public:
+  LocalFeeEstimateServer()
+  {
+    mServer.Post("/api/v1/network/fees",
+                 [this](const httplib::Request&, httplib::Response& response)
+                 {
+                   ++mRequests;
+                   response.set_content(R"({"network":{"multiplier":1,"subtotal":10},"node":{"base":10},)"
+                                        R"("service":{"base":20},"total":40})",
+                                        "application/json");
+                 });
+    mBound = mServer.bind_to_port("127.0.0.1", 8084);
+    if (mBound)
+    {
+      mThread = std::thread([this]() { mServer.listen_after_bind(); });
+      mServer.wait_until_ready();
+    }
+  }
+
+  ~LocalFeeEstimateServer()
+  {
+    if (mBound)
+    {
+      mServer.stop();
+      mThread.join();
+    }
+  }
+
+  LocalFeeEstimateServer(const LocalFeeEstimateServer&) = delete;
+  LocalFeeEstimateServer& operator=(const LocalFeeEstimateServer&) = delete;
+
+  [[nodiscard]] bool isBound() const { return mBound; }
+  [[nodiscard]] int getRequests() const { return mRequests; }
+
+private:
+  httplib::Server mServer;
+  std::thread mThread;
+  bool mBound = false;
+  std::atomic_int mRequests{ 0 };
+};
+
 } // namespace
 
 //-----
@@ -240,3 +328,131 @@ TEST(FeeEstimateQueryUnitTests, EstimateFeeOnTransactionReturnsQueryWithThatTran
   EXPECT_NE(query.getTransaction()->getTransaction<TransferTransaction>(), nullptr);
   EXPECT_EQ(query.getMode(), FeeEstimateMode::INTRINSIC);
 }
+
+//-----
+TEST(FeeEstimateQueryUnitTests, ExecuteAllWithoutTransactionsHoldsExceptions)
+{
+  Client client = makeClientWithMirror();
+  std::vector<FeeEstimateQuery> queries(2);
+
+  const std::vector<std::shared_future<FeeEstimateResponse>> responses = FeeEstimateQuery::executeAll(client, queries);
+  ASSERT_EQ(responses.size(), queries.size());
+  EXPECT_THROW(responses.at(0).get(), std::invalid_argument);
+  EXPECT_THROW(responses.at(1).get(), std::invalid_argument);
+}
+
+//-----
+TEST(FeeEstimateQueryUnitTests, ExecuteAsyncWithoutTransactionHoldsException)
+{
+  Client client = makeClientWithMirror();
+  FeeEstimateQuery query;
+
+  std::future<FeeEstimateResponse> response = query.executeAsync(client);
+  EXPECT_THROW(response.get(), std::invalid_argument);
+}
+
+//-----
+TEST(FeeEstimateQueryUnitTests, ShapeKeyIgnoresTransactionIdMemoAndNode)
+{
+  const WrappedTransaction first =
+    makeFrozenTransferTransaction(TransactionId::generate(AccountId(2ULL)), AccountId(3ULL), "first");
+  const WrappedTransaction second =
+    makeFrozenTransferTransaction(TransactionId::generate(AccountId(5ULL)), AccountId(4ULL), "second");
+  const WrappedTransaction larger =
+    makeFrozenTransferTransaction(TransactionId::generate(AccountId(2ULL)), AccountId(3ULL), "first", 2LL);
+
+  const std::string firstKey =
+    FeeEstimateQuery::makeShapeKey(*first.toProtobufTransaction(), FeeEstimateMode::INTRINSIC, 0);
+  const std::string secondKey =
+    FeeEstimateQuery::makeShapeKey(*second.toProtobufTransaction(), FeeEstimateMode::INTRINSIC, 0);
+  const std::string largerKey =
+    FeeEstimateQuery::makeShapeKey(*larger.toProtobufTransaction(), FeeEstimateMode::INTRINSIC, 0);
+  const std::string stateKey =
+    FeeEstimateQuery::makeShapeKey(*first.toProtobufTransaction(), FeeEstimateMode::STATE, 0);
+
+  EXPECT_FALSE(firstKey.empty());
+  EXPECT_EQ(firstKey, secondKey);
+  EXPECT_NE(firstKey, largerKey);
+  EXPECT_NE(firstKey, stateKey);
+}
+
+//-----
+TEST(FeeEstimateQueryUnitTests, ShapeKeyIgnoresInitialChunkTransactionId)
+{
+  const proto::Transaction firstMessage = makeTopicMessageChunk(TransactionId::generate(AccountId(2ULL)), 2);
+  const proto::Transaction secondMessage = makeTopicMessageChunk(TransactionId::generate(AccountId(5ULL)), 2);
+  const proto::Transaction otherChunk = makeTopicMessageChunk(TransactionId::generate(AccountId(2ULL)), 1);
+
+  const std::string firstKey = FeeEstimateQuery::makeShapeKey(firstMessage, FeeEstimateMode::INTRINSIC, 0);
+  const std::string secondKey = FeeEstimateQuery::makeShapeKey(secondMessage, FeeEstimateMode::INTRINSIC, 0);
+  const std::string otherChunkKey = FeeEstimateQuery::makeShapeKey(otherChunk, FeeEstimateMode::INTRINSIC, 0);
+
+  EXPECT_EQ(firstKey, secondKey);
+  EXPECT_NE(firstKey, otherChunkKey);
+}
+
+//-----
+TEST(FeeEstimateQueryUnitTests, EstimateTtlIsClampedAtHourBoundary)
+{
+  const std::chrono::system_clock::time_point hour =
+    std::chrono::floor<std::chrono::hours>(std::chrono::system_clock::now());
+
+  EXPECT_EQ(FeeEstimateQuery::getEstimateTtl(std::chrono::minutes(5), hour + std::chrono::minutes(59)),
+            std::chrono::minutes(1));
+  EXPECT_EQ(FeeEstimateQuery::getEstimateTtl(std::chrono::minutes(5), hour + std::chrono::minutes(10)),
+            std::chrono::minutes(5));
+  EXPECT_EQ(FeeEstimateQuery::getEstimateTtl(std::chrono::hours(2), hour), std::chrono::hours(1));
+}
+
+//-----
+TEST(FeeEstimateQueryUnitTests, CachedEstimateIsNotRequestedAgain)
+{
+  LocalFeeEstimateServer server;
+  if (!server.isBound())
+  {
+    GTEST_SKIP() << "The local mirror node port is in use";
+  }
+
+  Client client = makeClientWithMirror();
+  client.setFeeEstimateCacheTtl(std::chrono::minutes(1));
+  FeeEstimateQuery first;
+  first.setTransaction(makeFrozenTransferTransaction(TransactionId::generate(AccountId(2ULL)), AccountId(3ULL), "a"));
+  FeeEstimateQuery second;
+  second.setTransaction(makeFrozenTransferTransaction(TransactionId::generate(AccountId(2ULL)), AccountId(4ULL), "b"));
+
+  const FeeEstimateResponse firstResponse = first.execute(client);
+  const FeeEstimateResponse secondResponse = second.execute(client);
+
+  EXPECT_EQ(server.getRequests(), 1);
+  EXPECT_EQ(firstResponse.mTotal, 40ULL);
+  EXPECT_EQ(secondResponse.mTotal, 40ULL);
+}
+
+//-----
+TEST(FeeEstimateQueryUnitTests, ExecuteAllSendsEachShapeOnce)
+{
+  LocalFeeEstimateServer server;
+  if (!server.isBound())
+  {
+    GTEST_SKIP() << "The local mirror node port is in use";
+  }
+
+  Client client = makeClientWithMirror();
+  std::vector<FeeEstimateQuery> queries(3);
+  queries.at(0).setTransaction(
+    makeFrozenTransferTransaction(TransactionId::generate(AccountId(2ULL)), AccountId(3ULL), "a"));
+  queries.at(1).setTransaction(
+    makeFrozenTransferTransaction(TransactionId::generate(AccountId(2ULL)), AccountId(4ULL), "b"));
+  queries.at(2).setTransaction(
+    makeFrozenTransferTransaction(TransactionId::generate(AccountId(2ULL)), AccountId(3ULL), "a", 2LL));
+
+  const std::vector<std::shared_future<FeeEstimateResponse>> responses = FeeEstimateQuery::executeAll(client, queries);
+
+  ASSERT_EQ(responses.size(), 3ULL);
+  for (const std::shared_future<FeeEstimateResponse>& response : responses)
+  {
+    EXPECT_EQ(response.get().mTotal, 40ULL);
+  }
+
+  EXPECT_EQ(server.getRequests(), 2);
+}
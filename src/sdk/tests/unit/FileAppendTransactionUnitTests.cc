@@ -2,6 +2,7 @@
 #include "Client.h"
 #include "ED25519PrivateKey.h"
 #include "FileAppendTransaction.h"
+#include "WrappedTransaction.h"
 #include "exceptions/IllegalStateException.h"
 #include "impl/Utilities.h"
 
@@ -10,7 +11,10 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <services/transaction.pb.h>
+#include <services/transaction_contents.pb.h>
+#include <sstream>
 #include <string>
+#include <transaction_list.pb.h>
 #include <vector>
 
 using namespace Hiero;
@@ -87,6 +91,39 @@ TEST_F(FileAppendTransactionUnitTests, GetSetContents)
   EXPECT_EQ(transactionStr.getContents(), getTestContents());
 }
 
+//-----
+TEST_F(FileAppendTransactionUnitTests, GetSetSharedContents)
+{
+  // Given
+  const auto contents = std::make_shared<const std::vector<std::byte>>(getTestContents());
+  FileAppendTransaction transaction;
+
+  // When
+  transaction.setContents(contents);
+  const FileAppendTransaction copy = transaction;
+
+  // Then
+  EXPECT_EQ(transaction.getContents(), getTestContents());
+  EXPECT_EQ(copy.getContents(), getTestContents());
+  EXPECT_NO_THROW(transaction.setContents(std::shared_ptr<const std::vector<std::byte>>()));
+  EXPECT_TRUE(transaction.getContents().empty());
+}
+
+//-----
+TEST_F(FileAppendTransactionUnitTests, SetContentsFromStream)
+{
+  // Given
+  const std::vector<std::byte> largeContents(200000ULL, std::byte(0x5A));
+  std::istringstream stream(internal::Utilities::byteVectorToString(largeContents));
+  FileAppendTransaction transaction;
+
+  // When
+  transaction.setContents(stream);
+
+  // Then
+  EXPECT_EQ(transaction.getContents(), largeContents);
+}
+
 //-----
 TEST_F(FileAppendTransactionUnitTests, GetSetContentsFrozen)
 {
@@ -101,3 +138,38 @@ TEST_F(FileAppendTransactionUnitTests, GetSetContentsFrozen)
   EXPECT_THROW(transaction.setContents(internal::Utilities::byteVectorToString(getTestContents())),
                IllegalStateException);
 }
+
+//-----
+TEST_F(FileAppendTransactionUnitTests, FrozenChunksHoldOnlyTheirContents)
+{
+  // Given
+  FileAppendTransaction transaction = FileAppendTransaction()
+                                        .setFileId(getTestFileId())
+                                        .setContents("abcdef")
+                                        .setChunkSize(2U)
+                                        .setNodeAccountIds({ AccountId(1ULL) })
+                                        .setTransactionId(TransactionId::generate(AccountId(1ULL)));
+
+  // When
+  ASSERT_NO_THROW(transaction.freeze());
+
+  // Then
+  const std::vector<std::byte> bytes = transaction.toBytes();
+  proto::TransactionList transactions;
+  ASSERT_TRUE(transactions.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())));
+  ASSERT_EQ(transactions.transaction_list_size(), 3);
+
+  const std::vector<std::string> chunks = { "ab", "cd", "ef" };
+  for (int i = 0; i < transactions.transaction_list_size(); ++i)
+  {
+    proto::SignedTransaction signedTx;
+    proto::TransactionBody body;
+    ASSERT_TRUE(signedTx.ParseFromString(transactions.transaction_list(i).signedtransactionbytes()));
+    ASSERT_TRUE(body.ParseFromString(signedTx.bodybytes()));
+    EXPECT_EQ(body.fileappend().contents(), chunks.at(i));
+    EXPECT_EQ(FileId::fromProtobuf(body.fileappend().fileid()), getTestFileId());
+    EXPECT_TRUE(body.has_transactionid());
+  }
+
+  EXPECT_EQ(WrappedTransaction(transaction).toProtobuf()->fileappend().contents(), "abcdef");
+}
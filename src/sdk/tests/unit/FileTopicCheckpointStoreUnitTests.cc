@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "FileTopicCheckpointStore.h"
+#include "TopicId.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace Hiero;
+
+class FileTopicCheckpointStoreUnitTests : public ::testing::Test
+{
+protected:
+  void TearDown() override { std::remove(mTestPath.c_str()); }
+
+  [[nodiscard]] inline const std::string& getTestPath() const { return mTestPath; }
+  [[nodiscard]] inline const TopicId& getTestTopicId() const { return mTestTopicId; }
+  [[nodiscard]] inline const std::chrono::system_clock::time_point& getTestCheckpoint() const
+  {
+    return mTestCheckpoint;
+  }
+
+private:
+  const std::string mTestPath =
+    (std::filesystem::temp_directory_path() / "FileTopicCheckpointStoreUnitTests.checkpoints").string();
+  const TopicId mTestTopicId = TopicId(1ULL, 2ULL, 3ULL);
+  const std::chrono::system_clock::time_point mTestCheckpoint = std::chrono::system_clock::now();
+};
+
+//-----
+TEST_F(FileTopicCheckpointStoreUnitTests, LoadUnknownTopic)
+{
+  // Given
+  FileTopicCheckpointStore store(getTestPath());
+
+  // When / Then
+  EXPECT_FALSE(store.load(getTestTopicId()).has_value());
+}
+
+//-----
+TEST_F(FileTopicCheckpointStoreUnitTests, SaveAndLoad)
+{
+  // Given
+  FileTopicCheckpointStore store(getTestPath());
+
+  // When
+  store.save(getTestTopicId(), getTestCheckpoint());
+
+  // Then
+  ASSERT_TRUE(store.load(getTestTopicId()).has_value());
+  EXPECT_EQ(*store.load(getTestTopicId()), getTestCheckpoint());
+}
+
+//-----
+TEST_F(FileTopicCheckpointStoreUnitTests, FlushedCheckpointsAreReloaded)
+{
+  // Given
+  FileTopicCheckpointStore store(getTestPath());
+  store.save(getTestTopicId(), getTestCheckpoint());
+
+  // When
+  store.flush();
+
+  // Then
+  FileTopicCheckpointStore reloaded(getTestPath());
+  ASSERT_TRUE(reloaded.load(getTestTopicId()).has_value());
+  EXPECT_EQ(*reloaded.load(getTestTopicId()), getTestCheckpoint());
+}
+
+//-----
+TEST_F(FileTopicCheckpointStoreUnitTests, UnflushedCheckpointsAreNotWritten)
+{
+  // Given
+  FileTopicCheckpointStore store(getTestPath());
+
+  // When
+  store.save(getTestTopicId(), getTestCheckpoint());
+
+  // Then
+  EXPECT_FALSE(FileTopicCheckpointStore(getTestPath()).load(getTestTopicId()).has_value());
+}
+
+//-----
+TEST_F(FileTopicCheckpointStoreUnitTests, MalformedFileThrows)
+{
+  // Given
+  std::ofstream(getTestPath()) << "0.0.3 not-a-timestamp\n";
+
+  // When / Then
+  EXPECT_THROW(FileTopicCheckpointStore store(getTestPath()), std::invalid_argument);
+}
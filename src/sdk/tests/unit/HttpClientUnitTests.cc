@@ -0,0 +1,337 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/HttpClient.h"
+
+#include <gtest/gtest.h>
+#include <httplib.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class HttpClientUnitTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    mSettings = HttpClient::getConnectionPoolSettings();
+    HttpClient::closeIdleConnections();
+
+    mServer.set_keep_alive_max_count(100);
+    mServer.Get("/port",
+                [this](const httplib::Request& request, httplib::Response& response)
+                {
+                  std::unique_lock lock(mMutex);
+                  mRemotePorts.push_back(request.remote_port);
+                  response.set_content(std::to_string(request.remote_port), "text/plain");
+                });
+    mServer.Get("/slow",
+                [this](const httplib::Request&, httplib::Response& response)
+                {
+                  const int running = ++mRunning;
+                  int maxRunning = mMaxRunning;
+                  while (running > maxRunning && !mMaxRunning.compare_exchange_weak(maxRunning, running))
+                  {
+                  }
+
+                  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                  --mRunning;
+                  response.set_content("done", "text/plain");
+                });
+    mServer.Get("/text",
+                [this](const httplib::Request& request, httplib::Response& response)
+                {
+                  recordEncoding(request.get_header_value("Accept-Encoding"));
+                  response.set_content(getLargeText(), "text/plain");
+                });
+    mServer.Post("/echo",
+                 [this](const httplib::Request& request, httplib::Response& response)
+                 {
+                   recordEncoding(request.get_header_value("Content-Encoding"));
+                   response.set_content(request.body, "text/plain");
+                 });
+    mServer.Post("/identity-only",
+                 [this](const httplib::Request& request, httplib::Response& response)
+                 {
+                   recordEncoding(request.get_header_value("Content-Encoding"));
+                   if (request.has_header("Content-Encoding"))
+                   {
+                     response.status = 415;
+                     return;
+                   }
+
+                   response.set_content(request.body, "text/plain");
+                 });
+
+    mPort = mServer.bind_to_any_port("127.0.0.1");
+    mServerThread = std::thread([this]() { mServer.listen_after_bind(); });
+    mServer.wait_until_ready();
+  }
+
+  void TearDown() override
+  {
+    mServer.stop();
+    mServerThread.join();
+    HttpClient::setConnectionPoolSettings(mSettings);
+    HttpClient::closeIdleConnections();
+  }
+
+  [[nodiscard]] std::string getUrl(const std::string& path) const
+  {
+    return "http://127.0.0.1:" + std::to_string(mPort) + path;
+  }
+
+  [[nodiscard]] std::set<int> getRemotePorts()
+  {
+    std::unique_lock lock(mMutex);
+    return { mRemotePorts.cbegin(), mRemotePorts.cend() };
+  }
+
+  [[nodiscard]] std::vector<std::string> getEncodings()
+  {
+    std::unique_lock lock(mMutex);
+    return mEncodings;
+  }
+
+  // Get a text large enough to be compressed, both by the server and by the SDK.
+  [[nodiscard]] static std::string getLargeText()
+  {
+    std::string text;
+    for (int i = 0; i < 500; ++i)
+    {
+      text += "topic message " + std::to_string(i) + '\n';
+    }
+
+    return text;
+  }
+
+  [[nodiscard]] inline int getMaxRunning() const { return mMaxRunning; }
+
+  httplib::Server mServer;
+
+private:
+  // Record the encoding header of a request the server received.
+  void recordEncoding(const std::string& encoding)
+  {
+    std::unique_lock lock(mMutex);
+    mEncodings.push_back(encoding);
+  }
+
+  HttpClient::ConnectionPoolSettings mSettings;
+  int mPort = 0;
+  std::thread mServerThread;
+  std::mutex mMutex;
+  std::vector<int> mRemotePorts;
+  std::vector<std::string> mEncodings;
+  std::atomic_int mRunning{ 0 };
+  std::atomic_int mMaxRunning{ 0 };
+};
+
+//-----
+TEST_F(HttpClientUnitTests, SetConnectionPoolSettings)
+{
+  // Given
+  HttpClient::ConnectionPoolSettings settings;
+  settings.mMaxConnectionsPerHost = 3U;
+  settings.mIdleConnectionTimeout = std::chrono::seconds(7);
+
+  // When
+  HttpClient::setConnectionPoolSettings(settings);
+
+  // Then
+  const HttpClient::ConnectionPoolSettings set = HttpClient::getConnectionPoolSettings();
+  EXPECT_EQ(set.mMaxConnectionsPerHost, 3U);
+  EXPECT_EQ(set.mIdleConnectionTimeout, std::chrono::seconds(7));
+}
+
+//-----
+TEST_F(HttpClientUnitTests, SetConnectionPoolSettingsRejectsInvalidSettings)
+{
+  // Given
+  HttpClient::ConnectionPoolSettings noConnections;
+  noConnections.mMaxConnectionsPerHost = 0U;
+  HttpClient::ConnectionPoolSettings negativeIdleTimeout;
+  negativeIdleTimeout.mIdleConnectionTimeout = std::chrono::seconds(-1);
+  HttpClient::ConnectionPoolSettings negativeReadTimeout;
+  negativeReadTimeout.mReadTimeout = std::chrono::seconds(-1);
+
+  // When / Then
+  EXPECT_THROW(HttpClient::setConnectionPoolSettings(noConnections), std::invalid_argument);
+  EXPECT_THROW(HttpClient::setConnectionPoolSettings(negativeIdleTimeout), std::invalid_argument);
+  EXPECT_THROW(HttpClient::setConnectionPoolSettings(negativeReadTimeout), std::invalid_argument);
+}
+
+//-----
+TEST_F(HttpClientUnitTests, ReusesIdleConnection)
+{
+  // Given / When
+  static_cast<void>(HttpClient::invokeREST(getUrl("/port")));
+  static_cast<void>(HttpClient::invokeREST(getUrl("/port")));
+
+  // Then
+  EXPECT_EQ(getRemotePorts().size(), 1ULL);
+  EXPECT_EQ(HttpClient::getOpenConnections(getUrl("/port")), 1U);
+}
+
+//-----
+TEST_F(HttpClientUnitTests, LimitsConnectionsPerHost)
+{
+  // Given
+  HttpClient::ConnectionPoolSettings settings;
+  settings.mMaxConnectionsPerHost = 1U;
+  HttpClient::setConnectionPoolSettings(settings);
+
+  // When
+  std::vector<std::thread> requests;
+  for (int i = 0; i < 3; ++i)
+  {
+    requests.emplace_back([this]() { static_cast<void>(HttpClient::invokeREST(getUrl("/slow"))); });
+  }
+
+  for (std::thread& request : requests)
+  {
+    request.join();
+  }
+
+  // Then
+  EXPECT_EQ(getMaxRunning(), 1);
+  EXPECT_EQ(HttpClient::getOpenConnections(getUrl("/slow")), 1U);
+}
+
+//-----
+TEST_F(HttpClientUnitTests, EvictsIdleConnectionsAfterTimeout)
+{
+  // Given
+  HttpClient::ConnectionPoolSettings settings;
+  settings.mIdleConnectionTimeout = std::chrono::milliseconds(1);
+  HttpClient::setConnectionPoolSettings(settings);
+  static_cast<void>(HttpClient::invokeREST(getUrl("/port")));
+
+  // When
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  static_cast<void>(HttpClient::invokeREST(getUrl("/port")));
+
+  // Then
+  EXPECT_EQ(getRemotePorts().size(), 2ULL);
+}
+
+//-----
+TEST_F(HttpClientUnitTests, CloseIdleConnectionsDropsHosts)
+{
+  // Given
+  static_cast<void>(HttpClient::invokeREST(getUrl("/port")));
+  ASSERT_EQ(HttpClient::getOpenConnections(getUrl("/port")), 1U);
+  ASSERT_GE(HttpClient::getConnectionPoolHostCount(), 1ULL);
+
+  // When
+  HttpClient::closeIdleConnections();
+
+  // Then
+  EXPECT_EQ(HttpClient::getOpenConnections(getUrl("/port")), 0U);
+  EXPECT_EQ(HttpClient::getConnectionPoolHostCount(), 0ULL);
+
+  static_cast<void>(HttpClient::invokeREST(getUrl("/port")));
+  EXPECT_EQ(getRemotePorts().size(), 2ULL);
+}
+
+//-----
+TEST_F(HttpClientUnitTests, FailedRequestDropsHost)
+{
+  // Given
+  const size_t hosts = HttpClient::getConnectionPoolHostCount();
+  mServer.stop();
+
+  // When
+  EXPECT_THROW(static_cast<void>(HttpClient::invokeREST(getUrl("/port"))), std::runtime_error);
+
+  // Then
+  EXPECT_EQ(HttpClient::getOpenConnections(getUrl("/port")), 0U);
+  EXPECT_EQ(HttpClient::getConnectionPoolHostCount(), hosts);
+}
+
+//-----
+TEST_F(HttpClientUnitTests, DecodesGzipResponse)
+{
+  // Given
+  int statusCode = -1;
+  bool isTimeout = false;
+  httplib::Headers responseHeaders;
+
+  // When
+  const std::string body = HttpClient::invokeRESTWithHeaders(
+    getUrl("/text"), "GET", "", "text/plain", {}, responseHeaders, statusCode, isTimeout, true);
+
+  // Then
+  EXPECT_EQ(statusCode, 200);
+  EXPECT_EQ(body, getLargeText());
+  ASSERT_EQ(getEncodings().size(), 1ULL);
+  EXPECT_NE(getEncodings().front().find("gzip"), std::string::npos);
+
+  const auto contentEncoding = responseHeaders.find("Content-Encoding");
+  ASSERT_NE(contentEncoding, responseHeaders.cend());
+  EXPECT_EQ(contentEncoding->second, "gzip");
+}
+
+//-----
+TEST_F(HttpClientUnitTests, RequestsUnencodedResponseWithoutCompression)
+{
+  // Given
+  int statusCode = -1;
+  bool isTimeout = false;
+
+  // When
+  const std::string body =
+    HttpClient::invokeRESTWithStatus(getUrl("/text"), "GET", "", "text/plain", statusCode, isTimeout);
+
+  // Then
+  EXPECT_EQ(body, getLargeText());
+  EXPECT_EQ(getEncodings(), (std::vector<std::string>{ "identity" }));
+}
+
+//-----
+TEST_F(HttpClientUnitTests, SendsLargePostBodyGzipEncoded)
+{
+  // Given
+  int statusCode = -1;
+  bool isTimeout = false;
+
+  // When
+  const std::string body = HttpClient::invokeRESTWithStatus(
+    getUrl("/echo"), "POST", getLargeText(), "text/plain", statusCode, isTimeout, true);
+  const std::string smallBody =
+    HttpClient::invokeRESTWithStatus(getUrl("/echo"), "POST", "small", "text/plain", statusCode, isTimeout, true);
+
+  // Then
+  EXPECT_EQ(body, getLargeText());
+  EXPECT_EQ(smallBody, "small");
+  EXPECT_EQ(getEncodings(), (std::vector<std::string>{ "gzip", "" }));
+}
+
+//-----
+TEST_F(HttpClientUnitTests, FallsBackToUnencodedBodyAfterUnsupportedMediaType)
+{
+  // Given
+  int statusCode = -1;
+  bool isTimeout = false;
+
+  // When
+  const std::string first = HttpClient::invokeRESTWithStatus(
+    getUrl("/identity-only"), "POST", getLargeText(), "text/plain", statusCode, isTimeout, true);
+  const int firstStatusCode = statusCode;
+  const std::string second = HttpClient::invokeRESTWithStatus(
+    getUrl("/identity-only"), "POST", getLargeText(), "text/plain", statusCode, isTimeout, true);
+
+  // Then
+  EXPECT_EQ(firstStatusCode, 200);
+  EXPECT_EQ(statusCode, 200);
+  EXPECT_EQ(first, getLargeText());
+  EXPECT_EQ(second, getLargeText());
+  EXPECT_EQ(getEncodings(), (std::vector<std::string>{ "gzip", "", "" }));
+}
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "exceptions/IllegalStateException.h"
+#include "impl/HttpExecutor.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class HttpExecutorUnitTests : public ::testing::Test
+{
+};
+
+//-----
+TEST_F(HttpExecutorUnitTests, SubmitReturnsResult)
+{
+  // Given
+  HttpExecutor executor(2U, 1U);
+
+  // When
+  std::future<int> result = executor.submit("https://host:443", []() { return 7; });
+
+  // Then
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_EQ(result.get(), 7);
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, SubmitForwardsException)
+{
+  // Given
+  HttpExecutor executor(1U, 1U);
+
+  // When
+  std::future<int> result = executor.submit("", []() -> int { throw std::runtime_error("failed"); });
+
+  // Then
+  EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, LimitsTasksPerHost)
+{
+  // Given
+  HttpExecutor executor(4U, 2U);
+  std::atomic<unsigned int> running{ 0U };
+  std::atomic<unsigned int> maxRunning{ 0U };
+
+  // When
+  std::vector<std::future<void>> results;
+  for (int i = 0; i < 8; ++i)
+  {
+    results.push_back(executor.submit("https://host:443",
+                                      [&running, &maxRunning]()
+                                      {
+                                        const unsigned int now = ++running;
+                                        unsigned int max = maxRunning.load();
+                                        while (now > max && !maxRunning.compare_exchange_weak(max, now))
+                                        {
+                                        }
+
+                                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                                        --running;
+                                      }));
+  }
+
+  for (std::future<void>& result : results)
+  {
+    result.get();
+  }
+
+  // Then
+  EXPECT_LE(maxRunning, 2U);
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, HostAtLimitDoesNotBlockOtherHosts)
+{
+  // Given
+  HttpExecutor executor(2U, 1U);
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::future<void> blocking = executor.submit("https://busy:443", [released]() { released.wait(); });
+  std::future<void> queued = executor.submit("https://busy:443", []() {});
+
+  // When
+  std::future<int> other = executor.submit("https://other:443", []() { return 1; });
+
+  // Then
+  EXPECT_EQ(other.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_EQ(queued.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+
+  release.set_value();
+  EXPECT_EQ(queued.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, ShutdownRunsPostedTasks)
+{
+  // Given
+  HttpExecutor executor(1U, 1U);
+  std::atomic<int> ran{ 0 };
+  for (int i = 0; i < 4; ++i)
+  {
+    executor.post("https://host:443", [&ran]() { ++ran; });
+  }
+
+  // When
+  executor.shutdown();
+
+  // Then
+  EXPECT_EQ(ran, 4);
+  EXPECT_THROW(executor.post("", []() {}), IllegalStateException);
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, GetHost)
+{
+  // Given / When
+  const std::string host = HttpExecutor::getHost("https://testnet.mirrornode.hedera.com:443/api/v1/accounts/0.0.2");
+
+  // Then
+  EXPECT_EQ(host, "testnet.mirrornode.hedera.com");
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, GetHostMatchesUrlsAndAddresses)
+{
+  // Given / When / Then
+  EXPECT_EQ(HttpExecutor::getHost("testnet.mirrornode.hedera.com:443"), "testnet.mirrornode.hedera.com");
+  EXPECT_EQ(HttpExecutor::getHost("http://Testnet.MirrorNode.hedera.com:5551/api/v1/network/fees?mode=STATE"),
+            "testnet.mirrornode.hedera.com");
+  EXPECT_EQ(HttpExecutor::getHost("127.0.0.1:5600"), HttpExecutor::getHost("http://127.0.0.1:8084/api/v1"));
+  EXPECT_EQ(HttpExecutor::getHost("https://[::1]:443/api/v1"), "[::1]");
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, DefaultPerHostLimitIsBelowThreadCount)
+{
+  // Given / When / Then
+  EXPECT_LT(DEFAULT_HTTP_EXECUTOR_MAX_TASKS_PER_HOST, DEFAULT_HTTP_EXECUTOR_THREADS);
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, PostAfterWaitsForDeadline)
+{
+  // Given
+  HttpExecutor executor(1U, 1U);
+  std::promise<std::chrono::steady_clock::time_point> ran;
+  const std::chrono::steady_clock::time_point posted = std::chrono::steady_clock::now();
+
+  // When
+  executor.postAfter("host",
+                     std::chrono::system_clock::now() + std::chrono::milliseconds(100),
+                     [&ran]() { ran.set_value(std::chrono::steady_clock::now()); });
+  std::future<void> other = executor.submit("host", []() {});
+
+  // Then
+  EXPECT_EQ(other.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  std::future<std::chrono::steady_clock::time_point> ranAt = ran.get_future();
+  ASSERT_EQ(ranAt.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_GE(ranAt.get() - posted, std::chrono::milliseconds(100));
+}
+
+//-----
+TEST_F(HttpExecutorUnitTests, PostAfterRunsTaskOnShutdown)
+{
+  // Given
+  HttpExecutor executor(1U, 1U);
+  std::atomic_bool ran{ false };
+  executor.postAfter("host", std::chrono::system_clock::now() + std::chrono::hours(1), [&ran]() { ran = true; });
+
+  // When
+  executor.shutdown();
+
+  // Then
+  EXPECT_TRUE(ran);
+  EXPECT_THROW(executor.postAfter("host", std::chrono::system_clock::now(), []() {}), IllegalStateException);
+}
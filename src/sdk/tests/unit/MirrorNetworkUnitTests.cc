@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/MirrorNetwork.h"
+#include "impl/MirrorNode.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class MirrorNetworkUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] std::shared_ptr<MirrorNode> getNode(const std::vector<std::shared_ptr<MirrorNode>>& nodes,
+                                                    std::string_view address) const
+  {
+    for (const std::shared_ptr<MirrorNode>& node : nodes)
+    {
+      if (node->getAddress().toString() == address)
+      {
+        return node;
+      }
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] inline const std::vector<std::string>& getTestAddresses() const { return mTestAddresses; }
+
+private:
+  const std::vector<std::string> mTestAddresses = { "10.0.0.1:5600", "10.0.0.2:5600", "10.0.0.3:5600" };
+};
+
+//-----
+TEST_F(MirrorNetworkUnitTests, FailedMirrorNodeIsTriedLast)
+{
+  // Given
+  MirrorNetwork network = MirrorNetwork::forNetwork(getTestAddresses());
+  const std::shared_ptr<MirrorNode> failed = getNode(network.getMirrorNodesByHealth(), getTestAddresses().front());
+  ASSERT_NE(failed, nullptr);
+
+  // When
+  network.recordFailure(failed);
+
+  // Then
+  EXPECT_EQ(network.getMirrorNodesByHealth().back(), failed);
+  EXPECT_EQ(network.getMirrorNodesByLoad().back(), failed);
+  EXPECT_NE(network.getNextMirrorNode(), failed);
+}
+
+//-----
+TEST_F(MirrorNetworkUnitTests, FasterMirrorNodeIsTriedFirst)
+{
+  // Given
+  MirrorNetwork network = MirrorNetwork::forNetwork(getTestAddresses());
+  const std::vector<std::shared_ptr<MirrorNode>> nodes = network.getMirrorNodesByHealth();
+  const std::shared_ptr<MirrorNode> fast = getNode(nodes, getTestAddresses().at(0));
+  const std::shared_ptr<MirrorNode> medium = getNode(nodes, getTestAddresses().at(1));
+  const std::shared_ptr<MirrorNode> slow = getNode(nodes, getTestAddresses().at(2));
+
+  // When
+  network.recordSuccess(slow, std::chrono::milliseconds(300));
+  network.recordSuccess(fast, std::chrono::milliseconds(10));
+  network.recordSuccess(medium, std::chrono::milliseconds(100));
+
+  // Then
+  EXPECT_EQ(network.getMirrorNodesByHealth(), (std::vector<std::shared_ptr<MirrorNode>>{ fast, medium, slow }));
+}
+
+//-----
+TEST_F(MirrorNetworkUnitTests, MirrorNodeWithoutLatencyIsTriedFirst)
+{
+  // Given
+  MirrorNetwork network = MirrorNetwork::forNetwork({ getTestAddresses().at(0), getTestAddresses().at(1) });
+  const std::vector<std::shared_ptr<MirrorNode>> nodes = network.getMirrorNodesByHealth();
+  const std::shared_ptr<MirrorNode> measured = getNode(nodes, getTestAddresses().at(0));
+  const std::shared_ptr<MirrorNode> unmeasured = getNode(nodes, getTestAddresses().at(1));
+
+  // When
+  network.recordSuccess(measured, std::chrono::milliseconds(10));
+
+  // Then
+  EXPECT_EQ(network.getNextMirrorNode(), unmeasured);
+}
+
+//-----
+TEST_F(MirrorNetworkUnitTests, LatencyIsSmoothed)
+{
+  // Given
+  MirrorNode node("10.0.0.1:5600");
+
+  // When
+  node.recordLatency(std::chrono::milliseconds(100));
+  node.recordLatency(std::chrono::milliseconds(500));
+
+  // Then
+  EXPECT_EQ(node.getLatency(), std::chrono::milliseconds(200));
+}
@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Client.h"
+#include "exceptions/IllegalStateException.h"
+#include "impl/MirrorNode.h"
+#include "impl/MirrorNodeContractCallEngine.h"
+#include "impl/MirrorNodeContractCallQuery.h"
+
+#include <gtest/gtest.h>
+#include <httplib.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+namespace
+{
+// A mirror node answering contract calls on the port to which the SDK sends the calls of the local mirror node. Each
+// call takes a moment, so that identical calls overlap.
+class LocalContractCallServer
+{
+public:
+  LocalContractCallServer()
+  {
+    mServer.Post("/api/v1/contracts/call",
+                 [this](const httplib::Request&, httplib::Response& response)
+                 {
+                   ++mRequests;
+                   std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                   response.set_content(R"({"result":"0x1234"})", "application/json");
+                 });
+    mBound = mServer.bind_to_port("127.0.0.1", 8545);
+    if (mBound)
+    {
+      mThread = std::thread([this]() { mServer.listen_after_bind(); });
+      mServer.wait_until_ready();
+    }
+  }
+
+  ~LocalContractCallServer()
+  {
+    if (mBound)
+    {
+      mServer.stop();
+      mThread.join();
+    }
+  }
+
+  LocalContractCallServer(const LocalContractCallServer&) = delete;
+  LocalContractCallServer& operator=(const LocalContractCallServer&) = delete;
+
+  [[nodiscard]] bool isBound() const { return mBound; }
+  [[nodiscard]] int getRequests() const { return mRequests; }
+
+private:
+  httplib::Server mServer;
+  std::thread mThread;
+  bool mBound = false;
+  std::atomic_int mRequests{ 0 };
+};
+
+} // anonymous namespace
+
+class MirrorNodeContractCallEngineUnitTests : public ::testing::Test
+{
+protected:
+  // Make a Client whose mirror network is the local mirror node.
+  [[nodiscard]] static Client makeClientWithMirror()
+  {
+    Client client = Client::forNetwork({});
+    client.setMirrorNetwork({ "127.0.0.1:5600" });
+    return client;
+  }
+
+  [[nodiscard]] inline const std::string& getTestContractEvmAddress() const { return mTestContractEvmAddress; }
+
+private:
+  const std::string mTestContractEvmAddress = "0x0000000000000000000000000000000000000001";
+};
+
+//-----
+TEST_F(MirrorNodeContractCallEngineUnitTests, ConstructWithoutCache)
+{
+  // Given
+  const Client client;
+
+  // When / Then
+  EXPECT_THROW(MirrorNodeContractCallEngine(client, 0ULL), std::invalid_argument);
+}
+
+//-----
+TEST_F(MirrorNodeContractCallEngineUnitTests, SubmitWithoutMirrorNodes)
+{
+  // Given
+  const Client client = Client::forNetwork({});
+  MirrorNodeContractCallEngine engine(client);
+  MirrorNodeContractCallQuery query;
+  query.setContractEvmAddress(getTestContractEvmAddress()).setBlockNumber(1ULL);
+
+  // When / Then
+  EXPECT_THROW(static_cast<void>(engine.submit(query)), IllegalStateException);
+
+  const MirrorNodeContractCallEngine::Statistics statistics = engine.getStatistics();
+  EXPECT_EQ(statistics.mSentCalls, 0ULL);
+  EXPECT_EQ(statistics.mCollapsedCalls, 0ULL);
+  EXPECT_EQ(statistics.mCachedCalls, 0ULL);
+}
+
+//-----
+TEST_F(MirrorNodeContractCallEngineUnitTests, IdenticalCallsInFlightAreSentOnce)
+{
+  // Given
+  LocalContractCallServer server;
+  if (!server.isBound())
+  {
+    GTEST_SKIP() << "The local mirror node contract call port is in use";
+  }
+
+  const Client client = makeClientWithMirror();
+  MirrorNodeContractCallEngine engine(client);
+  auto query = std::make_shared<MirrorNodeContractCallQuery>();
+  query->setContractEvmAddress(getTestContractEvmAddress());
+
+  // When
+  const std::vector<std::shared_future<std::string>> results = engine.submitAll({ query, query });
+
+  // Then
+  ASSERT_EQ(results.size(), 2ULL);
+  EXPECT_EQ(results.at(0).get(), "1234");
+  EXPECT_EQ(results.at(1).get(), "1234");
+  EXPECT_EQ(server.getRequests(), 1);
+
+  const MirrorNodeContractCallEngine::Statistics statistics = engine.getStatistics();
+  EXPECT_EQ(statistics.mSentCalls, 1ULL);
+  EXPECT_EQ(statistics.mCollapsedCalls, 1ULL);
+  EXPECT_EQ(statistics.mCachedCalls, 0ULL);
+}
+
+//-----
+TEST_F(MirrorNodeContractCallEngineUnitTests, BlockPinnedResultIsCached)
+{
+  // Given
+  LocalContractCallServer server;
+  if (!server.isBound())
+  {
+    GTEST_SKIP() << "The local mirror node contract call port is in use";
+  }
+
+  const Client client = makeClientWithMirror();
+  MirrorNodeContractCallEngine engine(client);
+  MirrorNodeContractCallQuery pinned;
+  pinned.setContractEvmAddress(getTestContractEvmAddress()).setBlockNumber(1ULL);
+  ASSERT_EQ(engine.submit(pinned).get(), "1234");
+
+  // When
+  const std::string result = engine.submit(pinned).get();
+
+  // Then
+  EXPECT_EQ(result, "1234");
+  EXPECT_EQ(server.getRequests(), 1);
+
+  const MirrorNodeContractCallEngine::Statistics statistics = engine.getStatistics();
+  EXPECT_EQ(statistics.mSentCalls, 1ULL);
+  EXPECT_EQ(statistics.mCachedCalls, 1ULL);
+}
+
+//-----
+TEST_F(MirrorNodeContractCallEngineUnitTests, LatestBlockResultIsNotCached)
+{
+  // Given
+  LocalContractCallServer server;
+  if (!server.isBound())
+  {
+    GTEST_SKIP() << "The local mirror node contract call port is in use";
+  }
+
+  const Client client = makeClientWithMirror();
+  MirrorNodeContractCallEngine engine(client);
+  MirrorNodeContractCallQuery latest;
+  latest.setContractEvmAddress(getTestContractEvmAddress());
+  ASSERT_EQ(engine.submit(latest).get(), "1234");
+
+  // When
+  const std::string result = engine.submit(latest).get();
+
+  // Then
+  EXPECT_EQ(result, "1234");
+  EXPECT_EQ(server.getRequests(), 2);
+
+  const MirrorNodeContractCallEngine::Statistics statistics = engine.getStatistics();
+  EXPECT_EQ(statistics.mSentCalls, 2ULL);
+  EXPECT_EQ(statistics.mCachedCalls, 0ULL);
+}
+
+//-----
+TEST_F(MirrorNodeContractCallEngineUnitTests, RotateHealthyNodes)
+{
+  // Given
+  const auto first = std::make_shared<MirrorNode>("127.0.0.1:5600");
+  const auto second = std::make_shared<MirrorNode>("127.0.0.1:5601");
+  const auto third = std::make_shared<MirrorNode>("127.0.0.1:5602");
+  const auto unhealthy = std::make_shared<MirrorNode>("127.0.0.1:5603");
+  unhealthy->increaseBackoff();
+  const std::vector<std::shared_ptr<MirrorNode>> byHealth = { first, second, third, unhealthy };
+
+  // When
+  std::vector<std::vector<std::shared_ptr<MirrorNode>>> rotations;
+  for (size_t nextNode = 0ULL; nextNode < 4ULL; ++nextNode)
+  {
+    std::vector<std::shared_ptr<MirrorNode>> nodes = byHealth;
+    MirrorNodeContractCallEngine::rotateHealthyNodes(nodes, nextNode);
+    rotations.push_back(nodes);
+  }
+
+  // Then
+  using Nodes = std::vector<std::shared_ptr<MirrorNode>>;
+  EXPECT_EQ(rotations.at(0), (Nodes{ first, second, third, unhealthy }));
+  EXPECT_EQ(rotations.at(1), (Nodes{ second, third, first, unhealthy }));
+  EXPECT_EQ(rotations.at(2), (Nodes{ third, first, second, unhealthy }));
+  EXPECT_EQ(rotations.at(3), (Nodes{ first, second, third, unhealthy }));
+}
+
+//-----
+TEST_F(MirrorNodeContractCallEngineUnitTests, RotateHealthyNodesLeavesUnhealthyNodesInOrder)
+{
+  // Given
+  const auto healthy = std::make_shared<MirrorNode>("127.0.0.1:5600");
+  const auto firstUnhealthy = std::make_shared<MirrorNode>("127.0.0.1:5601");
+  const auto secondUnhealthy = std::make_shared<MirrorNode>("127.0.0.1:5602");
+  firstUnhealthy->increaseBackoff();
+  secondUnhealthy->increaseBackoff();
+  std::vector<std::shared_ptr<MirrorNode>> nodes = { healthy, firstUnhealthy, secondUnhealthy };
+
+  // When
+  MirrorNodeContractCallEngine::rotateHealthyNodes(nodes, 1ULL);
+
+  // Then
+  EXPECT_EQ(nodes, (std::vector<std::shared_ptr<MirrorNode>>{ healthy, firstUnhealthy, secondUnhealthy }));
+}
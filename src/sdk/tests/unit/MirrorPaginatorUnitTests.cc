@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Client.h"
+#include "exceptions/IllegalStateException.h"
+#include "impl/MirrorPaginator.h"
+
+#include <gtest/gtest.h>
+#include <httplib.h>
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class MirrorPaginatorUnitTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // The first page links to the second one on a host that doesn't answer. The failing collection always fails.
+    mServer.Get("/api/v1/items",
+                [this](const httplib::Request& request, httplib::Response& response)
+                {
+                  ++mRequests;
+                  if (request.get_param_value("page") == "2")
+                  {
+                    response.set_content(R"({"items":[3],"links":{"next":null}})", "application/json");
+                    return;
+                  }
+
+                  response.set_content(R"({"items":[1,2],"links":{"next":"http://127.0.0.1:1/api/v1/items?page=2"}})",
+                                       "application/json");
+                });
+    mServer.Get("/api/v1/failing",
+                [this](const httplib::Request&, httplib::Response& response)
+                {
+                  ++mRequests;
+                  response.status = 500;
+                });
+
+    mPort = mServer.bind_to_any_port("127.0.0.1");
+    mServerThread = std::thread([this]() { mServer.listen_after_bind(); });
+    mServer.wait_until_ready();
+
+    mClient = Client::forNetwork({});
+    mClient.setMirrorNetwork({ "127.0.0.1:5600" });
+  }
+
+  void TearDown() override
+  {
+    mClient.close();
+    mServer.stop();
+    mServerThread.join();
+  }
+
+  // Make a paginator over a collection of the test server.
+  [[nodiscard]] MirrorPaginator makePaginator(const std::string& path, const std::string& collection) const
+  {
+    return MirrorPaginator(mClient,
+                           path,
+                           collection,
+                           [port = mPort](std::string_view) { return "http://127.0.0.1:" + std::to_string(port); });
+  }
+
+  [[nodiscard]] inline int getRequests() const { return mRequests; }
+
+private:
+  httplib::Server mServer;
+  std::thread mServerThread;
+  int mPort = 0;
+  std::atomic_int mRequests{ 0 };
+  Client mClient;
+};
+
+//-----
+TEST_F(MirrorPaginatorUnitTests, ParsePageItemsAndNextLink)
+{
+  // Given
+  const std::string item1 = R"({"account":"0.0.1","keys":{"_type":"ED25519","values":[1,2]}})";
+  const std::string item2 = R"({"account":"0.0.2","keys":null})";
+  const std::string body =
+    R"({"accounts":[)" + item1 + ',' + item2 + R"(],"links":{"next":"/api/v1/accounts?account.id=gt:0.0.2"}})";
+
+  // When
+  const MirrorPage page = parseMirrorPage(body, "accounts");
+
+  // Then
+  ASSERT_EQ(page.mItems.size(), 2ULL);
+  EXPECT_EQ(page.mItems.at(0), nlohmann::json::parse(item1));
+  EXPECT_EQ(page.mItems.at(1), nlohmann::json::parse(item2));
+  EXPECT_EQ(page.mNextPath, "/api/v1/accounts?account.id=gt:0.0.2");
+}
+
+//-----
+TEST_F(MirrorPaginatorUnitTests, ParseLastPage)
+{
+  // Given
+  const std::string body = R"({"links":{"next":null},"accounts":["0.0.1",2,[3]]})";
+
+  // When
+  const MirrorPage page = parseMirrorPage(body, "accounts");
+
+  // Then
+  ASSERT_EQ(page.mItems.size(), 3ULL);
+  EXPECT_EQ(page.mItems.at(0), "0.0.1");
+  EXPECT_EQ(page.mItems.at(1), 2);
+  EXPECT_EQ(page.mItems.at(2), nlohmann::json::array({ 3 }));
+  EXPECT_TRUE(page.mNextPath.empty());
+}
+
+//-----
+TEST_F(MirrorPaginatorUnitTests, ParsePageSkipsOtherFields)
+{
+  // Given
+  const std::string body = R"({"timestamp":"1.2","nodes":[{"accounts":["0.0.9"]}],"next":"/ignored",)"
+                           R"("links":{"self":"/api/v1/accounts","extra":{"next":"/ignored"}},"accounts":[]})";
+
+  // When
+  const MirrorPage page = parseMirrorPage(body, "accounts");
+
+  // Then
+  EXPECT_TRUE(page.mItems.empty());
+  EXPECT_TRUE(page.mNextPath.empty());
+}
+
+//-----
+TEST_F(MirrorPaginatorUnitTests, ParseInvalidPage)
+{
+  // Given / When / Then
+  EXPECT_THROW(parseMirrorPage(R"({"accounts":[{"account":)", "accounts"), IllegalStateException);
+  EXPECT_THROW(parseMirrorPage("not json", "accounts"), IllegalStateException);
+}
+
+//-----
+TEST_F(MirrorPaginatorUnitTests, AbsoluteNextLinkIsFetchedFromMirrorNetwork)
+{
+  // Given
+  MirrorPaginator paginator = makePaginator("/api/v1/items", "items");
+
+  // When
+  std::vector<nlohmann::json> items;
+  for (std::optional<nlohmann::json> item = paginator.next(); item.has_value(); item = paginator.next())
+  {
+    items.push_back(*item);
+  }
+
+  // Then
+  EXPECT_EQ(items, (std::vector<nlohmann::json>{ 1, 2, 3 }));
+  EXPECT_EQ(getRequests(), 2);
+}
+
+//-----
+TEST_F(MirrorPaginatorUnitTests, FailedPageEndsCollection)
+{
+  // Given
+  MirrorPaginator paginator = makePaginator("/api/v1/failing", "items");
+
+  // When / Then
+  EXPECT_THROW(static_cast<void>(paginator.next()), IllegalStateException);
+  EXPECT_FALSE(paginator.next().has_value());
+  EXPECT_EQ(getRequests(), 1);
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/MirrorResponseCache.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class MirrorResponseCacheUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] inline const std::string& getTestKey() const { return mTestKey; }
+  [[nodiscard]] inline const std::string& getTestBody() const { return mTestBody; }
+
+private:
+  const std::string mTestKey =
+    MirrorResponseCache::makeKey("GET", "https://testnet.mirrornode.hedera.com:443/api/v1/accounts/0.0.2", "");
+  const std::string mTestBody = R"({"account":"0.0.2"})";
+};
+
+//-----
+TEST_F(MirrorResponseCacheUnitTests, ServesFreshResponse)
+{
+  // Given
+  MirrorResponseCache cache(4ULL);
+
+  // When
+  const MirrorResponseCache::Lookup miss = cache.lookup(getTestKey());
+  cache.put(getTestKey(), getTestBody(), "", std::chrono::minutes(1));
+  const MirrorResponseCache::Lookup hit = cache.lookup(getTestKey());
+
+  // Then
+  EXPECT_FALSE(miss.mFreshBody.has_value());
+  ASSERT_TRUE(hit.mFreshBody.has_value());
+  EXPECT_EQ(*hit.mFreshBody, getTestBody());
+
+  const MirrorResponseCache::Statistics statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.mHits, 1ULL);
+  EXPECT_EQ(statistics.mMisses, 1ULL);
+  EXPECT_EQ(statistics.mEntries, 1ULL);
+}
+
+//-----
+TEST_F(MirrorResponseCacheUnitTests, StaleResponseIsRevalidatedWithETag)
+{
+  // Given
+  MirrorResponseCache cache(4ULL);
+  cache.put(getTestKey(), getTestBody(), "\"v1\"", std::chrono::seconds(-1));
+
+  // When
+  const MirrorResponseCache::Lookup stale = cache.lookup(getTestKey());
+  const std::optional<std::string> revalidated = cache.revalidate(getTestKey(), std::chrono::minutes(1));
+
+  // Then
+  EXPECT_FALSE(stale.mFreshBody.has_value());
+  EXPECT_EQ(stale.mETag, "\"v1\"");
+  ASSERT_TRUE(revalidated.has_value());
+  EXPECT_EQ(*revalidated, getTestBody());
+  EXPECT_TRUE(cache.lookup(getTestKey()).mFreshBody.has_value());
+  EXPECT_EQ(cache.getStatistics().mRevalidations, 1ULL);
+}
+
+//-----
+TEST_F(MirrorResponseCacheUnitTests, EvictsLeastRecentlyUsedResponse)
+{
+  // Given
+  MirrorResponseCache cache(2ULL);
+  cache.put("a", getTestBody(), "", std::chrono::minutes(1));
+  cache.put("b", getTestBody(), "", std::chrono::minutes(1));
+
+  // When
+  EXPECT_TRUE(cache.lookup("a").mFreshBody.has_value());
+  cache.put("c", getTestBody(), "", std::chrono::minutes(1));
+
+  // Then
+  EXPECT_TRUE(cache.lookup("a").mFreshBody.has_value());
+  EXPECT_FALSE(cache.lookup("b").mFreshBody.has_value());
+  EXPECT_TRUE(cache.lookup("c").mFreshBody.has_value());
+  EXPECT_EQ(cache.getStatistics().mEvictions, 1ULL);
+}
+
+//-----
+TEST_F(MirrorResponseCacheUnitTests, MakeKeyIgnoresMirrorNode)
+{
+  // Given / When
+  const std::string otherNodeKey =
+    MirrorResponseCache::makeKey("GET", "https://mainnet-public.mirrornode.hedera.com:443/api/v1/accounts/0.0.2", "");
+  const std::string postKey =
+    MirrorResponseCache::makeKey("POST", "https://testnet.mirrornode.hedera.com:443/api/v1/accounts/0.0.2", "");
+
+  // Then
+  EXPECT_EQ(otherNodeKey, getTestKey());
+  EXPECT_NE(postKey, getTestKey());
+}
+
+//-----
+TEST_F(MirrorResponseCacheUnitTests, EraseDropsResponse)
+{
+  // Given
+  MirrorResponseCache cache(4ULL);
+  cache.put(getTestKey(), getTestBody(), "", std::chrono::minutes(1));
+
+  // When
+  cache.erase(getTestKey());
+  cache.erase(getTestKey());
+
+  // Then
+  EXPECT_FALSE(cache.lookup(getTestKey()).mFreshBody.has_value());
+  EXPECT_EQ(cache.getStatistics().mEntries, 0ULL);
+}
+
+//-----
+TEST_F(MirrorResponseCacheUnitTests, MakeQueryCostKeyGroupsBySizeClass)
+{
+  // Given / When
+  const std::string small = MirrorResponseCache::makeQueryCostKey(6, 20ULL);
+  const std::string sameClass = MirrorResponseCache::makeQueryCostKey(6, 32ULL);
+  const std::string largerClass = MirrorResponseCache::makeQueryCostKey(6, 33ULL);
+  const std::string otherType = MirrorResponseCache::makeQueryCostKey(9, 20ULL);
+
+  // Then
+  EXPECT_EQ(small, "6:32");
+  EXPECT_EQ(small, sameClass);
+  EXPECT_EQ(largerClass, "6:64");
+  EXPECT_NE(small, otherType);
+  EXPECT_EQ(MirrorResponseCache::makeQueryCostKey(6, 0ULL), "6:1");
+}
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "ED25519PrivateKey.h"
+#include "FileContentsQuery.h"
+#include "FileId.h"
+#include "Hbar.h"
+#include "exceptions/MaxQueryPaymentExceededException.h"
+#include "impl/MirrorResponseCache.h"
+
+#include <grpcpp/grpcpp.h>
+#include <gtest/gtest.h>
+#include <services/basic_types.pb.h>
+#include <services/file_service.grpc.pb.h>
+#include <services/query.pb.h>
+#include <services/response.pb.h>
+#include <services/response_code.pb.h>
+#include <services/transaction.pb.h>
+#include <services/transaction_contents.pb.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Hiero;
+
+class QueryUnitTests : public ::testing::Test
+{
+protected:
+  // What the test node saw of one request.
+  struct SeenRequest
+  {
+    bool mCostAnswer = false;
+    int64_t mPayment = 0LL;
+  };
+
+  void SetUp() override
+  {
+    // The node's FileService answers every call with UNIMPLEMENTED, and the response listener of each query stands in
+    // for it. This only needs a reachable node.
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &mPort);
+    builder.RegisterService(&mService);
+    mServer = builder.BuildAndStart();
+
+    mClient = Client::forNetwork({
+      {"127.0.0.1:" + std::to_string(mPort), getNodeAccountId()}
+    });
+    mClient.setOperator(AccountId(2ULL), mOperatorKey);
+  }
+
+  void TearDown() override
+  {
+    mClient.close();
+    mServer->Shutdown();
+  }
+
+  // Make a FileContentsQuery against the test node whose file costs a number of tinybars. A payment below that fails
+  // pre-check with INSUFFICIENT_TX_FEE.
+  [[nodiscard]] FileContentsQuery makeQuery(int64_t cost)
+  {
+    FileContentsQuery query;
+    query.setFileId(FileId(111ULL)).setNodeAccountIds({ getNodeAccountId() });
+    query.setRequestListener(
+      [this](proto::Query& request)
+      {
+        SeenRequest seen;
+        seen.mCostAnswer = request.filegetcontents().header().responsetype() == proto::ResponseType::COST_ANSWER;
+        proto::SignedTransaction signedTx;
+        proto::TransactionBody body;
+        if (signedTx.ParseFromString(request.filegetcontents().header().payment().signedtransactionbytes()) &&
+            body.ParseFromString(signedTx.bodybytes()))
+        {
+          for (const proto::AccountAmount& amount : body.cryptotransfer().transfers().accountamounts())
+          {
+            seen.mPayment = std::max(seen.mPayment, amount.amount());
+          }
+        }
+
+        mRequests.push_back(seen);
+        return request;
+      });
+    query.setResponseListener(
+      [this, cost](proto::Response&)
+      {
+        const SeenRequest& seen = mRequests.back();
+        proto::Response response;
+        proto::ResponseHeader* header = response.mutable_filegetcontents()->mutable_header();
+        header->set_cost(static_cast<uint64_t>(cost));
+        header->set_nodetransactionprecheckcode(!seen.mCostAnswer && seen.mPayment < cost
+                                                  ? proto::ResponseCodeEnum::INSUFFICIENT_TX_FEE
+                                                  : proto::ResponseCodeEnum::OK);
+        response.mutable_filegetcontents()->mutable_filecontents()->set_contents("contents");
+        return response;
+      });
+    return query;
+  }
+
+  // Get the key under which the Client caches the cost of the queries made by makeQuery().
+  [[nodiscard]] std::string getCostKey() const
+  {
+    proto::Query request;
+    request.mutable_filegetcontents()->mutable_header()->set_responsetype(proto::ResponseType::COST_ANSWER);
+    request.mutable_filegetcontents()->set_allocated_fileid(FileId(111ULL).toProtobuf().release());
+    return internal::MirrorResponseCache::makeQueryCostKey(static_cast<int>(request.query_case()),
+                                                           request.ByteSizeLong());
+  }
+
+  [[nodiscard]] inline const AccountId& getNodeAccountId() const { return mNodeAccountId; }
+  [[nodiscard]] inline Client& getClient() { return mClient; }
+  [[nodiscard]] inline const std::vector<SeenRequest>& getRequests() const { return mRequests; }
+
+private:
+  const AccountId mNodeAccountId = AccountId(3ULL);
+  const std::shared_ptr<PrivateKey> mOperatorKey = ED25519PrivateKey::fromString(
+    "302e020100300506032b65700422042091132178e72057a1d7528025956fe39b0b847f200ab59b2fdd367017f3087137");
+  proto::FileService::Service mService;
+  std::unique_ptr<grpc::Server> mServer;
+  int mPort = 0;
+  Client mClient;
+  std::vector<SeenRequest> mRequests;
+};
+
+//-----
+TEST_F(QueryUnitTests, CachedCostSkipsCostRequest)
+{
+  // Given
+  getClient().setQueryCostCacheTtl(std::chrono::minutes(1));
+  FileContentsQuery first = makeQuery(10LL);
+  FileContentsQuery second = makeQuery(10LL);
+
+  // When
+  EXPECT_NO_THROW(first.execute(getClient()));
+  EXPECT_NO_THROW(second.execute(getClient()));
+
+  // Then
+  ASSERT_EQ(getRequests().size(), 3ULL);
+  EXPECT_TRUE(getRequests().at(0).mCostAnswer);
+  EXPECT_FALSE(getRequests().at(1).mCostAnswer);
+  EXPECT_FALSE(getRequests().at(2).mCostAnswer);
+  EXPECT_EQ(getRequests().at(2).mPayment, 10LL);
+}
+
+//-----
+TEST_F(QueryUnitTests, TooLowCachedCostIsDroppedAndQueryRetried)
+{
+  // Given
+  getClient().setQueryCostCacheTtl(std::chrono::minutes(1));
+  getClient().getQueryCostCache()->put(getCostKey(), "5", std::string(), std::chrono::minutes(1));
+  FileContentsQuery query = makeQuery(10LL);
+
+  // When
+  EXPECT_NO_THROW(query.execute(getClient()));
+
+  // Then
+  ASSERT_EQ(getRequests().size(), 3ULL);
+  EXPECT_FALSE(getRequests().at(0).mCostAnswer);
+  EXPECT_EQ(getRequests().at(0).mPayment, 5LL);
+  EXPECT_TRUE(getRequests().at(1).mCostAnswer);
+  EXPECT_FALSE(getRequests().at(2).mCostAnswer);
+  EXPECT_EQ(getRequests().at(2).mPayment, 10LL);
+
+  const internal::MirrorResponseCache::Lookup lookup = getClient().getQueryCostCache()->lookup(getCostKey());
+  ASSERT_TRUE(lookup.mFreshBody.has_value());
+  EXPECT_EQ(*lookup.mFreshBody, "10");
+}
+
+//-----
+TEST_F(QueryUnitTests, PrepaidQueryPaysMaximumPayment)
+{
+  // Given
+  getClient().setPrepayQueries(true);
+  FileContentsQuery query = makeQuery(10LL);
+  query.setMaxQueryPayment(Hbar::fromTinybars(50LL));
+
+  // When
+  EXPECT_NO_THROW(query.execute(getClient()));
+
+  // Then
+  ASSERT_EQ(getRequests().size(), 1ULL);
+  EXPECT_FALSE(getRequests().at(0).mCostAnswer);
+  EXPECT_EQ(getRequests().at(0).mPayment, 50LL);
+}
+
+//-----
+TEST_F(QueryUnitTests, TooLowPrepaymentAsksForCostAndRetries)
+{
+  // Given
+  getClient().setPrepayQueries(true);
+  FileContentsQuery query = makeQuery(100LL);
+  query.setMaxQueryPayment(Hbar::fromTinybars(50LL));
+
+  // When / Then
+  EXPECT_THROW(query.execute(getClient()), MaxQueryPaymentExceededException);
+  ASSERT_EQ(getRequests().size(), 2ULL);
+  EXPECT_EQ(getRequests().at(0).mPayment, 50LL);
+  EXPECT_TRUE(getRequests().at(1).mCostAnswer);
+}
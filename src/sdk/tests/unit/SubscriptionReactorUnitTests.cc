@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "exceptions/IllegalStateException.h"
+#include "impl/SubscriptionReactor.h"
+
+#include <grpcpp/alarm.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+namespace
+{
+// A Handler that waits on an alarm until it's cancelled.
+class AlarmHandler : public SubscriptionReactor::Handler
+{
+public:
+  void start(SubscriptionReactor& reactor)
+  {
+    mAlarm.Set(reactor.getCompletionQueue(), std::chrono::system_clock::now() + std::chrono::hours(1), this);
+  }
+
+  bool onEvent(bool ok) override
+  {
+    mFiredOk = ok;
+    mFinished = true;
+    return false;
+  }
+
+  void cancel() override { mAlarm.Cancel(); }
+
+  std::atomic_bool mFinished{ false };
+  std::atomic_bool mFiredOk{ true };
+
+private:
+  grpc::Alarm mAlarm;
+};
+
+} // anonymous namespace
+
+class SubscriptionReactorUnitTests : public ::testing::Test
+{
+};
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, PostRunsTask)
+{
+  // Given
+  SubscriptionReactor reactor(1U, 2U);
+  std::promise<void> ran;
+
+  // When
+  reactor.post([&ran]() { ran.set_value(); });
+
+  // Then
+  EXPECT_EQ(ran.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, ConstructWithNoPendingTasksAllowed)
+{
+  // Given / When / Then
+  EXPECT_THROW(SubscriptionReactor(1U, 1U, 0ULL), std::invalid_argument);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, ThrowingTaskDoesNotStopCallbackThread)
+{
+  // Given
+  SubscriptionReactor reactor(1U, 1U);
+  std::promise<void> ran;
+
+  // When
+  reactor.post([]() { throw std::runtime_error("callback failed"); });
+  reactor.post([]() { throw 1; });
+  reactor.post([&ran]() { ran.set_value(); });
+
+  // Then
+  EXPECT_EQ(ran.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, PostWaitsForRoomWhenQueueIsFull)
+{
+  // Given
+  SubscriptionReactor reactor(1U, 1U, 1ULL);
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::promise<void> blocking;
+  reactor.post([&blocking, released]() {
+    blocking.set_value();
+    released.wait();
+  });
+  ASSERT_EQ(blocking.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  reactor.post([]() {});
+
+  // When
+  std::atomic_bool posted{ false };
+  std::thread poster([&reactor, &posted]() {
+    reactor.post([]() {});
+    posted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // Then
+  EXPECT_FALSE(posted);
+  release.set_value();
+  poster.join();
+  EXPECT_TRUE(posted);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, PostFromCallbackDoesNotWaitForRoom)
+{
+  // Given
+  SubscriptionReactor reactor(1U, 1U, 1ULL);
+  std::promise<void> ran;
+
+  // When
+  reactor.post([&reactor, &ran]() {
+    reactor.post([]() {});
+    reactor.post([&ran]() { ran.set_value(); });
+  });
+
+  // Then
+  EXPECT_EQ(ran.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, ShutdownCancelsHandlers)
+{
+  // Given
+  SubscriptionReactor reactor(1U, 1U);
+  auto handler = std::make_shared<AlarmHandler>();
+  reactor.add(handler);
+  handler->start(reactor);
+
+  // When
+  reactor.shutdown();
+
+  // Then
+  EXPECT_TRUE(handler->mFinished);
+  EXPECT_FALSE(handler->mFiredOk);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, CannotAddAfterShutdown)
+{
+  // Given
+  SubscriptionReactor reactor(1U, 1U);
+
+  // When
+  reactor.shutdown();
+
+  // Then
+  EXPECT_THROW(reactor.add(std::make_shared<AlarmHandler>()), IllegalStateException);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, PostAfterRunsTaskOnShutdown)
+{
+  // Given
+  SubscriptionReactor reactor(1U, 1U);
+  std::atomic_bool ran{ false };
+  reactor.postAfter(std::chrono::system_clock::now() + std::chrono::hours(1), [&ran]() { ran = true; });
+
+  // When
+  reactor.shutdown();
+
+  // Then
+  EXPECT_TRUE(ran);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, ShutdownDuringPostAfterDoesNotWaitForDeadline)
+{
+  // Given
+  const std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
+  const std::chrono::system_clock::time_point deadline = start + std::chrono::seconds(30);
+
+  for (int i = 0; i < 20; ++i)
+  {
+    SubscriptionReactor reactor(1U, 1U);
+    std::thread poster(
+      [&reactor, &deadline]()
+      {
+        try
+        {
+          while (true)
+          {
+            reactor.postAfter(deadline, []() {});
+          }
+        }
+        catch (const IllegalStateException&)
+        {
+          // The reactor shut down.
+        }
+      });
+
+    // When
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    reactor.shutdown();
+    poster.join();
+  }
+
+  // Then
+  EXPECT_LT(std::chrono::system_clock::now(), deadline);
+}
@@ -3,9 +3,12 @@
 #include "ECDSAsecp256k1PrivateKey.h"
 #include "TopicId.h"
 #include "TopicMessageQuery.h"
+#include "TransactionId.h"
 
 #include <chrono>
+#include <grpcpp/impl/codegen/status.h>
 #include <gtest/gtest.h>
+#include <stdexcept>
 
 using namespace Hiero;
 
@@ -201,3 +204,105 @@ TEST_F(TopicMessageQueryUnitTests, GetSetMaxBackoff)
   // Then
   EXPECT_EQ(query.getMaxBackoff(), getTestMaxBackoff());
 }
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetRetryHandler)
+{
+  // Given
+  TopicMessageQuery query;
+
+  // When
+  query.setRetryHandler([](const grpc::Status&) { return false; });
+
+  // Then
+  ASSERT_TRUE(query.getRetryHandler());
+  EXPECT_FALSE(query.getRetryHandler()(grpc::Status(grpc::StatusCode::UNAVAILABLE, "")));
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetMaxPendingChunkBytes)
+{
+  // Given
+  TopicMessageQuery query;
+
+  // When
+  query.setMaxPendingChunkBytes(8ULL);
+
+  // Then
+  EXPECT_EQ(query.getMaxPendingChunkBytes(), 8ULL);
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetMaxPendingChunkAge)
+{
+  // Given
+  TopicMessageQuery query;
+
+  // When
+  query.setMaxPendingChunkAge(std::chrono::seconds(9));
+
+  // Then
+  EXPECT_EQ(query.getMaxPendingChunkAge(), std::chrono::seconds(9));
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetIncompleteMessageHandler)
+{
+  // Given
+  TopicMessageQuery query;
+  uint64_t received = 0ULL;
+
+  // When
+  query.setIncompleteMessageHandler([&received](const TransactionId&, uint64_t chunks, uint64_t)
+                                    { received = chunks; });
+
+  // Then
+  ASSERT_TRUE(query.getIncompleteMessageHandler());
+  query.getIncompleteMessageHandler()(TransactionId(), 2ULL, 3ULL);
+  EXPECT_EQ(received, 2ULL);
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetDeliveryQueue)
+{
+  // Given
+  TopicMessageQuery query;
+
+  // When
+  query.setMaxQueuedMessages(10ULL).setOverflowPolicy(TopicMessageQuery::OverflowPolicy::DROP_OLDEST);
+
+  // Then
+  EXPECT_EQ(query.getMaxQueuedMessages(), 10ULL);
+  EXPECT_EQ(query.getOverflowPolicy(), TopicMessageQuery::OverflowPolicy::DROP_OLDEST);
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetBatching)
+{
+  // Given
+  TopicMessageQuery query;
+
+  // When
+  query.setMaxBatchSize(11ULL).setMaxBatchDelay(std::chrono::milliseconds(12));
+
+  // Then
+  EXPECT_EQ(query.getMaxBatchSize(), 11ULL);
+  EXPECT_EQ(query.getMaxBatchDelay(), std::chrono::milliseconds(12));
+  EXPECT_THROW(query.setMaxBatchSize(0ULL), std::invalid_argument);
+  EXPECT_THROW(query.setMaxBatchDelay(std::chrono::milliseconds(-1)), std::invalid_argument);
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetDeliverViews)
+{
+  // Given
+  TopicMessageQuery query;
+  EXPECT_FALSE(query.getDeliverViews());
+
+  // When
+  query.setDeliverViews(true);
+
+  // Then
+  EXPECT_TRUE(query.getDeliverViews());
+  EXPECT_TRUE(TopicMessageQuery(query).getDeliverViews());
+}
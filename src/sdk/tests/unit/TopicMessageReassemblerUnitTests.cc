@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Defaults.h"
+#include "impl/TimestampConverter.h"
+#include "impl/TopicMessageReassembler.h"
+#include "impl/Utilities.h"
+
+#include <gtest/gtest.h>
+#include <mirror/consensus_service.pb.h>
+
+#include <limits>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class TopicMessageReassemblerUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] com::hedera::mirror::api::proto::ConsensusTopicResponse makeChunk(
+    const TransactionId& transactionId,
+    int32_t number,
+    int32_t total,
+    const std::chrono::system_clock::time_point& consensusTimestamp) const
+  {
+    com::hedera::mirror::api::proto::ConsensusTopicResponse chunk;
+    chunk.set_allocated_consensustimestamp(internal::TimestampConverter::toProtobuf(consensusTimestamp));
+    chunk.set_message(internal::Utilities::byteVectorToString(mTestContents));
+    chunk.set_sequencenumber(static_cast<uint64_t>(number));
+    chunk.mutable_chunkinfo()->set_allocated_initialtransactionid(transactionId.toProtobuf().release());
+    chunk.mutable_chunkinfo()->set_number(number);
+    chunk.mutable_chunkinfo()->set_total(total);
+    return chunk;
+  }
+
+  [[nodiscard]] inline const std::vector<std::byte>& getTestContents() const { return mTestContents; }
+  [[nodiscard]] inline const std::chrono::system_clock::time_point& getTestTime() const { return mTestTime; }
+
+private:
+  const std::vector<std::byte> mTestContents = { std::byte(0x01), std::byte(0x02), std::byte(0x03) };
+  const std::chrono::system_clock::time_point mTestTime = std::chrono::system_clock::now();
+};
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, CompletesOutOfOrderMessage)
+{
+  // Given
+  TopicMessageReassembler reassembler(1024ULL, std::chrono::minutes(1));
+  const TransactionId transactionId = TransactionId::generate(AccountId(1ULL));
+
+  // When
+  const std::optional<TopicMessage> first = reassembler.add(makeChunk(transactionId, 2, 2, getTestTime()));
+  const std::optional<TopicMessage> second = reassembler.add(makeChunk(transactionId, 1, 2, getTestTime()));
+
+  // Then
+  EXPECT_FALSE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(second->mContents, internal::Utilities::concatenateVectors({ getTestContents(), getTestContents() }));
+  EXPECT_EQ(second->mSequenceNumber, 2ULL);
+  EXPECT_EQ(second->mTransactionId, transactionId);
+
+  const TopicMessageReassembler::Statistics statistics = reassembler.getStatistics();
+  EXPECT_EQ(statistics.mCompletedMessages, 1ULL);
+  EXPECT_EQ(statistics.mPendingMessages, 0ULL);
+  EXPECT_EQ(statistics.mPendingBytes, 0ULL);
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, IgnoresDuplicateAndInvalidChunks)
+{
+  // Given
+  TopicMessageReassembler reassembler(1024ULL, std::chrono::minutes(1));
+  const TransactionId transactionId = TransactionId::generate(AccountId(1ULL));
+
+  // When
+  EXPECT_FALSE(reassembler.add(makeChunk(transactionId, 1, 2, getTestTime())).has_value());
+  EXPECT_FALSE(reassembler.add(makeChunk(transactionId, 1, 2, getTestTime())).has_value());
+  EXPECT_FALSE(reassembler.add(makeChunk(transactionId, 3, 2, getTestTime())).has_value());
+
+  // Then
+  const TopicMessageReassembler::Statistics statistics = reassembler.getStatistics();
+  EXPECT_EQ(statistics.mIgnoredChunks, 2ULL);
+  EXPECT_EQ(statistics.mPendingMessages, 1ULL);
+  EXPECT_EQ(statistics.mPendingBytes, getTestContents().size());
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, HoldsOnlyReceivedChunksOfHugeMessage)
+{
+  // Given
+  uint64_t evictedReceived = 0ULL;
+  uint64_t evictedTotal = 0ULL;
+  TopicMessageReassembler reassembler(
+    getTestContents().size(),
+    std::chrono::minutes(1),
+    [&evictedReceived, &evictedTotal](const TransactionId&, uint64_t received, uint64_t total)
+    {
+      evictedReceived = received;
+      evictedTotal = total;
+    });
+  const TransactionId hugeTransactionId = TransactionId::generate(AccountId(1ULL));
+  const TransactionId nextTransactionId = TransactionId::generate(AccountId(2ULL));
+  constexpr int32_t hugeTotal = std::numeric_limits<int32_t>::max();
+
+  // When
+  EXPECT_FALSE(reassembler.add(makeChunk(hugeTransactionId, hugeTotal, hugeTotal, getTestTime())).has_value());
+  const TopicMessageReassembler::Statistics held = reassembler.getStatistics();
+  EXPECT_FALSE(reassembler.add(makeChunk(nextTransactionId, 1, 2, getTestTime())).has_value());
+
+  // Then
+  EXPECT_EQ(held.mPendingMessages, 1ULL);
+  EXPECT_EQ(held.mPendingBytes, getTestContents().size());
+  EXPECT_EQ(evictedReceived, 1ULL);
+  EXPECT_EQ(evictedTotal, static_cast<uint64_t>(hugeTotal));
+  EXPECT_EQ(reassembler.getStatistics().mPendingMessages, 1ULL);
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, EvictsOldPartialMessages)
+{
+  // Given
+  uint64_t evictedReceived = 0ULL;
+  uint64_t evictedTotal = 0ULL;
+  TopicMessageReassembler reassembler(
+    1024ULL,
+    std::chrono::minutes(1),
+    [&evictedReceived, &evictedTotal](const TransactionId&, uint64_t received, uint64_t total)
+    {
+      evictedReceived = received;
+      evictedTotal = total;
+    });
+  const TransactionId oldTransactionId = TransactionId::generate(AccountId(1ULL));
+  const TransactionId newTransactionId = TransactionId::generate(AccountId(2ULL));
+
+  // When
+  EXPECT_FALSE(reassembler.add(makeChunk(oldTransactionId, 1, 3, getTestTime())).has_value());
+  EXPECT_FALSE(reassembler.add(makeChunk(newTransactionId, 1, 2, getTestTime() + std::chrono::minutes(2))).has_value());
+
+  // Then
+  EXPECT_EQ(evictedReceived, 1ULL);
+  EXPECT_EQ(evictedTotal, 3ULL);
+
+  const TopicMessageReassembler::Statistics statistics = reassembler.getStatistics();
+  EXPECT_EQ(statistics.mEvictedMessages, 1ULL);
+  EXPECT_EQ(statistics.mEvictedChunks, 1ULL);
+  EXPECT_EQ(statistics.mPendingMessages, 1ULL);
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, EvictsOldestPartialMessagesOverMemoryCap)
+{
+  // Given
+  TopicMessageReassembler reassembler(getTestContents().size(), std::chrono::minutes(1));
+  const TransactionId firstTransactionId = TransactionId::generate(AccountId(1ULL));
+  const TransactionId secondTransactionId = TransactionId::generate(AccountId(2ULL));
+
+  // When
+  EXPECT_FALSE(reassembler.add(makeChunk(firstTransactionId, 1, 2, getTestTime())).has_value());
+  EXPECT_FALSE(reassembler.add(makeChunk(secondTransactionId, 1, 2, getTestTime())).has_value());
+
+  // Then
+  EXPECT_EQ(reassembler.getStatistics().mEvictedMessages, 1ULL);
+  EXPECT_EQ(reassembler.getStatistics().mPendingBytes, getTestContents().size());
+  EXPECT_TRUE(reassembler.add(makeChunk(secondTransactionId, 2, 2, getTestTime())).has_value());
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, DropsLateChunksOfEvictedMessages)
+{
+  // Given
+  int evictions = 0;
+  TopicMessageReassembler reassembler(
+    1024ULL, std::chrono::minutes(1), [&evictions](const TransactionId&, uint64_t, uint64_t) { ++evictions; });
+  const TransactionId oldTransactionId = TransactionId::generate(AccountId(1ULL));
+  const TransactionId newTransactionId = TransactionId::generate(AccountId(2ULL));
+  EXPECT_FALSE(reassembler.add(makeChunk(oldTransactionId, 1, 3, getTestTime())).has_value());
+  EXPECT_FALSE(reassembler.add(makeChunk(newTransactionId, 1, 2, getTestTime() + std::chrono::minutes(2))).has_value());
+
+  // When
+  EXPECT_FALSE(reassembler.add(makeChunk(oldTransactionId, 2, 3, getTestTime() + std::chrono::minutes(2))).has_value());
+  EXPECT_FALSE(reassembler.add(makeChunk(oldTransactionId, 3, 3, getTestTime() + std::chrono::minutes(2))).has_value());
+
+  // Then
+  EXPECT_EQ(evictions, 1);
+
+  const TopicMessageReassembler::Statistics statistics = reassembler.getStatistics();
+  EXPECT_EQ(statistics.mEvictedMessages, 1ULL);
+  EXPECT_EQ(statistics.mEvictedChunks, 3ULL);
+  EXPECT_EQ(statistics.mPendingMessages, 1ULL);
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, ForgetsEvictedMessagesBeyondWindow)
+{
+  // Given
+  TopicMessageReassembler reassembler(getTestContents().size(), std::chrono::minutes(1));
+  const TransactionId firstTransactionId = TransactionId::generate(AccountId(1ULL));
+  EXPECT_FALSE(reassembler.add(makeChunk(firstTransactionId, 1, 2, getTestTime())).has_value());
+
+  // When
+  // Each message evicts the one before it, until the first has been pushed out of the window of evicted messages.
+  for (uint64_t account = 2ULL; account <= DEFAULT_MAX_EVICTED_TOPIC_MESSAGES + 2ULL; ++account)
+  {
+    EXPECT_FALSE(
+      reassembler.add(makeChunk(TransactionId::generate(AccountId(account)), 1, 2, getTestTime())).has_value());
+  }
+
+  // Then
+  ASSERT_EQ(reassembler.getStatistics().mEvictedMessages, DEFAULT_MAX_EVICTED_TOPIC_MESSAGES + 1ULL);
+  EXPECT_FALSE(reassembler.add(makeChunk(firstTransactionId, 2, 2, getTestTime())).has_value());
+  EXPECT_EQ(reassembler.getStatistics().mEvictedMessages, DEFAULT_MAX_EVICTED_TOPIC_MESSAGES + 2ULL);
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, GetOldestPendingTimestamp)
+{
+  // Given
+  TopicMessageReassembler reassembler(1024ULL, std::chrono::minutes(1));
+  const TransactionId firstTransactionId = TransactionId::generate(AccountId(1ULL));
+  const TransactionId secondTransactionId = TransactionId::generate(AccountId(2ULL));
+  EXPECT_FALSE(reassembler.getOldestPendingTimestamp().has_value());
+
+  // When
+  EXPECT_FALSE(reassembler.add(makeChunk(firstTransactionId, 1, 2, getTestTime())).has_value());
+  EXPECT_FALSE(
+    reassembler.add(makeChunk(secondTransactionId, 1, 2, getTestTime() + std::chrono::seconds(1))).has_value());
+  EXPECT_TRUE(
+    reassembler.add(makeChunk(firstTransactionId, 2, 2, getTestTime() + std::chrono::seconds(2))).has_value());
+
+  // Then
+  ASSERT_TRUE(reassembler.getOldestPendingTimestamp().has_value());
+  EXPECT_EQ(*reassembler.getOldestPendingTimestamp(), getTestTime() + std::chrono::seconds(1));
+}
+
+//-----
+TEST_F(TopicMessageReassemblerUnitTests, CompletesMessageAsView)
+{
+  // Given
+  TopicMessageReassembler reassembler(1024ULL, std::chrono::minutes(1), {}, true);
+  const TransactionId transactionId = TransactionId::generate(AccountId(1ULL));
+
+  // When
+  EXPECT_FALSE(reassembler.add(makeChunk(transactionId, 1, 2, getTestTime())).has_value());
+  const std::optional<TopicMessage> message = reassembler.add(makeChunk(transactionId, 2, 2, getTestTime()));
+
+  // Then
+  ASSERT_TRUE(message.has_value());
+  EXPECT_TRUE(message->isView());
+  EXPECT_EQ(message->getContents().toVector(),
+            internal::Utilities::concatenateVectors({ getTestContents(), getTestContents() }));
+  EXPECT_EQ(message->getChunkCount(), 2ULL);
+  EXPECT_EQ(message->mTransactionId, transactionId);
+}
@@ -99,3 +99,18 @@ TEST_F(TopicMessageSubmitTransactionUnitTests, GetSetMessageFrozen)
   EXPECT_THROW(transactionWithStr.setMessage(internal::Utilities::byteVectorToString(getTestMessage())),
                IllegalStateException);
 }
+
+//-----
+TEST_F(TopicMessageSubmitTransactionUnitTests, GetSetMaxChunksInFlight)
+{
+  // Given
+  TopicMessageSubmitTransaction transaction;
+  EXPECT_EQ(transaction.getMaxChunksInFlight(), DEFAULT_MAX_CHUNKS_IN_FLIGHT);
+
+  // When
+  transaction.setMaxChunksInFlight(4U);
+
+  // Then
+  EXPECT_EQ(transaction.getMaxChunksInFlight(), 4U);
+  EXPECT_THROW(transaction.setMaxChunksInFlight(0U), std::invalid_argument);
+}
@@ -6,6 +6,10 @@
 #include <gtest/gtest.h>
 #include <mirror/consensus_service.pb.h>
 
+#include <memory>
+#include <stdexcept>
+#include <string>
+
 using namespace Hiero;
 
 class TopicMessageUnitTests : public ::testing::Test
@@ -120,3 +124,79 @@ TEST_F(TopicMessageUnitTests, OfMany)
   EXPECT_EQ(topicMessage.mChunks.size(), 2);
   EXPECT_EQ(topicMessage.mTransactionId, getTestTransactionId());
 }
+
+//-----
+TEST_F(TopicMessageUnitTests, ViewOfSingle)
+{
+  // Given
+  auto protos = std::make_shared<std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>>(1);
+  protos->front().set_allocated_consensustimestamp(
+    internal::TimestampConverter::toProtobuf(getTestConsensusTimestamp()));
+  protos->front().set_message(internal::Utilities::byteVectorToString(getTestContents()));
+  protos->front().set_runninghash(internal::Utilities::byteVectorToString(getTestRunningHash()));
+  protos->front().set_sequencenumber(getTestSequenceNumber());
+  protos->front().mutable_chunkinfo()->set_allocated_initialtransactionid(
+    getTestTransactionId().toProtobuf().release());
+  const std::string* message = &protos->front().message();
+
+  // When
+  const TopicMessage topicMessage = TopicMessage::viewOf(protos);
+
+  // Then
+  EXPECT_TRUE(topicMessage.isView());
+  EXPECT_EQ(topicMessage.getContents().data(), reinterpret_cast<const std::byte*>(message->data()));
+  EXPECT_EQ(topicMessage.getContents().toVector(), getTestContents());
+  EXPECT_EQ(topicMessage.getRunningHash().toVector(), getTestRunningHash());
+  EXPECT_TRUE(topicMessage.mContents.empty());
+  EXPECT_TRUE(topicMessage.mRunningHash.empty());
+  EXPECT_EQ(topicMessage.mConsensusTimestamp, getTestConsensusTimestamp());
+  EXPECT_EQ(topicMessage.mSequenceNumber, getTestSequenceNumber());
+  EXPECT_EQ(topicMessage.getChunkCount(), 1ULL);
+  EXPECT_EQ(topicMessage.mTransactionId, getTestTransactionId());
+}
+
+//-----
+TEST_F(TopicMessageUnitTests, ViewOfManyAndMaterialize)
+{
+  // Given
+  auto protos = std::make_shared<std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>>(2);
+  for (int32_t i = 0; i < 2; ++i)
+  {
+    com::hedera::mirror::api::proto::ConsensusTopicResponse& proto = (*protos)[static_cast<size_t>(i)];
+    proto.set_allocated_consensustimestamp(
+      internal::TimestampConverter::toProtobuf(getTestConsensusTimestamp() + std::chrono::seconds(i)));
+    proto.set_message(internal::Utilities::byteVectorToString(getTestContents()));
+    proto.set_runninghash(internal::Utilities::byteVectorToString(getTestRunningHash()));
+    proto.set_sequencenumber(getTestSequenceNumber() + static_cast<uint64_t>(i));
+    proto.mutable_chunkinfo()->set_number(i + 1);
+    proto.mutable_chunkinfo()->set_total(2);
+  }
+  (*protos)[0].mutable_chunkinfo()->set_allocated_initialtransactionid(getTestTransactionId().toProtobuf().release());
+  TopicMessage topicMessage = TopicMessage::viewOf(protos);
+
+  // When
+  topicMessage.materialize();
+
+  // Then
+  const std::vector<std::byte> totalContents =
+    internal::Utilities::concatenateVectors({ getTestContents(), getTestContents() });
+  EXPECT_FALSE(topicMessage.isView());
+  EXPECT_EQ(topicMessage.mContents, totalContents);
+  EXPECT_EQ(topicMessage.getContents().toVector(), totalContents);
+  EXPECT_EQ(topicMessage.mRunningHash, getTestRunningHash());
+  EXPECT_EQ(topicMessage.mChunks.size(), 2);
+  EXPECT_EQ(topicMessage.mConsensusTimestamp, getTestConsensusTimestamp() + std::chrono::seconds(1));
+  EXPECT_EQ(topicMessage.mSequenceNumber, getTestSequenceNumber() + 1ULL);
+  EXPECT_EQ(topicMessage.mTransactionId, getTestTransactionId());
+}
+
+//-----
+TEST_F(TopicMessageUnitTests, ViewOfNothingThrows)
+{
+  // Given
+  const auto protos = std::make_shared<std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>>();
+
+  // When / Then
+  EXPECT_THROW(const TopicMessage topicMessage = TopicMessage::viewOf(protos), std::invalid_argument);
+  EXPECT_THROW(const TopicMessage topicMessage = TopicMessage::viewOf(nullptr), std::invalid_argument);
+}
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "ED25519PrivateKey.h"
+#include "TopicMessageSubmitTransaction.h"
+#include "TopicPublisher.h"
+#include "exceptions/IllegalStateException.h"
+#include "exceptions/UninitializedException.h"
+
+#include <grpcpp/grpcpp.h>
+#include <gtest/gtest.h>
+#include <services/consensus_service.grpc.pb.h>
+#include <services/response_code.pb.h>
+#include <services/transaction.pb.h>
+#include <services/transaction_response.pb.h>
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Hiero;
+
+class TopicPublisherUnitTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // The node's ConsensusService answers every call with UNIMPLEMENTED, and the response listener of the transaction
+    // template stands in for it. This only needs a reachable node.
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &mPort);
+    builder.RegisterService(&mService);
+    mServer = builder.BuildAndStart();
+
+    mNodeClient = Client::forNetwork({
+      {"127.0.0.1:" + std::to_string(mPort), mNodeAccountId}
+    });
+    mNodeClient.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey());
+  }
+
+  void TearDown() override
+  {
+    mNodeClient.close();
+    mServer->Shutdown();
+  }
+
+  // Make a transaction template whose submissions to the test node succeed.
+  [[nodiscard]] TopicMessageSubmitTransaction makeSucceedingTemplate() const
+  {
+    TopicMessageSubmitTransaction transaction;
+    transaction.setNodeAccountIds({ mNodeAccountId });
+    transaction.setResponseListener(
+      [](proto::TransactionResponse&)
+      {
+        proto::TransactionResponse response;
+        response.set_nodetransactionprecheckcode(proto::ResponseCodeEnum::OK);
+        return response;
+      });
+    return transaction;
+  }
+
+  [[nodiscard]] inline const Client& getTestClient() const { return mClient; }
+  [[nodiscard]] inline const Client& getNodeClient() const { return mNodeClient; }
+  [[nodiscard]] inline const TopicId& getTestTopicId() const { return mTestTopicId; }
+  [[nodiscard]] inline const std::vector<std::byte>& getTestMessage() const { return mTestMessage; }
+
+private:
+  const Client mClient;
+  const TopicId mTestTopicId = TopicId(1ULL, 2ULL, 3ULL);
+  const std::vector<std::byte> mTestMessage = { std::byte(0x04), std::byte(0x05), std::byte(0x06) };
+  const AccountId mNodeAccountId = AccountId(3ULL);
+  proto::ConsensusService::Service mService;
+  std::unique_ptr<grpc::Server> mServer;
+  int mPort = 0;
+  Client mNodeClient;
+};
+
+//-----
+TEST_F(TopicPublisherUnitTests, GetSetConfiguration)
+{
+  // Given
+  TopicPublisher publisher(getTestClient(), getTestTopicId());
+
+  // When
+  EXPECT_NO_THROW(publisher.setQueueCapacity(5ULL)
+                    .setOverflowPolicy(TopicPublisher::OverflowPolicy::DROP)
+                    .setMaxInFlight(2U)
+                    .setBatchSize(3U));
+
+  // Then
+  EXPECT_EQ(publisher.getTopicId(), getTestTopicId());
+  EXPECT_EQ(publisher.getQueueCapacity(), 5ULL);
+  EXPECT_EQ(publisher.getOverflowPolicy(), TopicPublisher::OverflowPolicy::DROP);
+  EXPECT_EQ(publisher.getMaxInFlight(), 2U);
+  EXPECT_EQ(publisher.getBatchSize(), 3U);
+}
+
+//-----
+TEST_F(TopicPublisherUnitTests, SetZeroConfigurationThrows)
+{
+  // Given
+  TopicPublisher publisher(getTestClient(), getTestTopicId());
+
+  // When / Then
+  EXPECT_THROW(publisher.setQueueCapacity(0ULL), std::invalid_argument);
+  EXPECT_THROW(publisher.setMaxInFlight(0U), std::invalid_argument);
+  EXPECT_THROW(publisher.setBatchSize(0U), std::invalid_argument);
+}
+
+//-----
+TEST_F(TopicPublisherUnitTests, ReportsFailedSubmissions)
+{
+  // Given
+  std::mutex mutex;
+  std::vector<TopicPublisher::PublishResult> results;
+  TopicPublisher publisher(getTestClient(), getTestTopicId());
+  publisher.setResultHandler(
+    [&mutex, &results](const TopicPublisher::PublishResult& result)
+    {
+      std::unique_lock lock(mutex);
+      results.push_back(result);
+    });
+
+  // When
+  const std::optional<uint64_t> first = publisher.publish(getTestMessage());
+  const std::optional<uint64_t> second = publisher.publish(getTestMessage());
+  publisher.flush();
+
+  // Then
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(*first, 0ULL);
+  EXPECT_EQ(*second, 1ULL);
+
+  // The test Client has no operator, so every message should fail to freeze.
+  ASSERT_EQ(results.size(), 2U);
+  for (const TopicPublisher::PublishResult& result : results)
+  {
+    EXPECT_FALSE(result.mResponse.has_value());
+    EXPECT_THROW(std::rethrow_exception(result.mError), UninitializedException);
+  }
+
+  const TopicPublisher::Statistics statistics = publisher.getStatistics();
+  EXPECT_EQ(statistics.mPublished, 0ULL);
+  EXPECT_EQ(statistics.mFailed, 2ULL);
+  EXPECT_EQ(statistics.mQueued, 0ULL);
+}
+
+//-----
+TEST_F(TopicPublisherUnitTests, CannotConfigureAfterPublishing)
+{
+  // Given
+  TopicPublisher publisher(getTestClient(), getTestTopicId());
+  publisher.publish(getTestMessage());
+
+  // When / Then
+  EXPECT_THROW(publisher.setBatchSize(1U), IllegalStateException);
+  EXPECT_THROW(publisher.setTransactionTemplate(TopicMessageSubmitTransaction()), IllegalStateException);
+}
+
+//-----
+TEST_F(TopicPublisherUnitTests, CannotPublishAfterClose)
+{
+  // Given
+  TopicPublisher publisher(getTestClient(), getTestTopicId());
+
+  // When
+  publisher.close();
+
+  // Then
+  EXPECT_THROW(publisher.publish(getTestMessage()), IllegalStateException);
+}
+
+//-----
+TEST_F(TopicPublisherUnitTests, ResultHandlerCanPublishToFullQueue)
+{
+  // Given
+  std::mutex mutex;
+  std::vector<uint64_t> sequences;
+  bool flushThrew = false;
+  bool closeThrew = false;
+  TopicPublisher publisher(getTestClient(), getTestTopicId());
+  publisher.setQueueCapacity(1ULL).setMaxInFlight(1U).setBatchSize(1U);
+  publisher.setResultHandler(
+    [&](const TopicPublisher::PublishResult& result)
+    {
+      if (result.mSequence == 0ULL)
+      {
+        // The first fills the queue, so the second would wait for the only worker, which is running this handler.
+        publisher.publish(getTestMessage());
+        publisher.publish(getTestMessage());
+
+        try
+        {
+          publisher.flush();
+        }
+        catch (const IllegalStateException&)
+        {
+          flushThrew = true;
+        }
+
+        try
+        {
+          publisher.close();
+        }
+        catch (const IllegalStateException&)
+        {
+          closeThrew = true;
+        }
+      }
+
+      std::unique_lock lock(mutex);
+      sequences.push_back(result.mSequence);
+    });
+
+  // When
+  publisher.publish(getTestMessage());
+  publisher.flush();
+
+  // Then
+  EXPECT_EQ(sequences, (std::vector<uint64_t>{ 0ULL, 1ULL, 2ULL }));
+  EXPECT_TRUE(flushThrew);
+  EXPECT_TRUE(closeThrew);
+  EXPECT_EQ(publisher.getStatistics().mFailed, 3ULL);
+}
+
+//-----
+TEST_F(TopicPublisherUnitTests, PublishesToNode)
+{
+  // Given
+  std::mutex mutex;
+  std::vector<TopicPublisher::PublishResult> results;
+  TopicPublisher publisher(getNodeClient(), getTestTopicId());
+  publisher.setTransactionTemplate(makeSucceedingTemplate()).setMaxInFlight(2U).setBatchSize(2U);
+  publisher.setResultHandler(
+    [&mutex, &results](const TopicPublisher::PublishResult& result)
+    {
+      std::unique_lock lock(mutex);
+      results.push_back(result);
+    });
+
+  // When
+  for (int i = 0; i < 3; ++i)
+  {
+    publisher.publish(getTestMessage());
+  }
+  publisher.flush();
+
+  // Then
+  ASSERT_EQ(results.size(), 3U);
+  for (const TopicPublisher::PublishResult& result : results)
+  {
+    EXPECT_FALSE(result.mError);
+    EXPECT_TRUE(result.mResponse.has_value());
+  }
+
+  const TopicPublisher::Statistics statistics = publisher.getStatistics();
+  EXPECT_EQ(statistics.mPublished, 3ULL);
+  EXPECT_EQ(statistics.mFailed, 0ULL);
+  EXPECT_EQ(statistics.mQueued, 0ULL);
+}
+
+//-----
+TEST_F(TopicPublisherUnitTests, ThrowingResultHandlerDoesNotStopPublisher)
+{
+  // Given
+  int calls = 0;
+  TopicPublisher publisher(getNodeClient(), getTestTopicId());
+  publisher.setTransactionTemplate(makeSucceedingTemplate()).setMaxInFlight(1U).setBatchSize(1U);
+  publisher.setResultHandler(
+    [&calls](const TopicPublisher::PublishResult&)
+    {
+      ++calls;
+      throw std::runtime_error("result handler failed");
+    });
+
+  // When
+  publisher.publish(getTestMessage());
+  publisher.publish(getTestMessage());
+  publisher.flush();
+
+  // Then
+  EXPECT_EQ(calls, 2);
+
+  const TopicPublisher::Statistics statistics = publisher.getStatistics();
+  EXPECT_EQ(statistics.mPublished, 2ULL);
+  EXPECT_EQ(statistics.mFailed, 0ULL);
+  EXPECT_NO_THROW(publisher.close());
+}
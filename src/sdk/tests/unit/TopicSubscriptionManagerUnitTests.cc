@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Client.h"
+#include "TopicCheckpointStore.h"
+#include "TopicMessage.h"
+#include "TopicSubscriptionManager.h"
+#include "TransactionId.h"
+#include "exceptions/IllegalStateException.h"
+
+#include <grpcpp/impl/codegen/status.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+using namespace Hiero;
+
+namespace
+{
+// A TopicCheckpointStore that only counts its flushes.
+class CountingCheckpointStore : public TopicCheckpointStore
+{
+public:
+  std::optional<std::chrono::system_clock::time_point> load(const TopicId&) override { return {}; }
+  void save(const TopicId&, const std::chrono::system_clock::time_point&) override {}
+  void flush() override { ++mFlushes; }
+
+  std::atomic_uint mFlushes{ 0U };
+};
+
+} // anonymous namespace
+
+class TopicSubscriptionManagerUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] inline const Client& getTestClient() const { return mClient; }
+  [[nodiscard]] inline const TopicId& getTestTopicId() const { return mTestTopicId; }
+
+private:
+  const Client mClient;
+  const TopicId mTestTopicId = TopicId(1ULL, 2ULL, 3ULL);
+};
+
+//-----
+TEST_F(TopicSubscriptionManagerUnitTests, ConstructWithoutStoreThrows)
+{
+  // Given / When / Then
+  EXPECT_THROW(TopicSubscriptionManager manager(getTestClient(), nullptr), std::invalid_argument);
+}
+
+//-----
+TEST_F(TopicSubscriptionManagerUnitTests, GetSetCheckpointInterval)
+{
+  // Given
+  TopicSubscriptionManager manager(getTestClient(), std::make_shared<CountingCheckpointStore>());
+
+  // When
+  EXPECT_NO_THROW(manager.setCheckpointInterval(std::chrono::seconds(1)));
+
+  // Then
+  EXPECT_EQ(manager.getCheckpointInterval(), std::chrono::seconds(1));
+  EXPECT_THROW(manager.setCheckpointInterval(std::chrono::seconds(-1)), std::invalid_argument);
+}
+
+//-----
+TEST_F(TopicSubscriptionManagerUnitTests, QueryTemplateKeepsRetryAndIncompleteMessageHandlers)
+{
+  // Given
+  TopicSubscriptionManager manager(getTestClient(), std::make_shared<CountingCheckpointStore>());
+  uint64_t incompleteChunks = 0ULL;
+  TopicMessageQuery query;
+  query.setMaxAttempts(4U)
+    .setRetryHandler([](const grpc::Status&) { return false; })
+    .setIncompleteMessageHandler([&incompleteChunks](const TransactionId&, uint64_t chunks, uint64_t)
+                                 { incompleteChunks = chunks; });
+
+  // When
+  manager.setQueryTemplate(query);
+
+  // Then
+  const TopicMessageQuery queryTemplate = manager.getQueryTemplate();
+  EXPECT_EQ(queryTemplate.getMaxAttempts(), 4U);
+  ASSERT_TRUE(queryTemplate.getRetryHandler());
+  EXPECT_FALSE(queryTemplate.getRetryHandler()(grpc::Status(grpc::StatusCode::UNAVAILABLE, "")));
+  ASSERT_TRUE(queryTemplate.getIncompleteMessageHandler());
+  queryTemplate.getIncompleteMessageHandler()(TransactionId(), 2ULL, 3ULL);
+  EXPECT_EQ(incompleteChunks, 2ULL);
+}
+
+//-----
+TEST_F(TopicSubscriptionManagerUnitTests, FailedSubscriptionIsReportedAndForgotten)
+{
+  // Given
+  TopicSubscriptionManager manager(getTestClient(), std::make_shared<CountingCheckpointStore>());
+  TopicId failedTopicId;
+  grpc::StatusCode failedCode = grpc::StatusCode::OK;
+  manager.setErrorHandler(
+    [&failedTopicId, &failedCode](const TopicId& topicId, const grpc::Status& status)
+    {
+      failedTopicId = topicId;
+      failedCode = status.error_code();
+    });
+
+  // When
+  manager.subscribe(getTestTopicId(), [](const TopicMessage&) {});
+
+  // Then
+  EXPECT_EQ(failedTopicId, getTestTopicId());
+  EXPECT_EQ(failedCode, grpc::StatusCode::FAILED_PRECONDITION);
+  EXPECT_TRUE(manager.getTopics().empty());
+}
+
+//-----
+TEST_F(TopicSubscriptionManagerUnitTests, CloseFlushesCheckpoints)
+{
+  // Given
+  auto store = std::make_shared<CountingCheckpointStore>();
+  TopicSubscriptionManager manager(getTestClient(), store);
+
+  // When
+  manager.close();
+
+  // Then
+  EXPECT_EQ(store->mFlushes, 1U);
+  EXPECT_THROW(manager.subscribe(getTestTopicId(), [](const TopicMessage&) {}), IllegalStateException);
+}
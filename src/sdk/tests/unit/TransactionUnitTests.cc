@@ -52,6 +52,8 @@
 #include <services/transaction_contents.pb.h>
 #include <transaction_list.pb.h>
 
+#include <sstream>
+
 using namespace Hiero;
 
 class TransactionUnitTests : public BaseUnitTest
@@ -3417,3 +3419,266 @@ TEST_F(TransactionUnitTests, ChunkedTransactionConstructorRejectsMixedTypes)
   // When / Then
   EXPECT_THROW(FileAppendTransaction{ transactions }, std::invalid_argument);
 }
+
+//-----
+// Security Test: A chunk whose body holds a CryptoTransfer followed by the FileAppend field number encoded as a varint
+// is a CryptoTransfer to a protobuf parser (the varint is an unknown field), so it must be rejected as a FileAppend
+// chunk.
+TEST_F(TransactionUnitTests, ChunkedTransactionConstructorRejectsDataFieldWithWrongWireType)
+{
+  // Given
+  proto::TransactionBody txBody1;
+  txBody1.set_allocated_fileappend(new proto::FileAppendTransactionBody);
+  txBody1.mutable_transactionid()->mutable_accountid()->set_accountnum(202);
+  txBody1.mutable_transactionid()->mutable_transactionvalidstart()->set_seconds(1700000030);
+
+  proto::SignedTransaction signedTx1;
+  signedTx1.set_bodybytes(txBody1.SerializeAsString());
+  proto::Transaction tx1;
+  tx1.set_signedtransactionbytes(signedTx1.SerializeAsString());
+
+  proto::TransactionBody txBody2;
+  txBody2.set_allocated_cryptotransfer(new proto::CryptoTransferTransactionBody);
+  txBody2.mutable_transactionid()->mutable_accountid()->set_accountnum(202);
+  txBody2.mutable_transactionid()->mutable_transactionvalidstart()->set_seconds(1700000031);
+
+  // Field 16 (fileAppend) with wire type 0 (varint) and value 1.
+  const int fileAppendTag = proto::TransactionBody::kFileAppendFieldNumber << 3;
+  std::string smuggledBodyBytes = txBody2.SerializeAsString();
+  smuggledBodyBytes.push_back(static_cast<char>((fileAppendTag & 0x7F) | 0x80));
+  smuggledBodyBytes.push_back(static_cast<char>(fileAppendTag >> 7));
+  smuggledBodyBytes.push_back(static_cast<char>(0x01));
+
+  proto::TransactionBody parsedBody2;
+  ASSERT_TRUE(parsedBody2.ParseFromString(smuggledBodyBytes));
+  ASSERT_EQ(parsedBody2.data_case(), proto::TransactionBody::kCryptoTransfer);
+
+  proto::SignedTransaction signedTx2;
+  signedTx2.set_bodybytes(smuggledBodyBytes);
+  proto::Transaction tx2;
+  tx2.set_signedtransactionbytes(signedTx2.SerializeAsString());
+
+  std::map<TransactionId, std::map<AccountId, proto::Transaction>> transactions;
+  transactions[TransactionId::withValidStart(AccountId(202), std::chrono::system_clock::from_time_t(1700000030))]
+              [AccountId(3)] = tx1;
+  transactions[TransactionId::withValidStart(AccountId(202), std::chrono::system_clock::from_time_t(1700000031))]
+              [AccountId(3)] = tx2;
+
+  // When / Then
+  EXPECT_THROW(FileAppendTransaction{ transactions }, std::invalid_argument);
+}
+
+//-----
+TEST_F(TransactionUnitTests, VerifyAllSignaturesOfSignedTransaction)
+{
+  // Given
+  const std::shared_ptr<ED25519PrivateKey> ed25519Key = ED25519PrivateKey::generatePrivateKey();
+  const std::shared_ptr<ECDSAsecp256k1PrivateKey> ecdsaKey = ECDSAsecp256k1PrivateKey::generatePrivateKey();
+  const std::vector<AccountId> nodeIds = { AccountId(3), AccountId(4) };
+
+  AccountCreateTransaction tx;
+  tx.setNodeAccountIds(nodeIds).setTransactionId(getTestTransactionIdMock()).freeze();
+  tx.sign(ed25519Key).sign(ecdsaKey);
+
+  // When
+  const std::vector<SignatureVerificationResult> results = tx.verifyAllSignatures();
+
+  // Then
+  ASSERT_EQ(results.size(), nodeIds.size() * 2);
+  for (const SignatureVerificationResult& result : results)
+  {
+    EXPECT_TRUE(result.mIsValid);
+    EXPECT_EQ(result.mChunk, 0U);
+    ASSERT_NE(result.mPublicKey, nullptr);
+  }
+}
+
+//-----
+TEST_F(TransactionUnitTests, VerifyAllSignaturesDetectsInvalidSignature)
+{
+  // Given
+  const std::shared_ptr<ED25519PrivateKey> privateKey = ED25519PrivateKey::generatePrivateKey();
+  const std::vector<std::byte> badSignature(64, std::byte{ 0xAB });
+
+  AccountCreateTransaction tx;
+  tx.setNodeAccountIds({ AccountId(3) }).setTransactionId(getTestTransactionIdMock()).freeze();
+  tx.addSignature(privateKey->getPublicKey(), badSignature);
+
+  // When
+  const WrappedTransaction wrappedTx = Transaction<AccountCreateTransaction>::fromBytes(tx.toBytes());
+  const std::vector<SignatureVerificationResult> results = wrappedTx.verifyAllSignatures();
+
+  // Then
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_FALSE(results.at(0).mIsValid);
+  EXPECT_EQ(results.at(0).mNodeAccountId, AccountId(3));
+  EXPECT_EQ(results.at(0).mSignature, badSignature);
+  ASSERT_NE(results.at(0).mPublicKey, nullptr);
+  EXPECT_EQ(results.at(0).mPublicKey->toBytesRaw(), privateKey->getPublicKey()->toBytesRaw());
+}
+
+//-----
+TEST_F(TransactionUnitTests, VerifyAllSignaturesOfManyTransactions)
+{
+  // Given
+  const std::shared_ptr<ED25519PrivateKey> privateKey = ED25519PrivateKey::generatePrivateKey();
+
+  std::vector<WrappedTransaction> transactions;
+  for (int i = 0; i < 3; ++i)
+  {
+    TransferTransaction tx;
+    tx.setNodeAccountIds({ AccountId(3) }).setTransactionId(getTestTransactionIdMock()).freeze();
+    tx.sign(privateKey);
+    transactions.push_back(Transaction<TransferTransaction>::fromBytes(tx.toBytes()));
+  }
+
+  // When
+  const std::vector<std::vector<SignatureVerificationResult>> results = verifyAllSignatures(transactions);
+
+  // Then
+  ASSERT_EQ(results.size(), transactions.size());
+  for (const std::vector<SignatureVerificationResult>& transactionResults : results)
+  {
+    ASSERT_EQ(transactionResults.size(), 1);
+    EXPECT_TRUE(transactionResults.at(0).mIsValid);
+  }
+}
+
+//-----
+TEST_F(TransactionUnitTests, VerifyAllSignaturesThrowsIfNotFrozen)
+{
+  // Given
+  AccountCreateTransaction tx;
+  std::vector<SignatureVerificationResult> results;
+
+  // When / Then
+  EXPECT_THROW(results = tx.verifyAllSignatures(), IllegalStateException);
+}
+
+//-----
+TEST_F(TransactionUnitTests, ToBytesIntoExistingVectorAndWriteToStreamMatchToBytes)
+{
+  // Given
+  const std::shared_ptr<ED25519PrivateKey> privateKey = ED25519PrivateKey::generatePrivateKey();
+  TransferTransaction tx;
+  tx.setNodeAccountIds({ AccountId(3), AccountId(4) })
+    .setTransactionId(getTestTransactionIdMock())
+    .addHbarTransfer(AccountId(2), Hbar(-1LL))
+    .addHbarTransfer(AccountId(3), Hbar(1LL))
+    .freeze();
+  tx.sign(privateKey);
+
+  // Stale contents that should be replaced.
+  std::vector<std::byte> bytes = { std::byte(0x1), std::byte(0x2), std::byte(0x3) };
+  std::ostringstream stream;
+
+  // When
+  tx.toBytes(bytes);
+  tx.writeTo(stream);
+
+  // Then
+  const std::vector<std::byte> expectedBytes = tx.toBytes();
+  EXPECT_EQ(bytes, expectedBytes);
+  EXPECT_TRUE(stream.good());
+  EXPECT_EQ(internal::Utilities::stringToByteVector(stream.str()), expectedBytes);
+
+  proto::TransactionList txList;
+  ASSERT_TRUE(txList.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())));
+  ASSERT_EQ(txList.transaction_list_size(), 2);
+
+  proto::SignedTransaction signedTx;
+  ASSERT_TRUE(signedTx.ParseFromString(txList.transaction_list(0).signedtransactionbytes()));
+  EXPECT_EQ(signedTx.sigmap().sigpair_size(), 1);
+}
+
+//-----
+TEST_F(TransactionUnitTests, ToBytesOfUnfrozenTransactionWithoutNodesRoundTrips)
+{
+  // Given
+  TransferTransaction tx;
+  tx.setTransactionId(getTestTransactionIdMock()).addHbarTransfer(AccountId(2), Hbar(-1LL));
+  std::ostringstream stream;
+
+  // When
+  std::vector<std::byte> bytes;
+  tx.toBytes(bytes);
+  tx.writeTo(stream);
+
+  // Then
+  EXPECT_EQ(internal::Utilities::stringToByteVector(stream.str()), bytes);
+  const WrappedTransaction wrappedTx = Transaction<TransferTransaction>::fromBytes(bytes);
+  ASSERT_NE(wrappedTx.getTransaction<TransferTransaction>(), nullptr);
+  EXPECT_EQ(wrappedTx.getTransaction<TransferTransaction>()->getTransactionId(), getTestTransactionIdMock());
+}
+
+//-----
+TEST_F(TransactionUnitTests, FromStreamOfChunkedTransactionMatchesFromBytes)
+{
+  // Given
+  const std::vector<std::byte> contents(50ULL, std::byte(0x01));
+  FileAppendTransaction tx;
+  tx.setNodeAccountIds({ AccountId(3ULL), AccountId(4ULL) })
+    .setTransactionId(getTestTransactionIdMock())
+    .setFileId(FileId(5ULL))
+    .setContents(contents)
+    .setChunkSize(16U);
+  tx.freeze();
+  const std::vector<std::byte> bytes = tx.toBytes();
+  std::istringstream stream(internal::Utilities::byteVectorToString(bytes));
+
+  // When
+  const WrappedTransaction fromStream = Transaction<FileAppendTransaction>::fromBytes(stream);
+  const WrappedTransaction fromBytes = Transaction<FileAppendTransaction>::fromBytes(bytes);
+
+  // Then
+  ASSERT_NE(fromStream.getTransaction<FileAppendTransaction>(), nullptr);
+  ASSERT_NE(fromBytes.getTransaction<FileAppendTransaction>(), nullptr);
+  EXPECT_EQ(fromStream.getTransaction<FileAppendTransaction>()->getContents(),
+            fromBytes.getTransaction<FileAppendTransaction>()->getContents());
+  EXPECT_EQ(fromStream.getTransaction<FileAppendTransaction>()->getNodeAccountIds(),
+            fromBytes.getTransaction<FileAppendTransaction>()->getNodeAccountIds());
+}
+
+//-----
+TEST_F(TransactionUnitTests, FromStreamOfTransactionBody)
+{
+  // Given
+  proto::TransactionBody txBody;
+  txBody.set_allocated_cryptotransfer(new proto::CryptoTransferTransactionBody);
+  std::istringstream stream(txBody.SerializeAsString());
+
+  // When
+  const WrappedTransaction wrappedTx = Transaction<TransferTransaction>::fromBytes(stream);
+
+  // Then
+  EXPECT_NE(wrappedTx.getTransaction<TransferTransaction>(), nullptr);
+}
+
+//-----
+TEST_F(TransactionUnitTests, FromStreamRejectsChunksOfDifferentTypes)
+{
+  // Given
+  proto::TransactionList txList;
+  for (int i = 0; i < 2; ++i)
+  {
+    proto::TransactionBody txBody;
+    txBody.set_allocated_transactionid(getTestTransactionIdMock().toProtobuf().release());
+    if (i == 0)
+    {
+      txBody.set_allocated_fileappend(new proto::FileAppendTransactionBody);
+    }
+    else
+    {
+      txBody.set_allocated_cryptotransfer(new proto::CryptoTransferTransactionBody);
+    }
+
+    proto::SignedTransaction signedTx;
+    signedTx.set_bodybytes(txBody.SerializeAsString());
+    txList.add_transaction_list()->set_signedtransactionbytes(signedTx.SerializeAsString());
+  }
+
+  std::istringstream stream(txList.SerializeAsString());
+
+  // When / Then
+  EXPECT_THROW(static_cast<void>(Transaction<FileAppendTransaction>::fromBytes(stream)), std::invalid_argument);
+}